@@ -25,6 +25,7 @@ AppsContainer* AppsContainer::sharedAppsContainer() {
 AppsContainer::AppsContainer()
     : Container(),
       m_firstUSBEnumeration(true),
+      m_endOfPoolBeforeApps(nullptr),
       m_examPopUpController(),
       m_promptController(k_promptMessages, k_promptColors,
                          k_promptNumberOfMessages)
@@ -282,6 +283,13 @@ void AppsContainer::handleRunException() {
 }
 
 void AppsContainer::run() {
+  start();
+  runStepsWhile(nullptr, nullptr);
+  stop();
+}
+
+void AppsContainer::start() {
+  m_endOfPoolBeforeApps = TreePool::sharedPool->cursor();
   window()->setAbsoluteFrame(KDRectScreen);
   Preferences* poincarePreferences = Preferences::sharedPreferences;
   Poincare::ExamMode examMode = poincarePreferences->examMode();
@@ -293,20 +301,25 @@ void AppsContainer::run() {
   Ion::Power::selectStandbyMode(false);
   Ion::Events::setSpinner(true);
   Ion::Display::setScreenshotCallback(ShowCursor);
+}
 
+bool AppsContainer::runStepsWhile(bool (*callback)(void* ctx), void* ctx) {
   /* Setup the home checkpoint so that the exception chekpoint will be
    * reactivated on a home interrupt. This way, the main exception checkpoint
-   * will keep the home checkpoint as parent. */
+   * will keep the home checkpoint as parent.
+   * When running step by step, the checkpoints are set again for each step.
+   * They must not start after the nodes created by the apps during the
+   * previous steps, which would otherwise not be reference counted anymore. */
   bool homeInterruptOcurred;
   CircuitBreakerCheckpoint homeCheckpoint(
-      Ion::CircuitBreaker::CheckpointType::Home);
+      Ion::CircuitBreaker::CheckpointType::Home, m_endOfPoolBeforeApps);
   if (CircuitBreakerRun(homeCheckpoint)) {
     homeInterruptOcurred = false;
   } else {
     homeInterruptOcurred = true;
   }
 
-  ExceptionCheckpoint exceptionCheckpoint;
+  ExceptionCheckpoint exceptionCheckpoint(m_endOfPoolBeforeApps);
   if (ExceptionRun(exceptionCheckpoint)) {
     if (homeInterruptOcurred) {
       /* Reset backlight and suspend timers here, because a keyboard event has
@@ -322,7 +335,7 @@ void AppsContainer::run() {
       } else {
         switchToBuiltinApp(homeAppSnapshot());
       }
-    } else {
+    } else if (s_activeApp == nullptr) {
       /* Normal execution. The exception checkpoint must be created before
        * switching to the first app, because the first app might create nodes on
        * the pool. */
@@ -340,10 +353,13 @@ void AppsContainer::run() {
                                 I18n::Message::PoolMemoryFull2, true);
   }
 
-  Container::run();
-  switchToBuiltinApp(nullptr);
+  window()->redraw();
+  runWhile(callback, ctx);
+  return !isTerminated();
 }
 
+void AppsContainer::stop() { switchToBuiltinApp(nullptr); }
+
 bool AppsContainer::updateBatteryState() {
   bool batteryLevelUpdated = m_window.updateBatteryLevel();
   bool pluggedStateUpdated = m_window.updatePluggedState();
@@ -44,6 +44,12 @@ class AppsContainer : public Escher::Container, Ion::Storage::StorageDelegate {
   void switchToBuiltinApp(Escher::App::Snapshot* snapshot) override;
   void switchToExternalApp(Ion::ExternalApps::App app);
   void run() override;
+  /* run is split into the following steps for hosts that own the main loop.
+   * Each call to runStepsWhile processes events as long as callback returns
+   * true, and returns false once the Termination event has been fired. */
+  void start();
+  bool runStepsWhile(bool (*callback)(void* ctx), void* ctx);
+  void stop();
   bool updateBatteryState();
   void refreshPreferences();
   void reloadTitleBarView();
@@ -79,6 +85,8 @@ class AppsContainer : public Escher::Container, Ion::Storage::StorageDelegate {
   static const KDColor k_promptColors[];
   static const int k_promptNumberOfMessages;
   bool m_firstUSBEnumeration;
+  // The nodes created by the apps lie after it, see runStepsWhile
+  Poincare::TreeNode* m_endOfPoolBeforeApps;
   AppsWindow m_window;
   EmptyBatteryWindow m_emptyBatteryWindow;
   Shared::GlobalContext m_globalContext;
@@ -17,7 +17,7 @@
 // Take the Home app into account
 constexpr int k_numberOfCommonApps = 1 + APPS_CONTAINER_SNAPSHOT_COUNT;
 
-OMG::GlobalBox<AppsContainerStorage>
+OMG_INSTANCE_LOCAL OMG::GlobalBox<AppsContainerStorage>
     AppsContainerStorage::sharedAppsContainerStorage;
 
 AppsContainerStorage::AppsContainerStorage()
@@ -56,7 +56,7 @@ void* AppsContainerStorage::currentAppBuffer() {
   /* We use the $ char to be able to link this symbol at a specific location,
    * namely, the end of bss section, in order to extend the external app
    * sandbox range. */
-  static Apps s_apps
+  static OMG_INSTANCE_LOCAL Apps s_apps
 #if PLATFORM_DEVICE
       __attribute__((section(".bss.$app_buffer")));
 #else
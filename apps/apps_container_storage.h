@@ -2,6 +2,7 @@
 #define APPS_CONTAINER_STORAGE_H
 
 #include <omg/global_box.h>
+#include <omg/instance_local.h>
 
 #include "apps_container.h"
 
@@ -12,7 +13,8 @@
 class AppsContainerStorage : public AppsContainer {
  public:
   AppsContainerStorage();
-  static OMG::GlobalBox<AppsContainerStorage> sharedAppsContainerStorage;
+  static OMG_INSTANCE_LOCAL OMG::GlobalBox<AppsContainerStorage>
+      sharedAppsContainerStorage;
   int numberOfBuiltinApps() override;
   Escher::App::Snapshot* appSnapshotAtIndex(int index) override;
   void* currentAppBuffer() override;
@@ -91,4 +91,10 @@ void App::didBecomeActive(Window *window) {
   Shared::LayoutFieldDelegateApp::didBecomeActive(window);
 }
 
+void App::willBecomeInactive() {
+  // Give the pool back to the next app
+  m_layoutCache.reset();
+  Shared::LayoutFieldDelegateApp::willBecomeInactive();
+}
+
 }  // namespace Calculation
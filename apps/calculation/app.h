@@ -8,6 +8,7 @@
 #include "calculation_store.h"
 #include "edit_expression_controller.h"
 #include "history_controller.h"
+#include "layout_cache.h"
 
 namespace Calculation {
 
@@ -66,6 +67,8 @@ class App : public Shared::LayoutFieldDelegateApp {
   bool isAcceptableExpression(Escher::EditableField *field,
                               const Poincare::Expression expression) override;
 
+  LayoutCache *layoutCache() { return &m_layoutCache; }
+
   Snapshot *snapshot() const {
     return static_cast<Snapshot *>(Shared::LayoutFieldDelegateApp::snapshot());
   }
@@ -74,7 +77,10 @@ class App : public Shared::LayoutFieldDelegateApp {
   App(Snapshot *snapshot);
 
   void didBecomeActive(Escher::Window *window) override;
+  void willBecomeInactive() override;
 
+  // Shared by the history cells and HistoryViewCell::Height
+  LayoutCache m_layoutCache;
   HistoryController m_historyController;
   EditExpressionController m_editExpressionController;
 };
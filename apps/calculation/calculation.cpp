@@ -43,29 +43,64 @@ bool Calculation::operator==(const Calculation &c) {
 }
 
 Calculation *Calculation::next() const {
-  const char *result =
-      reinterpret_cast<const char *>(this) + sizeof(Calculation);
+  // Pass input, exactOutput, approximateOutput x2
+  return reinterpret_cast<Calculation *>(
+      const_cast<char *>(textAtIndex(k_numberOfExpressions)));
+}
+
+static uint16_t TreeSize(const char *tree) {
+  // The tree size is not aligned
+  uint16_t size;
+  memcpy(&size, tree, sizeof(size));
+  return size;
+}
+
+const char *Calculation::nextSerializedExpression(const char *text) const {
+  const char *tree = text + strlen(text) + 1;
+  return m_hasTrees ? tree + sizeof(uint16_t) + TreeSize(tree) : tree;
+}
+
+const char *Calculation::textAtIndex(int index) const {
+  assert(0 <= index && index <= k_numberOfExpressions);
+  const char *result = m_inputText;
+  for (int i = 0; i < index; i++) {
+    result = nextSerializedExpression(result);
+  }
+  return result;
+}
+
+size_t Calculation::dropTrees() {
+  if (!m_hasTrees) {
+    return 0;
+  }
+  char *end = const_cast<char *>(textAtIndex(k_numberOfExpressions));
+  char *source = m_inputText;
+  char *destination = m_inputText;
   for (int i = 0; i < k_numberOfExpressions; i++) {
-    // Pass inputText, exactOutputText, ApproximateOutputText x2
-    result = result + strlen(result) + 1;
+    const char *next = nextSerializedExpression(source);
+    size_t textSize = strlen(source) + 1;
+    memmove(destination, source, textSize);
+    destination += textSize;
+    source = const_cast<char *>(next);
   }
-  return reinterpret_cast<Calculation *>(const_cast<char *>(result));
+  m_hasTrees = false;
+  return end - destination;
 }
 
-const char *Calculation::approximateOutputText(
-    NumberOfSignificantDigits numberOfSignificantDigits) const {
-  const char *exactOutput = exactOutputText();
-  const char *approximateOutputTextWithMaxNumberOfDigits =
-      exactOutput + strlen(exactOutput) + 1;
-  if (numberOfSignificantDigits == NumberOfSignificantDigits::Maximal) {
-    return approximateOutputTextWithMaxNumberOfDigits;
+Expression Calculation::expressionAtIndex(int index) const {
+  const char *text = textAtIndex(index);
+  const char *tree = text + strlen(text) + 1;
+  uint16_t size = m_hasTrees ? TreeSize(tree) : 0;
+  if (size == 0) {
+    return Expression::Parse(text, nullptr);
   }
-  return approximateOutputTextWithMaxNumberOfDigits +
-         strlen(approximateOutputTextWithMaxNumberOfDigits) + 1;
+  return Expression::ExpressionFromAddress(tree + sizeof(uint16_t), size);
 }
 
-Expression Calculation::input() {
-  return Expression::Parse(m_inputText, nullptr);
+const char *Calculation::approximateOutputText(
+    NumberOfSignificantDigits numberOfSignificantDigits) const {
+  return textAtIndex(
+      numberOfSignificantDigits == NumberOfSignificantDigits::Maximal ? 2 : 3);
 }
 
 Expression Calculation::exactOutput() {
@@ -73,7 +108,7 @@ Expression Calculation::exactOutput() {
    * thereby avoid turning cos(Pi/4) into sqrt(2)/2 and displaying
    * 'sqrt(2)/2 = 0.999906' (which is totally wrong) instead of
    * 'cos(pi/4) = 0.999906' (which is true in degree). */
-  return Expression::Parse(exactOutputText(), nullptr);
+  return expressionAtIndex(1);
 }
 
 Expression Calculation::approximateOutput(
@@ -86,7 +121,8 @@ Expression Calculation::approximateOutput(
    * However, since the approximate output may contain units and that a
    * Poincare::Unit approximates to undef, thus it must not be approximated
    * anymore.
-   * We have to keep two serializations of the approximation outputs:
+   * We have to keep two serializations of the approximation outputs, and the
+   * trees they are parsed into:
    * - one with the maximal significant digits, to be used by 'Ans' or when
    *   handling 'OK' event on the approximation output.
    * - one with the displayed number of significant digits that we parse to
@@ -109,8 +145,8 @@ Expression Calculation::approximateOutput(
    *
    */
   // clang-format on
-  return Expression::Parse(approximateOutputText(numberOfSignificantDigits),
-                           nullptr);
+  return expressionAtIndex(
+      numberOfSignificantDigits == NumberOfSignificantDigits::Maximal ? 2 : 3);
 }
 
 Layout Calculation::createInputLayout() {
@@ -154,14 +190,36 @@ Layout Calculation::createApproximateOutputLayout(
 }
 
 KDCoordinate Calculation::height(bool expanded) {
-  KDCoordinate h = expanded ? m_expandedHeight : m_height;
+  KDCoordinate h = expanded ? m_heights[0].expandedHeight : m_heights[0].height;
   assert(h >= 0);
   return h;
 }
 
-void Calculation::setHeights(KDCoordinate height, KDCoordinate expandedHeight) {
-  m_height = height;
-  m_expandedHeight = expandedHeight;
+bool Calculation::useMemoizedHeights(uint8_t preferencesKey) {
+  for (int i = 0; i < k_numberOfMemoizedHeights; i++) {
+    if (m_heights[i].preferencesKey == preferencesKey) {
+      // Move them in front
+      MemoizedHeights heights = m_heights[i];
+      for (int j = i; j > 0; j--) {
+        m_heights[j] = m_heights[j - 1];
+      }
+      m_heights[0] = heights;
+      return true;
+    }
+  }
+  return false;
+}
+
+void Calculation::setHeights(uint8_t preferencesKey, KDCoordinate height,
+                             KDCoordinate expandedHeight) {
+  assert(preferencesKey != k_noPreferencesKey);
+  if (!useMemoizedHeights(preferencesKey)) {
+    // Forget the least recently used heights
+    for (int i = k_numberOfMemoizedHeights - 1; i > 0; i--) {
+      m_heights[i] = m_heights[i - 1];
+    }
+  }
+  m_heights[0] = {preferencesKey, height, expandedHeight};
 }
 
 static bool ShouldOnlyDisplayExactOutput(Expression input) {
@@ -13,10 +13,25 @@ class CalculationStore;
 
 // clang-format off
 /* A calculation is:
- *  |     uint8_t   |KDCoordinate|  KDCoordinate  |  uint8_t  |   ...     |      ...       |         ...           |          ...          |
- *  |m_displayOutput|  m_height  |m_expandedHeight|m_equalSign|m_inputText|m_exactOuputText|m_approximateOuputText1|m_approximateOuputText2|
- *                                                                                               with maximal           with displayed
- *                                                                                            significant digits      significant digits
+ *  |     uint8_t   |   MemoizedHeights  |  uint8_t  |   bool   |  ...  |     ...     |          ...          |          ...          |
+ *  |m_displayOutput|     m_heights      |m_equalSign|m_hasTrees| input | exactOutput |  approximateOutput1   |  approximateOutput2   |
+ *                                                                                         with maximal           with displayed
+ *                                                                                      significant digits      significant digits
+ *
+ * Each expression is stored as its text, followed, if m_hasTrees, by the
+ * nodes of the tree obtained by parsing this text, as they are laid out in the
+ * TreePool:
+ *  |  ...   | uint16_t | ... |
+ *  |text\0 |   size   |nodes|
+ * The text is inserted in the edition field, while the tree is copied
+ * straight back into the pool to display the calculation, compute its heights
+ * or use it as Ans. A size of 0 stands for a missing tree, when the text could
+ * not be parsed or there was no room left for the tree: the text is then
+ * parsed again.
+ *
+ * Trees are several times bigger than texts. Not to shorten the history, the
+ * store drops the trees of older calculations, whose expressions are then
+ * stored as their texts only.
  *
  * */
 // clang-format on
@@ -24,6 +39,17 @@ class CalculationStore;
 class Calculation {
   friend CalculationStore;
 
+  /* Heights are memoized for the last sets of preferences they were computed
+   * with, identified by a key, so that toggling a setting back and forth does
+   * not compute them again. m_heights[0] holds the heights in use. */
+  constexpr static int k_numberOfMemoizedHeights = 2;
+  constexpr static uint8_t k_noPreferencesKey = 0xFF;
+  struct MemoizedHeights {
+    uint8_t preferencesKey;
+    KDCoordinate height;
+    KDCoordinate expandedHeight;
+  } __attribute__((packed));
+
  public:
   constexpr static int k_numberOfExpressions = 4;
   enum class EqualSign : uint8_t { Unknown, Approximation, Equal };
@@ -63,15 +89,19 @@ class Calculation {
    * more space, fail to serialize, clear more space, etc., until reaching
    * sufficient free space. */
   constexpr static int k_minimalSize =
-      sizeof(uint8_t) + 2 * sizeof(KDCoordinate) + sizeof(uint8_t) +
-      k_numberOfExpressions * Constant::MaxSerializedExpressionSize;
+      sizeof(uint8_t) + k_numberOfMemoizedHeights * sizeof(MemoizedHeights) +
+      sizeof(uint8_t) + sizeof(bool) +
+      k_numberOfExpressions *
+          (Constant::MaxSerializedExpressionSize + sizeof(uint16_t));
 
   Calculation()
       : m_displayOutput(DisplayOutput::Unknown),
-        m_height(-1),
-        m_expandedHeight(-1),
-        m_equalSign(EqualSign::Unknown) {
+        m_equalSign(EqualSign::Unknown),
+        m_hasTrees(true) {
     assert(sizeof(m_inputText) == 0);
+    for (MemoizedHeights& heights : m_heights) {
+      heights = {k_noPreferencesKey, -1, -1};
+    }
   }
   bool operator==(const Calculation& c);
   Calculation* next() const;
@@ -79,16 +109,14 @@ class Calculation {
   // Texts
   enum class NumberOfSignificantDigits { Maximal, UserDefined };
   const char* inputText() const { return m_inputText; }
-  const char* exactOutputText() const {
-    return m_inputText + strlen(m_inputText) + 1;
-  }
+  const char* exactOutputText() const { return textAtIndex(1); }
   /* See comment in approximateOutput implementation explaining the need of two
    * approximateOutputTexts. */
   const char* approximateOutputText(
       NumberOfSignificantDigits numberOfSignificantDigits) const;
 
   // Expressions
-  Poincare::Expression input();
+  Poincare::Expression input() { return expressionAtIndex(0); }
   Poincare::Expression exactOutput();
   Poincare::Expression approximateOutput(
       NumberOfSignificantDigits numberOfSignificantDigits);
@@ -116,16 +144,27 @@ class Calculation {
   constexpr static const char* k_maximalIntegerWithAdditionalInformation =
       "10000000000000000";
 
-  void setHeights(KDCoordinate height, KDCoordinate expandedHeight);
+  const char* nextSerializedExpression(const char* text) const;
+  const char* textAtIndex(int index) const;
+  Poincare::Expression expressionAtIndex(int index) const;
+
+  bool hasTrees() const { return m_hasTrees; }
+  /* Store the expressions as their texts only. Return the number of bytes
+   * freed at the end of the calculation. */
+  size_t dropTrees();
+
+  bool useMemoizedHeights(uint8_t preferencesKey);
+  void setHeights(uint8_t preferencesKey, KDCoordinate height,
+                  KDCoordinate expandedHeight);
 
   /* Buffers holding text expressions have to be longer than the text written
    * by user (of maximum length TextField::MaxBufferSize()) because when we
    * print an expression we add omitted signs (multiplications, parenthesis...)
    */
   DisplayOutput m_displayOutput;
-  KDCoordinate m_height __attribute__((packed));
-  KDCoordinate m_expandedHeight __attribute__((packed));
+  MemoizedHeights m_heights[k_numberOfMemoizedHeights];
   EqualSign m_equalSign;
+  bool m_hasTrees;
   char m_inputText[0];  // MUST be the last member variable
 };
 
@@ -2,6 +2,7 @@
 
 #include <apps/shared/expression_display_permissions.h>
 #include <poincare/circuit_breaker_checkpoint.h>
+#include <poincare/exception_checkpoint.h>
 #include <poincare/rational.h>
 #include <poincare/store.h>
 #include <poincare/symbol.h>
@@ -228,7 +229,7 @@ ExpiringPointer<Calculation> CalculationStore::push(
   // Compute the calculation heights
   Calculation *newCalculation =
       reinterpret_cast<Calculation *>(endOfCalculations());
-  SetCalculationHeights(newCalculation, heightComputer, context);
+  setCalculationHeights(newCalculation, heightComputer, context);
 
   /* Now that the calculation is fully built, we can finally update
    * m_numberOfCalculations. As that is the only variable tracking the state
@@ -236,31 +237,46 @@ ExpiringPointer<Calculation> CalculationStore::push(
    * should an interruption occur, all the temporary states are silently
    * discarded and no ill-formed Calculation is stored. */
   m_numberOfCalculations++;
-  return ExpiringPointer(newCalculation);
+
+  /* Trees are several times bigger than texts: only the most recent
+   * calculations keep theirs, which are the ones displayed and used as Ans. */
+  if (numberOfCalculations() > k_numberOfCalculationsWithTrees) {
+    dropTreesOfCalculationAtIndex(k_numberOfCalculationsWithTrees);
+  }
+  return calculationAtIndex(0);
 }
 
 void CalculationStore::recomputeHeightsIfPreferencesHaveChanged(
     Poincare::Preferences *preferences, HeightComputer heightComputer) {
   // Track settings that might invalidate HistoryCells heights
-  if (m_inUsePreferences.combinatoricSymbols() ==
-          preferences->combinatoricSymbols() &&
-      m_inUsePreferences.numberOfSignificantDigits() ==
-          preferences->numberOfSignificantDigits() &&
-      m_inUsePreferences.logarithmBasePosition() ==
-          preferences->logarithmBasePosition()) {
+  uint8_t preferencesKey = HeightsPreferencesKey(preferences);
+  if (HeightsPreferencesKey(&m_inUsePreferences) == preferencesKey) {
     return;
   }
   m_inUsePreferences = *preferences;
   for (int i = 0; i < numberOfCalculations(); i++) {
-    /* The void context is used since there is no reasons for the
-     * heightComputer to resolve symbols */
-    SetCalculationHeights(calculationAtIndex(i).pointer(), heightComputer,
-                          nullptr);
+    Calculation *calculation = calculationAtIndex(i).pointer();
+    if (!calculation->useMemoizedHeights(preferencesKey)) {
+      /* The void context is used since there is no reasons for the
+       * heightComputer to resolve symbols */
+      setCalculationHeights(calculation, heightComputer, nullptr);
+    }
   }
 }
 
 // Private
 
+uint8_t CalculationStore::HeightsPreferencesKey(
+    const Preferences *preferences) {
+  assert(preferences->numberOfSignificantDigits() < (1 << 4));
+  uint8_t key =
+      preferences->numberOfSignificantDigits() |
+      static_cast<uint8_t>(preferences->combinatoricSymbols()) << 4 |
+      static_cast<uint8_t>(preferences->logarithmBasePosition()) << 5;
+  assert(key != Calculation::k_noPreferencesKey);
+  return key;
+}
+
 char *CalculationStore::endOfCalculationAtIndex(int index) const {
   assert(0 <= index && index < numberOfCalculations());
   char *res = pointerArray()[index];
@@ -290,6 +306,21 @@ size_t CalculationStore::privateDeleteCalculationAtIndex(
   return deletedSize;
 }
 
+void CalculationStore::dropTreesOfCalculationAtIndex(int index) {
+  Calculation *calculation = calculationAtIndex(index).pointer();
+  char *calculationEnd = endOfCalculationAtIndex(index);
+  char *shiftedMemoryEnd = endOfCalculations();
+
+  Ion::CircuitBreaker::lock();
+  size_t droppedSize = calculation->dropTrees();
+  memmove(calculationEnd - droppedSize, calculationEnd,
+          shiftedMemoryEnd - calculationEnd);
+  for (int i = index; i >= 0; i--) {
+    pointerArray()[i] -= droppedSize;
+  }
+  Ion::CircuitBreaker::unlock();
+}
+
 ExpiringPointer<Calculation> CalculationStore::errorPushUndefined(
     HeightComputer heightComputer) {
   assert(numberOfCalculations() == 0);
@@ -300,7 +331,7 @@ ExpiringPointer<Calculation> CalculationStore::errorPushUndefined(
   Calculation *ptr = reinterpret_cast<Calculation *>(m_buffer);
   /* The void context is used since there is no reasons for the
    * heightComputer to resolve symbols */
-  SetCalculationHeights(ptr, heightComputer, nullptr);
+  setCalculationHeights(ptr, heightComputer, nullptr);
   m_numberOfCalculations = 1;
   return ExpiringPointer<Calculation>(ptr);
 }
@@ -326,7 +357,7 @@ char *CalculationStore::pushSerializedExpression(
                      : 0;
     if (length + 1 < availableSize) {
       assert(location[length] == '\0');
-      return location + length + 1;
+      return pushParsedTree(location + length + 1, length + 1);
     }
     if (numberOfCalculations() == 0) {
       return k_pushError;
@@ -336,6 +367,37 @@ char *CalculationStore::pushSerializedExpression(
   assert(false);
 }
 
+char *CalculationStore::pushParsedTree(char *location, int textSize) {
+  /* Parse the text without context, as the text itself would be parsed to
+   * rebuild the expression. If it fails, a size of 0 is pushed. */
+  Expression e;
+  {
+    ExceptionCheckpoint ecp;
+    if (ExceptionRun(ecp)) {
+      e = Expression::Parse(location - textSize, nullptr);
+    }
+  }
+  size_t treeSize = e.isUninitialized() ? 0 : e.size();
+  uint16_t size = treeSize <= UINT16_MAX ? treeSize : 0;
+  /* Trees only spare parsing the texts again: older calculations are not
+   * deleted to make room for them. */
+  if (spaceForNewCalculations(location) <=
+      static_cast<int>(sizeof(size) + size)) {
+    size = 0;
+  }
+  while (spaceForNewCalculations(location) <= static_cast<int>(sizeof(size))) {
+    if (numberOfCalculations() == 0) {
+      return k_pushError;
+    }
+    location -= deleteOldestCalculation(location);
+  }
+  memcpy(location, &size, sizeof(size));
+  if (size > 0) {
+    memcpy(location + sizeof(size), e.addressInPool(), size);
+  }
+  return location + sizeof(size) + size;
+}
+
 char *CalculationStore::pushUndefined(char *location) {
   return pushSerializedExpression(
       location, Undefined::Builder(),
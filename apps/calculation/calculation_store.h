@@ -19,6 +19,9 @@ namespace Calculation {
   If the remaining space is too small for storing a new calculation, we
   delete the oldest one.
 
+  Only the k_numberOfCalculationsWithTrees most recent calculations keep the
+  trees of their expressions, see Calculation.
+
  Memory layout :
                                                                 <- Available space for new calculations ->
 +--------------------------------------------------------------------------------------------------------------------+
@@ -62,11 +65,18 @@ class CalculationStore {
 
  private:
   static constexpr char *k_pushError = nullptr;
-
-  static void SetCalculationHeights(Calculation *calculation,
-                                    HeightComputer heightComputer,
-                                    Poincare::Context *context) {
-    calculation->setHeights(heightComputer(calculation, context, false),
+  // About a screen of history keeps its trees when room is needed
+  constexpr static int k_numberOfCalculationsWithTrees = 5;
+
+  /* Identify the preferences which the heights depend on, to memoize the
+   * heights per set of preferences. */
+  static uint8_t HeightsPreferencesKey(
+      const Poincare::Preferences *preferences);
+  void setCalculationHeights(Calculation *calculation,
+                             HeightComputer heightComputer,
+                             Poincare::Context *context) const {
+    calculation->setHeights(HeightsPreferencesKey(&m_inUsePreferences),
+                            heightComputer(calculation, context, false),
                             heightComputer(calculation, context, true));
   }
 
@@ -91,6 +101,7 @@ class CalculationStore {
     return privateDeleteCalculationAtIndex(numberOfCalculations() - 1,
                                            endOfTemporaryData);
   }
+  void dropTreesOfCalculationAtIndex(int index);
   Shared::ExpiringPointer<Calculation> errorPushUndefined(
       HeightComputer heightComputer);
 
@@ -99,6 +110,8 @@ class CalculationStore {
   char *pushEmptyCalculation(char *location);
   char *pushSerializedExpression(char *location, Poincare::Expression e,
                                  int numberOfSignificantDigits);
+  // Push the tree of the textSize long text which ends at location
+  char *pushParsedTree(char *location, int textSize);
   char *pushUndefined(char *location);
 
   char *const m_buffer;
@@ -156,6 +156,9 @@ bool EditExpressionController::inputViewDidReceiveEvent(
                                  m_workingBuffer)) {
       return true;
     }
+    /* Computations may need the whole pool: do not keep it busy with cached
+     * layouts. */
+    App::app()->layoutCache()->reset();
     if (m_calculationStore
             ->push(m_workingBuffer, myApp->localContext(),
                    HistoryViewCell::Height)
@@ -199,6 +202,7 @@ bool EditExpressionController::inputViewDidFinishEditing(const char *text,
     layoutR.serializeParsedExpression(m_workingBuffer, k_cacheBufferSize,
                                       context);
   }
+  App::app()->layoutCache()->reset();
   if (m_calculationStore
           ->push(m_workingBuffer, context, HistoryViewCell::Height)
           .pointer()) {
@@ -147,6 +147,7 @@ bool HistoryController::handleEvent(Ion::Events::Event event) {
   if (event == Ion::Events::Clear) {
     m_selectableTableView.deselectTable();
     m_calculationStore->deleteAll();
+    App::app()->layoutCache()->reset();
     reload();
     Container::activeApp()->setFirstResponder(parentResponder());
     return true;
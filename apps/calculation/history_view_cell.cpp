@@ -338,18 +338,78 @@ void HistoryViewCell::setCalculation(Calculation *calculation, bool expanded,
   // Memoization
   m_calculationCRC32 = newCalculationCRC;
   m_calculationAdditionInformations = calculation->additionalInformations();
-  m_inputView.setLayout(calculation->createInputLayout());
 
   /* All expressions have to be updated at the same time. Otherwise,
    * when updating one layout, if the second one still points to a deleted
    * layout, calling to layoutSubviews() would fail. */
 
+  LayoutCache *layoutCache = App::app()->layoutCache();
+  LayoutCache::Layouts layouts;
+  if (!layoutCache->layoutsForKey(
+          LayoutCache::KeyForCalculation(calculation, context,
+                                         Preferences::sharedPreferences),
+          &layouts)) {
+    layoutCache->makeRoomInPool();
+    layouts = createLayouts(calculation, context, canChangeDisplayOutput);
+    /* Key the layouts after their creation, which might have forced the
+     * display output. */
+    layoutCache->setLayoutsForKey(
+        LayoutCache::KeyForCalculation(calculation, context,
+                                       Preferences::sharedPreferences),
+        layouts);
+  }
+  m_inputView.setLayout(layouts.input);
+  m_calculationDisplayOutput = calculation->displayOutput(context);
+
+  /* We must set which subviews are displayed before setLayouts to mark the
+   * right rectangle as dirty */
+  m_scrollableOutputView.setDisplayableCenter(
+      m_calculationDisplayOutput ==
+          Calculation::DisplayOutput::ExactAndApproximate ||
+      m_calculationDisplayOutput ==
+          Calculation::DisplayOutput::ExactAndApproximateToggle);
+  m_scrollableOutputView.setDisplayCenter(
+      m_calculationDisplayOutput ==
+          Calculation::DisplayOutput::ExactAndApproximate ||
+      m_calculationExpanded);
+  m_scrollableOutputView.setLayouts(Layout(), layouts.exactOutput,
+                                    layouts.approximateOutput);
+  bool isEqual = calculation->exactAndApproximateDisplayedOutputsEqualSign(
+                     context) == Calculation::EqualSign::Equal;
+  m_scrollableOutputView.setExactAndApproximateAreStriclyEqual(isEqual);
+
+  /* The displayed input and outputs have changed. We need to re-layout the cell
+   * and re-initialize the scroll. */
+  layoutSubviews();
+  reloadScroll();
+}
+
+/* The pool may be filled with cached layouts. Forget them before giving up on
+ * a layout, and return true if there were any. */
+static bool ForgetCachedLayouts() {
+  LayoutCache *layoutCache = App::app()->layoutCache();
+  if (layoutCache->numberOfBytes() == 0) {
+    return false;
+  }
+  layoutCache->reset();
+  return true;
+}
+
+LayoutCache::Layouts HistoryViewCell::createLayouts(
+    Calculation *calculation, Context *context, bool canChangeDisplayOutput) {
+  Layout inputLayout = calculation->createInputLayout();
+
   // Create the exact output layout
   Layout exactOutputLayout = Layout();
   if (Calculation::DisplaysExact(calculation->displayOutput(context))) {
     bool couldNotCreateExactLayout = false;
     exactOutputLayout =
         calculation->createExactOutputLayout(&couldNotCreateExactLayout);
+    if (couldNotCreateExactLayout && ForgetCachedLayouts()) {
+      couldNotCreateExactLayout = false;
+      exactOutputLayout =
+          calculation->createExactOutputLayout(&couldNotCreateExactLayout);
+    }
     if (couldNotCreateExactLayout) {
       if (canChangeDisplayOutput &&
           calculation->displayOutput(context) !=
@@ -387,6 +447,11 @@ void HistoryViewCell::setCalculation(Calculation *calculation, bool expanded,
     bool couldNotCreateApproximateLayout = false;
     approximateOutputLayout = calculation->createApproximateOutputLayout(
         &couldNotCreateApproximateLayout);
+    if (couldNotCreateApproximateLayout && ForgetCachedLayouts()) {
+      couldNotCreateApproximateLayout = false;
+      approximateOutputLayout = calculation->createApproximateOutputLayout(
+          &couldNotCreateApproximateLayout);
+    }
     if (couldNotCreateApproximateLayout) {
       if (canChangeDisplayOutput &&
           calculation->displayOutput(context) !=
@@ -408,29 +473,7 @@ void HistoryViewCell::setCalculation(Calculation *calculation, bool expanded,
       }
     }
   }
-  m_calculationDisplayOutput = calculation->displayOutput(context);
-
-  /* We must set which subviews are displayed before setLayouts to mark the
-   * right rectangle as dirty */
-  m_scrollableOutputView.setDisplayableCenter(
-      m_calculationDisplayOutput ==
-          Calculation::DisplayOutput::ExactAndApproximate ||
-      m_calculationDisplayOutput ==
-          Calculation::DisplayOutput::ExactAndApproximateToggle);
-  m_scrollableOutputView.setDisplayCenter(
-      m_calculationDisplayOutput ==
-          Calculation::DisplayOutput::ExactAndApproximate ||
-      m_calculationExpanded);
-  m_scrollableOutputView.setLayouts(Layout(), exactOutputLayout,
-                                    approximateOutputLayout);
-  bool isEqual = calculation->exactAndApproximateDisplayedOutputsEqualSign(
-                     context) == Calculation::EqualSign::Equal;
-  m_scrollableOutputView.setExactAndApproximateAreStriclyEqual(isEqual);
-
-  /* The displayed input and outputs have changed. We need to re-layout the cell
-   * and re-initialize the scroll. */
-  layoutSubviews();
-  reloadScroll();
+  return {inputLayout, exactOutputLayout, approximateOutputLayout};
 }
 
 void HistoryViewCell::didBecomeFirstResponder() {
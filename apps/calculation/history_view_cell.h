@@ -6,6 +6,7 @@
 
 #include "../shared/scrollable_multiple_layouts_view.h"
 #include "calculation.h"
+#include "layout_cache.h"
 
 namespace Calculation {
 
@@ -86,6 +87,9 @@ class HistoryViewCell : public Escher::EvenOddCell, public Escher::Responder {
   void computeSubviewFrames(KDCoordinate frameWidth, KDCoordinate frameHeight,
                             KDRect* ellipsisFrame, KDRect* inputFrame,
                             KDRect* outputFrame);
+  LayoutCache::Layouts createLayouts(Calculation* calculation,
+                                     Poincare::Context* context,
+                                     bool canChangeDisplayOutput);
   void reloadScroll();
   void reloadOutputSelection(
       HistoryViewCellDataSource::SubviewType previousType);
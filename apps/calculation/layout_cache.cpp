@@ -0,0 +1,152 @@
+#include "layout_cache.h"
+
+#include <assert.h>
+#include <ion.h>
+#include <poincare/tree_pool.h>
+
+using namespace Poincare;
+
+namespace Calculation {
+
+LayoutCache::Key LayoutCache::KeyForCalculation(
+    Calculation* calculation, Context* context,
+    const Preferences* preferences) {
+  /* The texts and the trees of the calculation identify it, its memoized
+   * heights and equal sign do not alter its layouts. */
+  const char* texts = calculation->inputText();
+  size_t textsSize = reinterpret_cast<char*>(calculation->next()) - texts;
+  assert(preferences->numberOfSignificantDigits() < (1 << 4));
+  uint8_t preferencesKey =
+      preferences->numberOfSignificantDigits() |
+      static_cast<uint8_t>(preferences->displayMode()) << 4 |
+      static_cast<uint8_t>(preferences->combinatoricSymbols()) << 6 |
+      static_cast<uint8_t>(preferences->logarithmBasePosition()) << 7;
+  return Key{
+      texts, textsSize,
+      Ion::crc32Byte(reinterpret_cast<const uint8_t*>(texts), textsSize),
+      calculation->displayOutput(context), preferencesKey};
+}
+
+bool LayoutCache::layoutsForKey(Key key, Layouts* layouts) {
+  for (Entry& entry : m_entries) {
+    if (!entry.isEmpty() && entry.key == key) {
+      entry.lastUse = ++m_clock;
+      *layouts = entry.layouts;
+      m_numberOfHits++;
+      return true;
+    }
+  }
+  m_numberOfMisses++;
+  return false;
+}
+
+void LayoutCache::setLayoutsForKey(Key key, Layouts layouts) {
+  for (Entry& entry : m_entries) {
+    if (!entry.isEmpty() && entry.key == key) {
+      forgetEntry(&entry);
+    }
+  }
+  size_t size = SizeOfLayouts(layouts);
+  if (size > k_maxNumberOfBytes || key.textsSize > k_maxNumberOfTextBytes) {
+    return;
+  }
+  Entry* entry = nullptr;
+  while (m_numberOfBytes + size > k_maxNumberOfBytes ||
+         m_numberOfTextBytes + key.textsSize > k_maxNumberOfTextBytes ||
+         (entry = emptyEntry()) == nullptr) {
+    bool didForget = forgetLeastRecentlyUsedEntry();
+    assert(didForget);
+    (void)didForget;
+  }
+  char* texts = m_texts + m_numberOfTextBytes;
+  memcpy(texts, key.texts, key.textsSize);
+  m_numberOfTextBytes += key.textsSize;
+  entry->key = key;
+  entry->key.texts = texts;
+  entry->layouts = layouts;
+  entry->size = size;
+  entry->lastUse = ++m_clock;
+  m_numberOfBytes += size;
+}
+
+void LayoutCache::makeRoomInPool() {
+  /* Forgotten layouts only free the pool if no cell displays them, hence the
+   * loop. */
+  while (TreePool::sharedPool->freeSpace() < k_minimalFreeSpaceInPool &&
+         forgetLeastRecentlyUsedEntry()) {
+  }
+}
+
+void LayoutCache::reset() {
+  for (Entry& entry : m_entries) {
+    if (!entry.isEmpty()) {
+      forgetEntry(&entry);
+    }
+  }
+  assert(m_numberOfBytes == 0 && m_numberOfTextBytes == 0);
+}
+
+size_t LayoutCache::SizeOfLayouts(const Layouts& layouts) {
+  size_t size = 0;
+  if (!layouts.input.isUninitialized()) {
+    size += layouts.input.size();
+  }
+  if (!layouts.exactOutput.isUninitialized()) {
+    size += layouts.exactOutput.size();
+  }
+  // The approximate output is the exact output when only the latter is shown
+  if (!layouts.approximateOutput.isUninitialized() &&
+      layouts.approximateOutput.identifier() !=
+          layouts.exactOutput.identifier()) {
+    size += layouts.approximateOutput.size();
+  }
+  return size;
+}
+
+void LayoutCache::forgetEntry(Entry* entry) {
+  assert(!entry->isEmpty() && m_numberOfBytes >= entry->size);
+  m_numberOfBytes -= entry->size;
+  // Pack the texts set after those of the entry
+  const char* texts = entry->key.texts;
+  size_t textsSize = entry->key.textsSize;
+  char* textsEnd = m_texts + m_numberOfTextBytes;
+  assert(texts == nullptr ||
+         (texts >= m_texts && texts + textsSize <= textsEnd));
+  if (textsSize > 0) {
+    memmove(const_cast<char*>(texts), texts + textsSize,
+            textsEnd - texts - textsSize);
+    for (Entry& other : m_entries) {
+      if (!other.isEmpty() && other.key.texts > texts) {
+        other.key.texts -= textsSize;
+      }
+    }
+    m_numberOfTextBytes -= textsSize;
+  }
+  *entry = Entry();
+}
+
+bool LayoutCache::forgetLeastRecentlyUsedEntry() {
+  Entry* leastRecentlyUsed = nullptr;
+  for (Entry& entry : m_entries) {
+    if (!entry.isEmpty() && (leastRecentlyUsed == nullptr ||
+                             entry.lastUse < leastRecentlyUsed->lastUse)) {
+      leastRecentlyUsed = &entry;
+    }
+  }
+  if (leastRecentlyUsed == nullptr) {
+    return false;
+  }
+  forgetEntry(leastRecentlyUsed);
+  return true;
+}
+
+LayoutCache::Entry* LayoutCache::emptyEntry() {
+  for (Entry& entry : m_entries) {
+    if (entry.isEmpty()) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+
+}  // namespace Calculation
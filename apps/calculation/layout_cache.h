@@ -0,0 +1,113 @@
+#ifndef CALCULATION_LAYOUT_CACHE_H
+#define CALCULATION_LAYOUT_CACHE_H
+
+#include <poincare/layout.h>
+#include <poincare/preferences.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#include "calculation.h"
+
+namespace Calculation {
+
+/* LayoutCache keeps the layouts of the last displayed calculations, so that
+ * the history cells, which are reused while scrolling and emptied whenever the
+ * history is reloaded, do not create them again.
+ * Layouts are identified by the texts of the calculation, its display output
+ * and the preferences they were created with. The checksum of the texts only
+ * speeds up the lookups: the cache keeps a copy of the texts, so that two
+ * calculations with the same checksum are told apart. The least recently used
+ * layouts are forgotten when the cached layouts exceed k_maxNumberOfBytes, or
+ * their texts k_maxNumberOfTextBytes, or when the pool is running out of
+ * space. All are forgotten before computing a new
+ * calculation, when a layout cannot be created, when the history is cleared
+ * and when the app is left.
+ * As it retains handles, the cache must not be filled or emptied under a
+ * checkpoint which could be rolled back. */
+
+class LayoutCache {
+ public:
+  struct Key {
+    bool operator==(const Key& other) const {
+      return checksum == other.checksum &&
+             displayOutput == other.displayOutput &&
+             preferences == other.preferences &&
+             textsSize == other.textsSize &&
+             (textsSize == 0 || memcmp(texts, other.texts, textsSize) == 0);
+    }
+    /* The texts belong to the calculation, until the key is copied into the
+     * cache. */
+    const char* texts;
+    size_t textsSize;
+    uint32_t checksum;
+    Calculation::DisplayOutput displayOutput;
+    uint8_t preferences;
+  };
+
+  struct Layouts {
+    Poincare::Layout input;
+    Poincare::Layout exactOutput;
+    Poincare::Layout approximateOutput;
+  };
+
+  constexpr static int k_numberOfEntries = 16;
+  constexpr static size_t k_maxNumberOfBytes = 8192;
+  constexpr static size_t k_maxNumberOfTextBytes = 1024;
+  constexpr static size_t k_minimalFreeSpaceInPool = 8192;
+
+  static Key KeyForCalculation(Calculation* calculation,
+                               Poincare::Context* context,
+                               const Poincare::Preferences* preferences);
+
+  LayoutCache()
+      : m_numberOfBytes(0),
+        m_numberOfTextBytes(0),
+        m_clock(0),
+        m_numberOfHits(0),
+        m_numberOfMisses(0) {}
+
+  bool layoutsForKey(Key key, Layouts* layouts);
+  void setLayoutsForKey(Key key, Layouts layouts);
+  // Forget layouts until the pool has k_minimalFreeSpaceInPool bytes left
+  void makeRoomInPool();
+  void reset();
+
+  size_t numberOfBytes() const { return m_numberOfBytes; }
+  int numberOfHits() const { return m_numberOfHits; }
+  int numberOfMisses() const { return m_numberOfMisses; }
+  // Percentage of the lookups which found their layouts
+  int hitRate() const {
+    int numberOfLookups = m_numberOfHits + m_numberOfMisses;
+    return numberOfLookups == 0 ? 0 : 100 * m_numberOfHits / numberOfLookups;
+  }
+
+ private:
+  struct Entry {
+    // An entry is empty until it is set, and once it is forgotten
+    bool isEmpty() const { return lastUse == 0; }
+    Key key;
+    Layouts layouts;
+    size_t size = 0;
+    uint32_t lastUse = 0;
+  };
+
+  static size_t SizeOfLayouts(const Layouts& layouts);
+
+  void forgetEntry(Entry* entry);
+  bool forgetLeastRecentlyUsedEntry();
+  Entry* emptyEntry();
+
+  Entry m_entries[k_numberOfEntries];
+  // The texts of the keys, packed in the order they were set
+  char m_texts[k_maxNumberOfTextBytes];
+  size_t m_numberOfBytes;
+  size_t m_numberOfTextBytes;
+  uint32_t m_clock;
+  int m_numberOfHits;
+  int m_numberOfMisses;
+};
+
+}  // namespace Calculation
+
+#endif
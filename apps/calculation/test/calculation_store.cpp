@@ -136,6 +136,81 @@ QUIZ_CASE(calculation_store) {
               static_cast<int>(store.bufferSize()));
 }
 
+static int s_numberOfHeightComputations = 0;
+
+KDCoordinate countingHeight(::Calculation::Calculation *c, Context *context,
+                            bool expanded) {
+  s_numberOfHeightComputations++;
+  return Preferences::sharedPreferences->numberOfSignificantDigits() +
+         expanded;
+}
+
+QUIZ_CASE(calculation_memoized_heights) {
+  Shared::GlobalContext globalContext;
+  CalculationStore store(calculationBuffer, calculationBufferSize);
+  Preferences *preferences = Preferences::sharedPreferences;
+  uint8_t previousDigits = preferences->numberOfSignificantDigits();
+  preferences->setNumberOfSignificantDigits(5);
+  store.push("1+1", &globalContext, countingHeight);
+  store.push("2/3", &globalContext, countingHeight);
+  s_numberOfHeightComputations = 0;
+
+  /* Each calculation computes its height and expanded height the first time
+   * a set of preferences is met, and reuses them when it comes back. */
+  constexpr int k_numberOfSteps = 5;
+  const uint8_t digits[k_numberOfSteps] = {7, 5, 7, 9, 5};
+  const int computations[k_numberOfSteps] = {4, 4, 4, 8, 12};
+  for (int i = 0; i < k_numberOfSteps; i++) {
+    preferences->setNumberOfSignificantDigits(digits[i]);
+    store.recomputeHeightsIfPreferencesHaveChanged(preferences,
+                                                   countingHeight);
+    quiz_assert(s_numberOfHeightComputations == computations[i]);
+    for (int j = 0; j < store.numberOfCalculations(); j++) {
+      ::Calculation::Calculation *c = store.calculationAtIndex(j).pointer();
+      quiz_assert(c->height(false) == digits[i]);
+      quiz_assert(c->height(true) == digits[i] + 1);
+    }
+  }
+  preferences->setNumberOfSignificantDigits(previousDigits);
+  store.deleteAll();
+}
+
+QUIZ_CASE(calculation_store_drops_older_trees) {
+  Shared::GlobalContext globalContext;
+  CalculationStore store(calculationBuffer, calculationBufferSize);
+  constexpr int k_numberOfCalculations = 10;
+  for (int i = 0; i < k_numberOfCalculations; i++) {
+    store.push("1+2", &globalContext, dummyHeight);
+  }
+  quiz_assert(store.numberOfCalculations() == k_numberOfCalculations);
+  Expression input = Expression::Parse("1+2", nullptr);
+  int numberOfCalculationsWithTrees = 0;
+  for (int i = 0; i < k_numberOfCalculations; i++) {
+    ::Calculation::Calculation *c = store.calculationAtIndex(i).pointer();
+    size_t size =
+        reinterpret_cast<char *>(c->next()) - reinterpret_cast<char *>(c);
+    size_t textsSize =
+        sizeof(::Calculation::Calculation) + strlen(c->inputText()) + 1 +
+        strlen(c->exactOutputText()) + 1 +
+        strlen(c->approximateOutputText(NumberOfSignificantDigits::Maximal)) +
+        1 +
+        strlen(c->approximateOutputText(
+            NumberOfSignificantDigits::UserDefined)) +
+        1;
+    // Only the most recent calculations keep their trees
+    if (size > textsSize) {
+      quiz_assert(numberOfCalculationsWithTrees++ == i);
+    } else {
+      quiz_assert(size == textsSize);
+    }
+    // The expressions are rebuilt either way
+    quiz_assert(c->input().isIdenticalTo(input));
+  }
+  quiz_assert(numberOfCalculationsWithTrees > 0 &&
+              numberOfCalculationsWithTrees < k_numberOfCalculations);
+  store.deleteAll();
+}
+
 void assertAnsIs(const char *input, const char *expectedAnsInputText,
                  Context *context, CalculationStore *store) {
   store->push(input, context, dummyHeight);
@@ -197,6 +272,19 @@ QUIZ_CASE(calculation_ans) {
   store.deleteAll();
 }
 
+void assertTreesMatchTexts(::Calculation::Calculation *calculation) {
+  quiz_assert(calculation->input().isIdenticalTo(
+      Expression::Parse(calculation->inputText(), nullptr)));
+  quiz_assert(calculation->exactOutput().isIdenticalTo(
+      Expression::Parse(calculation->exactOutputText(), nullptr)));
+  NumberOfSignificantDigits digits[] = {NumberOfSignificantDigits::Maximal,
+                                        NumberOfSignificantDigits::UserDefined};
+  for (NumberOfSignificantDigits d : digits) {
+    quiz_assert(calculation->approximateOutput(d).isIdenticalTo(
+        Expression::Parse(calculation->approximateOutputText(d), nullptr)));
+  }
+}
+
 void assertCalculationIs(const char *input, DisplayOutput display,
                          EqualSign sign, const char *exactOutput,
                          const char *displayedApproximateOutput,
@@ -205,6 +293,7 @@ void assertCalculationIs(const char *input, DisplayOutput display,
   store->push(input, context, dummyHeight);
   Shared::ExpiringPointer<::Calculation::Calculation> lastCalculation =
       store->calculationAtIndex(0);
+  assertTreesMatchTexts(lastCalculation.pointer());
   quiz_assert(lastCalculation->displayOutput(context) == display);
   if (sign != EqualSign::Unknown && display != DisplayOutput::ApproximateOnly &&
       display != DisplayOutput::ExactOnly) {
@@ -0,0 +1,187 @@
+#include "../layout_cache.h"
+
+#include <apps/shared/global_context.h>
+#include <poincare/layout_helper.h>
+#include <poincare/preferences.h>
+#include <poincare/tree_pool.h>
+#include <quiz.h>
+#include <string.h>
+
+#include "../calculation_store.h"
+
+typedef ::Calculation::Calculation::DisplayOutput DisplayOutput;
+
+using namespace Poincare;
+using namespace Calculation;
+
+constexpr static int calculationBufferSize =
+    2 * (sizeof(::Calculation::Calculation) +
+         ::Calculation::Calculation::k_numberOfExpressions *
+             ::Constant::MaxSerializedExpressionSize +
+         sizeof(::Calculation::Calculation *));
+static char calculationBuffer[calculationBufferSize];
+
+static KDCoordinate dummyHeight(::Calculation::Calculation *c,
+                                Context *context, bool expanded) {
+  return 0;
+}
+
+static LayoutCache::Key keyForIndex(int i) {
+  return {nullptr, 0, static_cast<uint32_t>(i),
+          DisplayOutput::ExactAndApproximate, 0};
+}
+
+static LayoutCache::Layouts layoutsOfLength(int length) {
+  constexpr static int k_bufferSize = 4096;
+  char buffer[k_bufferSize];
+  assert(length < k_bufferSize);
+  memset(buffer, 'a', length);
+  buffer[length] = 0;
+  return {LayoutHelper::String(buffer), Layout(), Layout()};
+}
+
+QUIZ_CASE(calculation_layout_cache_key) {
+  Shared::GlobalContext globalContext;
+  CalculationStore store(calculationBuffer, calculationBufferSize);
+  store.push("1+2", &globalContext, dummyHeight);
+  store.push("3×4", &globalContext, dummyHeight);
+  ::Calculation::Calculation *first = store.calculationAtIndex(1).pointer();
+  ::Calculation::Calculation *second = store.calculationAtIndex(0).pointer();
+  Preferences *preferences = Preferences::sharedPreferences;
+
+  LayoutCache::Key key = LayoutCache::KeyForCalculation(first, &globalContext,
+                                                        preferences);
+  quiz_assert(key == LayoutCache::KeyForCalculation(first, &globalContext,
+                                                    preferences));
+  quiz_assert(!(key == LayoutCache::KeyForCalculation(second, &globalContext,
+                                                      preferences)));
+
+  // Display preferences and display output alter the layouts
+  Preferences displayPreferences = *preferences;
+  displayPreferences.setNumberOfSignificantDigits(
+      preferences->numberOfSignificantDigits() - 1);
+  quiz_assert(!(key == LayoutCache::KeyForCalculation(first, &globalContext,
+                                                      &displayPreferences)));
+  displayPreferences = *preferences;
+  displayPreferences.setDisplayMode(Preferences::PrintFloatMode::Scientific);
+  quiz_assert(!(key == LayoutCache::KeyForCalculation(first, &globalContext,
+                                                      &displayPreferences)));
+  first->forceDisplayOutput(key.displayOutput == DisplayOutput::ExactOnly
+                                ? DisplayOutput::ApproximateOnly
+                                : DisplayOutput::ExactOnly);
+  quiz_assert(!(key == LayoutCache::KeyForCalculation(first, &globalContext,
+                                                      preferences)));
+}
+
+QUIZ_CASE(calculation_layout_cache_checksum_collision) {
+  LayoutCache cache;
+  LayoutCache::Layouts layouts;
+  char texts[] = "1+2\0003\0003";
+  LayoutCache::Key key = keyForIndex(0);
+  key.texts = texts;
+  key.textsSize = sizeof(texts);
+  cache.setLayoutsForKey(key, layoutsOfLength(1));
+  // The cache keeps its own copy of the texts
+  texts[0] = '4';
+  quiz_assert(!cache.layoutsForKey(key, &layouts));
+  texts[0] = '1';
+  quiz_assert(cache.layoutsForKey(key, &layouts));
+
+  // Texts sharing a checksum are told apart
+  char otherTexts[] = "1+3\0004\0004";
+  LayoutCache::Key otherKey = key;
+  otherKey.texts = otherTexts;
+  quiz_assert(!cache.layoutsForKey(otherKey, &layouts));
+  cache.setLayoutsForKey(otherKey, layoutsOfLength(2));
+  quiz_assert(cache.layoutsForKey(key, &layouts));
+  quiz_assert(layouts.input.isIdenticalTo(layoutsOfLength(1).input));
+  quiz_assert(cache.layoutsForKey(otherKey, &layouts));
+  quiz_assert(layouts.input.isIdenticalTo(layoutsOfLength(2).input));
+
+  // Forgetting an entry packs the texts of the others
+  cache.setLayoutsForKey(key, layoutsOfLength(3));
+  quiz_assert(cache.layoutsForKey(otherKey, &layouts));
+  quiz_assert(layouts.input.isIdenticalTo(layoutsOfLength(2).input));
+  quiz_assert(cache.layoutsForKey(key, &layouts));
+  quiz_assert(layouts.input.isIdenticalTo(layoutsOfLength(3).input));
+
+  // Texts longer than the cache are not kept
+  char longTexts[LayoutCache::k_maxNumberOfTextBytes + 1] = {0};
+  LayoutCache::Key longKey = keyForIndex(1);
+  longKey.texts = longTexts;
+  longKey.textsSize = sizeof(longTexts);
+  cache.setLayoutsForKey(longKey, layoutsOfLength(1));
+  quiz_assert(!cache.layoutsForKey(longKey, &layouts));
+}
+
+QUIZ_CASE(calculation_layout_cache_least_recently_used) {
+  LayoutCache cache;
+  LayoutCache::Layouts layouts;
+  quiz_assert(!cache.layoutsForKey(keyForIndex(0), &layouts));
+  quiz_assert(cache.hitRate() == 0);
+
+  for (int i = 0; i < LayoutCache::k_numberOfEntries; i++) {
+    cache.setLayoutsForKey(keyForIndex(i), layoutsOfLength(i + 1));
+  }
+  quiz_assert(cache.layoutsForKey(keyForIndex(0), &layouts));
+  quiz_assert(layouts.input.isIdenticalTo(layoutsOfLength(1).input));
+  // The least recently used layouts are forgotten
+  cache.setLayoutsForKey(keyForIndex(LayoutCache::k_numberOfEntries),
+                         layoutsOfLength(1));
+  quiz_assert(!cache.layoutsForKey(keyForIndex(1), &layouts));
+  quiz_assert(cache.layoutsForKey(keyForIndex(0), &layouts));
+  quiz_assert(cache.layoutsForKey(
+      keyForIndex(LayoutCache::k_numberOfEntries), &layouts));
+  quiz_assert(cache.numberOfHits() == 3 && cache.numberOfMisses() == 2);
+  quiz_assert(cache.hitRate() == 60);
+
+  // Setting a key again replaces its layouts
+  cache.setLayoutsForKey(keyForIndex(0), layoutsOfLength(2));
+  quiz_assert(cache.layoutsForKey(keyForIndex(0), &layouts));
+  quiz_assert(layouts.input.isIdenticalTo(layoutsOfLength(2).input));
+
+  cache.reset();
+  quiz_assert(cache.numberOfBytes() == 0);
+  quiz_assert(!cache.layoutsForKey(keyForIndex(0), &layouts));
+}
+
+QUIZ_CASE(calculation_layout_cache_size) {
+  LayoutCache cache;
+  LayoutCache::Layouts layouts;
+  constexpr int k_length = 3000;
+  size_t size = layoutsOfLength(k_length).input.size();
+  assert(2 * size <= LayoutCache::k_maxNumberOfBytes &&
+         3 * size > LayoutCache::k_maxNumberOfBytes);
+
+  for (int i = 0; i < 3; i++) {
+    cache.setLayoutsForKey(keyForIndex(i), layoutsOfLength(k_length));
+    quiz_assert(cache.numberOfBytes() <= LayoutCache::k_maxNumberOfBytes);
+  }
+  quiz_assert(cache.numberOfBytes() == 2 * size);
+  quiz_assert(!cache.layoutsForKey(keyForIndex(0), &layouts));
+  quiz_assert(cache.layoutsForKey(keyForIndex(2), &layouts));
+
+  // Layouts larger than the cache are not kept
+  cache.setLayoutsForKey(keyForIndex(3), {layoutsOfLength(k_length).input,
+                                          layoutsOfLength(k_length).input,
+                                          layoutsOfLength(k_length).input});
+  quiz_assert(!cache.layoutsForKey(keyForIndex(3), &layouts));
+
+  // A layout displayed as both outputs is only counted once
+  cache.reset();
+  Layout output = layoutsOfLength(k_length).input;
+  cache.setLayoutsForKey(keyForIndex(0), {Layout(), output, output});
+  quiz_assert(cache.numberOfBytes() == size);
+}
+
+QUIZ_CASE(calculation_layout_cache_reset_frees_pool) {
+  LayoutCache cache;
+  size_t freeSpace = TreePool::sharedPool->freeSpace();
+  for (int i = 0; i < LayoutCache::k_numberOfEntries / 2; i++) {
+    cache.setLayoutsForKey(keyForIndex(i), layoutsOfLength(100));
+  }
+  // The cache retains the only handles to its layouts
+  quiz_assert(TreePool::sharedPool->freeSpace() < freeSpace);
+  cache.reset();
+  quiz_assert(TreePool::sharedPool->freeSpace() == freeSpace);
+}
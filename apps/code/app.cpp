@@ -127,12 +127,14 @@ void App::initPythonWithUser(const void *pythonUser) {
 
     char *heap = pythonHeap();
     MicroPython::init(heap, heap + k_pythonHeapSize);
+    MicroPython::registerScriptCache(&m_scriptCache);
   }
   m_pythonUser = pythonUser;
 }
 
 void App::deinitPython() {
   if (m_pythonUser) {
+    MicroPython::registerScriptCache(nullptr);
     MicroPython::deinit();
     m_pythonUser = nullptr;
     /* Re-construct the tree pool, which might have been ovewritten by the heap.
@@ -88,6 +88,9 @@ class App : public Shared::InputEventHandlerDelegateApp {
   Escher::StackViewController m_codeStackViewController;
   PythonToolbox m_toolbox;
   VariableBoxController m_variableBoxController;
+  /* Compiled imported scripts are kept while the app is open, so that running
+   * the console again does not recompile unchanged scripts. */
+  MicroPython::ScriptCache m_scriptCache;
 #if PLATFORM_DEVICE
   /* On the device, we reach 64K of heap by repurposing the unused tree pool.
    * The linker must make sure that the pool and the apps buffer are
@@ -9,7 +9,7 @@ using namespace Escher;
 
 namespace Code {
 
-int Clipboard::s_replacementRuleStartingPoint = 0;
+OMG_INSTANCE_LOCAL int Clipboard::s_replacementRuleStartingPoint = 0;
 
 Clipboard *Clipboard::sharedClipboard() {
   assert(sizeof(Clipboard) == sizeof(Escher::Clipboard));
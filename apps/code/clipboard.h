@@ -3,6 +3,7 @@
 
 #include <escher/clipboard.h>
 #include <ion/unicode/utf8_helper.h>
+#include <omg/instance_local.h>
 
 namespace Code {
 
@@ -18,7 +19,7 @@ class Clipboard : public Escher::Clipboard {
   void exitPython() { replaceCharForPython(false); }
 
  private:
-  static int s_replacementRuleStartingPoint;
+  static OMG_INSTANCE_LOCAL int s_replacementRuleStartingPoint;
   void replaceCharForPython(bool entersPythonApp);
 };
 
@@ -47,6 +47,9 @@ class ScriptStore : public MicroPython::ScriptProvider {
 
   /* MicroPython::ScriptProvider */
   const char* contentOfScript(const char* name, bool markAsFetched) override;
+  bool hasScript(const char* name) override {
+    return !ScriptNamed(name).isNull();
+  }
   void clearVariableBoxFetchInformation();
   void clearConsoleFetchInformation();
 
@@ -0,0 +1,127 @@
+#include "engine.h"
+
+#include <escher/init.h>
+#include <ion.h>
+#include <ion/persisting_bytes.h>
+#include <ion/src/shared/init.h>
+#include <ion/src/simulator/shared/framebuffer.h>
+#include <ion/src/simulator/shared/journal.h>
+#include <omg/global_box.h>
+#include <omg/instance_local.h>
+#include <poincare/init.h>
+
+#include "apps_container.h"
+#include "init.h"
+
+struct epsilon_engine {
+  bool isTerminated = false;
+};
+
+static OMG_INSTANCE_LOCAL OMG::TrackedGlobalBox<epsilon_engine> sharedEngine;
+
+static void start(epsilon_engine* engine) {
+  // The exam mode is the only state persisting across sessions
+  Ion::PersistingBytes::write(0);
+  Ion::Init();
+  Poincare::Init();
+  Escher::Init();
+  Apps::Init();
+  Ion::Simulator::Framebuffer::setActive(true);
+  AppsContainer::sharedAppsContainer()->start();
+  engine->isTerminated = false;
+  // Open the initial app, so that the framebuffer is drawn from the start
+  epsilon_step(engine, 0);
+}
+
+static void stop() {
+  AppsContainer::sharedAppsContainer()->stop();
+  Apps::Shutdown();
+  Escher::Shutdown();
+  Poincare::Shutdown();
+  Ion::Shutdown();
+  Ion::Events::Journal* journal = Ion::Simulator::Journal::replayJournal();
+  while (!journal->isEmpty()) {
+    journal->popEvent();
+  }
+}
+
+epsilon_engine* epsilon_create() {
+  if (sharedEngine.isInitialized()) {
+    return nullptr;
+  }
+  sharedEngine.init();
+  start(sharedEngine);
+  return sharedEngine;
+}
+
+void epsilon_destroy(epsilon_engine* engine) {
+  assert(engine == sharedEngine.get());
+  stop();
+  sharedEngine.deinit();
+}
+
+void epsilon_reset(epsilon_engine* engine) {
+  assert(engine == sharedEngine.get());
+  stop();
+  start(engine);
+}
+
+bool epsilon_push_event(epsilon_engine* engine, uint8_t event) {
+  assert(engine == sharedEngine.get());
+  Ion::Events::Event e(event);
+  if (!Ion::Events::isDefined(event) || e == Ion::Events::None) {
+    return false;
+  }
+  Ion::Events::Journal* journal = Ion::Simulator::Journal::replayJournal();
+  journal->pushEvent(e);
+  // The journal is detached from the events once it has been emptied
+  Ion::Events::replayFrom(journal);
+  return true;
+}
+
+struct StepBudget {
+  uint64_t deadline;
+};
+
+static bool CanStep(void* ctx) {
+  /* Headless events stop at the end of the replay journal, so it must never
+   * be fetched from once empty. */
+  return !Ion::Simulator::Journal::replayJournal()->isEmpty() &&
+         Ion::Timing::millis() < static_cast<StepBudget*>(ctx)->deadline;
+}
+
+bool epsilon_step(epsilon_engine* engine, uint32_t budget_ms) {
+  assert(engine == sharedEngine.get());
+  if (engine->isTerminated) {
+    return false;
+  }
+  /* The stack start is set for each step, since the host may call the engine
+   * from anywhere. MicroPython's garbage collector scans the stack from there.
+   */
+  volatile int stackTop;
+  Ion::setStackStart((void*)(&stackTop));
+  StepBudget budget = {Ion::Timing::millis() + budget_ms};
+  engine->isTerminated =
+      !AppsContainer::sharedAppsContainer()->runStepsWhile(CanStep, &budget);
+  return !engine->isTerminated;
+}
+
+const uint16_t* epsilon_framebuffer(epsilon_engine* engine) {
+  assert(engine == sharedEngine.get());
+  static_assert(sizeof(KDColor) == sizeof(uint16_t),
+                "KDColor should be a plain RGB565 value");
+  return reinterpret_cast<const uint16_t*>(
+      Ion::Simulator::Framebuffer::address());
+}
+
+size_t epsilon_storage_export(epsilon_engine* engine, void* buffer,
+                              size_t size) {
+  assert(engine == sharedEngine.get());
+  Ion::Storage::FileSystem* fileSystem =
+      Ion::Storage::FileSystem::sharedFileSystem;
+  size_t sizeOfRecords = fileSystem->sizeOfRecords();
+  if (buffer != nullptr && sizeOfRecords <= size) {
+    memcpy(buffer, fileSystem->records(), sizeOfRecords);
+  }
+  return sizeOfRecords;
+}
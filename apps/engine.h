@@ -0,0 +1,51 @@
+#ifndef APPS_ENGINE_H
+#define APPS_ENGINE_H
+
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+
+/* The engine embeds a headless Epsilon into a host program. Unlike ion_main,
+ * which runs until the Termination event, the engine only processes events
+ * when it is stepped, so that the host keeps control of its main loop.
+ * Epsilon keeps its state in global variables, which are local to each thread
+ * (see omg/instance_local.h): a thread can drive a single engine at a time, and
+ * its sessions run one after the other through epsilon_reset. Engines of
+ * different threads run concurrently.
+ * Nested run loops, such as a Python script waiting for an event, are not
+ * interrupted by the step budget. If they run out of events, the engine
+ * terminates. */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct epsilon_engine epsilon_engine;
+
+// Return NULL if an engine already exists in the calling thread
+epsilon_engine* epsilon_create(void);
+void epsilon_destroy(epsilon_engine* engine);
+// Start a new session, with empty storage and default preferences
+void epsilon_reset(epsilon_engine* engine);
+
+/* Queue an Ion::Events::Event, to be processed by the next steps. Return false
+ * if the event is not defined. */
+bool epsilon_push_event(epsilon_engine* engine, uint8_t event);
+/* Process the queued events until there are none left or budget_ms
+ * milliseconds have elapsed. An event is never interrupted, so a step can
+ * exceed its budget by the duration of one event. Return false once the
+ * engine has terminated. */
+bool epsilon_step(epsilon_engine* engine, uint32_t budget_ms);
+
+// 320x240 RGB565 pixels, row by row
+const uint16_t* epsilon_framebuffer(epsilon_engine* engine);
+/* Copy the storage records into buffer if it is large enough, and return their
+ * size. Records are laid out as in Ion::Storage::FileSystem. */
+size_t epsilon_storage_export(epsilon_engine* engine, void* buffer,
+                              size_t size);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
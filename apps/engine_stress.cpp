@@ -0,0 +1,93 @@
+#include <ion/src/shared/events_benchmark.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <chrono>
+#include <thread>
+
+#include "engine.h"
+
+/* Each thread drives its own engine through the scenarios of the events
+ * benchmark. The frames drawn by concurrent engines must be identical to those
+ * drawn by a single engine, which would not be the case if the engines shared
+ * any state. */
+
+using Ion::Events::Scenario;
+
+constexpr static int k_numberOfThreads = 16;
+constexpr static int k_numberOfPixels = 320 * 240;
+constexpr static uint64_t k_hashOffset = 0xcbf29ce484222325;
+constexpr static uint64_t k_hashPrime = 0x100000001b3;
+
+struct Run {
+  // FNV-1a hash of the framebuffer after each event
+  uint64_t hash = k_hashOffset;
+  bool hasTerminated = false;
+};
+
+static void hashFramebuffer(const uint16_t* pixels, uint64_t* hash) {
+  for (int i = 0; i < k_numberOfPixels; i++) {
+    *hash = (*hash ^ (pixels[i] & 0xFF)) * k_hashPrime;
+    *hash = (*hash ^ (pixels[i] >> 8)) * k_hashPrime;
+  }
+}
+
+static void runScenarios(Run* run) {
+  epsilon_engine* engine = epsilon_create();
+  if (engine == nullptr) {
+    run->hasTerminated = true;
+    return;
+  }
+  for (const Scenario& scenario : Ion::Events::scenarios) {
+    epsilon_reset(engine);
+    for (int i = 0; i < scenario.numberOfEvents(); i++) {
+      epsilon_push_event(engine,
+                         static_cast<uint8_t>(scenario.eventAtIndex(i)));
+      if (!epsilon_step(engine, UINT32_MAX)) {
+        run->hasTerminated = true;
+        epsilon_destroy(engine);
+        return;
+      }
+      hashFramebuffer(epsilon_framebuffer(engine), &run->hash);
+    }
+  }
+  epsilon_destroy(engine);
+}
+
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+  std::chrono::duration<double> duration =
+      std::chrono::steady_clock::now() - start;
+  return duration.count();
+}
+
+int main() {
+  auto start = std::chrono::steady_clock::now();
+  Run reference;
+  runScenarios(&reference);
+  if (reference.hasTerminated) {
+    fprintf(stderr, "The reference engine terminated early\n");
+    return 1;
+  }
+  printf("1 engine: %.3f s\n", secondsSince(start));
+
+  start = std::chrono::steady_clock::now();
+  Run runs[k_numberOfThreads];
+  std::thread threads[k_numberOfThreads];
+  for (int i = 0; i < k_numberOfThreads; i++) {
+    threads[i] = std::thread(runScenarios, &runs[i]);
+  }
+  for (std::thread& thread : threads) {
+    thread.join();
+  }
+  printf("%d concurrent engines: %.3f s\n", k_numberOfThreads,
+         secondsSince(start));
+
+  int numberOfFailures = 0;
+  for (int i = 0; i < k_numberOfThreads; i++) {
+    if (runs[i].hasTerminated || runs[i].hash != reference.hash) {
+      fprintf(stderr, "Engine %d drew different frames\n", i);
+      numberOfFailures++;
+    }
+  }
+  return numberOfFailures == 0 ? 0 : 1;
+}
@@ -0,0 +1,81 @@
+#include <ion.h>
+#include <ion/src/simulator/shared/framebuffer.h>
+#include <ion/src/simulator/shared/fuzzer.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+/* Inputs run back to back in a single process, as when fuzzing. An input
+ * replayed after others must draw the same frame as when it ran first, which
+ * would not be the case if the GlobalBoxes did not reset the state between
+ * inputs. An input whose header cannot be loaded must be skipped. */
+
+using Ion::Events::Event;
+using Ion::Simulator::Fuzzer::runInput;
+
+constexpr static int k_numberOfPixels = 320 * 240;
+constexpr static uint64_t k_hashOffset = 0xcbf29ce484222325;
+constexpr static uint64_t k_hashPrime = 0x100000001b3;
+
+static std::vector<uint8_t> eventBytes(std::initializer_list<Event> events) {
+  std::vector<uint8_t> bytes;
+  for (Event e : events) {
+    bytes.push_back(static_cast<uint8_t>(e));
+  }
+  return bytes;
+}
+
+static bool run(const std::vector<uint8_t>& input, uint64_t* hash) {
+  if (!runInput(input.data(), input.size())) {
+    return false;
+  }
+  // FNV-1a hash of the last frame
+  const uint16_t* pixels = reinterpret_cast<const uint16_t*>(
+      Ion::Simulator::Framebuffer::address());
+  *hash = k_hashOffset;
+  for (int i = 0; i < k_numberOfPixels; i++) {
+    *hash = (*hash ^ (pixels[i] & 0xFF)) * k_hashPrime;
+    *hash = (*hash ^ (pixels[i] >> 8)) * k_hashPrime;
+  }
+  return true;
+}
+
+int main() {
+  Ion::Simulator::Framebuffer::setActive(true);
+  // Compute 1+2 in the calculation app, which stores it in the history
+  std::vector<uint8_t> calculation =
+      eventBytes({Ion::Events::OK, Ion::Events::One, Ion::Events::Plus,
+                  Ion::Events::Two, Ion::Events::EXE});
+  // Plot a function in the grapher app, which changes its range
+  std::vector<uint8_t> grapher = eventBytes(
+      {Ion::Events::Right, Ion::Events::OK, Ion::Events::OK, Ion::Events::XNT,
+       Ion::Events::Square, Ion::Events::EXE, Ion::Events::Back,
+       Ion::Events::Right, Ion::Events::Right, Ion::Events::OK});
+  const char* truncatedHeader = "NWSF00.00.00";
+  std::vector<uint8_t> malformed(truncatedHeader,
+                                 truncatedHeader + strlen(truncatedHeader));
+  malformed.push_back(static_cast<uint8_t>(Ion::Events::OK));
+
+  uint64_t firstHash, firstGrapherHash, grapherHash, hash;
+  if (!run(calculation, &firstHash) || !run(grapher, &firstGrapherHash) ||
+      !run(calculation, &hash) || !run(grapher, &grapherHash)) {
+    fprintf(stderr, "A well-formed input was skipped\n");
+    return 1;
+  }
+  if (hash != firstHash || grapherHash != firstGrapherHash) {
+    fprintf(stderr, "The state leaked from one input to the next\n");
+    return 1;
+  }
+  if (run(malformed, &hash)) {
+    fprintf(stderr, "A malformed input was run\n");
+    return 1;
+  }
+  if (!run(calculation, &hash) || hash != firstHash) {
+    fprintf(stderr, "A malformed input altered the next one\n");
+    return 1;
+  }
+  printf("The inputs ran independently of each other\n");
+  return 0;
+}
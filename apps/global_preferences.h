@@ -5,13 +5,15 @@
 #include <ion.h>
 #include <kandinsky/font.h>
 #include <omg/global_box.h>
+#include <omg/instance_local.h>
 #include <poincare/preferences.h>
 
 class GlobalPreferences {
   friend OMG::GlobalBox<GlobalPreferences>;
 
  public:
-  static OMG::GlobalBox<GlobalPreferences> sharedGlobalPreferences;
+  static OMG_INSTANCE_LOCAL OMG::GlobalBox<GlobalPreferences>
+      sharedGlobalPreferences;
   I18n::Language language() const { return m_language; }
   void setLanguage(I18n::Language language) { m_language = language; }
   I18n::Country country() const { return m_country; }
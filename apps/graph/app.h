@@ -3,6 +3,7 @@
 
 #include <apps/apps_container_helper.h>
 #include <apps/shared/continuous_function.h>
+#include <apps/shared/continuous_function_caches.h>
 #include <apps/shared/continuous_function_store.h>
 #include <apps/shared/function_app.h>
 #include <apps/shared/interval.h>
@@ -76,6 +77,9 @@ class App : public Shared::FunctionApp {
     return &m_functionParameterController;
   }
   FunctionToolbox *functionToolbox() { return &m_functionToolbox; }
+  Shared::ContinuousFunctionCaches *continuousFunctionCaches() {
+    return &m_continuousFunctionCaches;
+  }
 
  private:
   App(Snapshot *snapshot);
@@ -97,6 +101,7 @@ class App : public Shared::FunctionApp {
   FunctionParameterController m_functionParameterController;
   FunctionToolbox m_functionToolbox;
   Escher::TabUnion<ListTab, GraphTab, ValuesTab> m_tabs;
+  Shared::ContinuousFunctionCaches m_continuousFunctionCaches;
 };
 
 }  // namespace Graph
@@ -54,6 +54,7 @@ void GraphView::drawRecord(Ion::Storage::Record record, int index,
                            bool firstDrawnRecord) const {
   if (firstDrawnRecord) {
     m_areaIndex = 0;
+    App::app()->continuousFunctionCaches()->willStartDrawing();
   }
 
   ExpiringPointer<ContinuousFunction> f =
@@ -81,7 +82,8 @@ void GraphView::drawRecord(Ion::Storage::Record record, int index,
     }
   }
 
-  ContinuousFunctionCache *cch = functionStore()->cacheAtIndex(index);
+  ContinuousFunctionCache *cch =
+      App::app()->continuousFunctionCaches()->cacheForFunction(f.operator->());
   float tmin = f->tMin();
   float tmax = f->tMax();
   Axis axis = f->isAlongY() ? Axis::Vertical : Axis::Horizontal;
@@ -176,6 +178,13 @@ bool GraphView::FunctionIsDiscontinuousBetweenFloatValues(float x1, float x2,
           x1, x2, static_cast<Poincare::Context *>(context));
 }
 
+template <int CurveIndex>
+Poincare::Interval<float> GraphView::FunctionEnclosureBetweenFloatValues(
+    float x1, float x2, void *model, void *context) {
+  return static_cast<ContinuousFunction *>(model)->enclosureBetweenParameters(
+      x1, x2, static_cast<Poincare::Context *>(context), CurveIndex);
+}
+
 void GraphView::drawCartesian(KDContext *ctx, KDRect rect,
                               ContinuousFunction *f,
                               Ion::Storage::Record record, float tStart,
@@ -246,6 +255,7 @@ void GraphView::drawCartesian(KDContext *ctx, KDRect rect,
                           tEnd, tStep, f->color(), true,
                           f->properties().plotIsDotted());
   firstCurve.setPrecisionOptions(true, evaluateXY<double>, discontinuity);
+  firstCurve.setOrdinatesEnclosure(FunctionEnclosureBetweenFloatValues<0>);
   firstCurve.setPatternOptions(pattern, patternStart, patternEnd, patternLower,
                                patternUpper, patternWithoutCurve, axis);
   firstCurve.draw(this, ctx, rect);
@@ -257,6 +267,7 @@ void GraphView::drawCartesian(KDContext *ctx, KDRect rect,
                              f->properties().plotIsDotted());
     secondCurve.setPrecisionOptions(true, evaluateXYSecondCurve<double>,
                                     discontinuity);
+    secondCurve.setOrdinatesEnclosure(FunctionEnclosureBetweenFloatValues<1>);
     secondCurve.setPatternOptions(pattern, patternStart, patternEnd,
                                   patternLower2, Curve2D(), patternWithoutCurve,
                                   axis);
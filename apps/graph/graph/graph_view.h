@@ -49,6 +49,9 @@ class GraphView : public Shared::FunctionGraphView,
   static bool FunctionIsDiscontinuousBetweenFloatValues(float x1, float x2,
                                                         void *model,
                                                         void *context);
+  template <int CurveIndex>
+  static Poincare::Interval<float> FunctionEnclosureBetweenFloatValues(
+      float x1, float x2, void *model, void *context);
   Escher::View *ornamentView() const override {
     return const_cast<InterestView *>(&m_interestView);
   }
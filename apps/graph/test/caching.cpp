@@ -1,3 +1,4 @@
+#include <apps/shared/continuous_function_caches.h>
 #include <apps/shared/global_context.h>
 #include <quiz.h>
 
@@ -26,8 +27,9 @@ void assert_check_cartesian_cache_against_function(
   function->setCache(nullptr);
 
   float t;
-  for (int i = 0; i < Ion::Display::Width; i++) {
-    t = tMin + i * cache->step();
+  // Check the steps and the refinement dots halfway between them
+  for (int i = 0; i < 2 * Ion::Display::Width - 1; i++) {
+    t = tMin + (0.5f * i) * cache->step();
     Coordinate2D<float> cacheValues =
         cache->valueForParameter(function, context, t, 0);
     Coordinate2D<float> functionValues =
@@ -44,8 +46,8 @@ void assert_check_cartesian_cache_against_function(
 void assert_cartesian_cache_stays_valid_while_panning(
     ContinuousFunction* function, Context* context,
     InteractiveCurveViewRange* range, CurveViewCursor* cursor,
-    ContinuousFunctionStore* store, float step) {
-  ContinuousFunctionCache* cache = store->cacheAtIndex(0);
+    ContinuousFunctionCaches* caches, float step) {
+  ContinuousFunctionCache* cache = caches->cacheForFunction(function);
   assert(cache);
 
   float tMin, tStep;
@@ -66,11 +68,10 @@ void assert_cartesian_cache_stays_valid_while_panning(
   }
 }
 
-void assert_check_polar_cache_against_function(ContinuousFunction* function,
-                                               Context* context,
-                                               InteractiveCurveViewRange* range,
-                                               ContinuousFunctionStore* store) {
-  ContinuousFunctionCache* cache = store->cacheAtIndex(0);
+void assert_check_polar_cache_against_function(
+    ContinuousFunction* function, Context* context,
+    InteractiveCurveViewRange* range, ContinuousFunctionCaches* caches) {
+  ContinuousFunctionCache* cache = caches->cacheForFunction(function);
   assert(cache);
 
   float tMin = range->xMin();
@@ -82,16 +83,16 @@ void assert_check_polar_cache_against_function(ContinuousFunction* function,
 
   ContinuousFunctionCache::PrepareForCaching(function, cache, tMin, tCacheStep);
 
-  // Fill the cache
+  // Fill the cache, with the refinement dots halfway between the steps
   float t;
-  for (int i = 0; i < Ion::Display::Width / 2; i++) {
-    t = tMin + i * cache->step();
+  for (int i = 0; i < Ion::Display::Width - 1; i++) {
+    t = tMin + (0.5f * i) * cache->step();
     function->evaluateXYAtParameter(t, context);
   }
 
   function->setCache(nullptr);
-  for (int i = 0; i < Ion::Display::Width / 2; i++) {
-    t = tMin + i * cache->step();
+  for (int i = 0; i < Ion::Display::Width - 1; i++) {
+    t = tMin + (0.5f * i) * cache->step();
     Coordinate2D<float> cacheValues =
         cache->valueForParameter(function, context, t, 0);
     Coordinate2D<float> functionValues =
@@ -113,6 +114,7 @@ void assert_cache_stays_valid(const char* definition, float rangeXMin = -5,
   graphRange.setYMax(3.f);
 
   CurveViewCursor cursor;
+  ContinuousFunctionCaches caches;
   ContinuousFunction* function =
       addFunction(definition, &functionStore, &globalContext);
   Coordinate2D<float> origin =
@@ -121,13 +123,13 @@ void assert_cache_stays_valid(const char* definition, float rangeXMin = -5,
 
   if (function->properties().isCartesian()) {
     assert_cartesian_cache_stays_valid_while_panning(
-        function, &globalContext, &graphRange, &cursor, &functionStore, 2.f);
+        function, &globalContext, &graphRange, &cursor, &caches, 2.f);
     assert_cartesian_cache_stays_valid_while_panning(
-        function, &globalContext, &graphRange, &cursor, &functionStore, -0.4f);
+        function, &globalContext, &graphRange, &cursor, &caches, -0.4f);
   } else {
     assert(function->properties().isPolar());
     assert_check_polar_cache_against_function(function, &globalContext,
-                                              &graphRange, &functionStore);
+                                              &graphRange, &caches);
   }
 
   functionStore.removeAll();
@@ -156,4 +158,43 @@ QUIZ_CASE(graph_caching) {
   Preferences::sharedPreferences->setAngleUnit(previousAngleUnit);
 }
 
+QUIZ_CASE(graph_caches_lending) {
+  constexpr int numberOfFunctions =
+      ContinuousFunctionCaches::k_numberOfCaches + 1;
+  ContinuousFunction functions[numberOfFunctions];
+  ContinuousFunctionCache* lentCaches[numberOfFunctions];
+  {
+    ContinuousFunctionCaches caches;
+    caches.willStartDrawing();
+    for (int i = 0; i < numberOfFunctions; i++) {
+      lentCaches[i] = caches.cacheForFunction(&functions[i]);
+      functions[i].setCache(lentCaches[i]);
+    }
+    // Curves drawn together do not take the caches of each other
+    quiz_assert(lentCaches[numberOfFunctions - 1] == nullptr);
+
+    // Curves keep their caches from one drawing to the next
+    caches.willStartDrawing();
+    for (int i = 0; i < numberOfFunctions; i++) {
+      quiz_assert(caches.cacheForFunction(&functions[i]) == lentCaches[i]);
+    }
+
+    // The least recently drawn curve loses its cache
+    caches.willStartDrawing();
+    for (int i = 1; i < numberOfFunctions; i++) {
+      caches.cacheForFunction(&functions[i]);
+    }
+    caches.willStartDrawing();
+    ContinuousFunctionCache* cache =
+        caches.cacheForFunction(&functions[numberOfFunctions - 1]);
+    quiz_assert(cache == lentCaches[0]);
+    quiz_assert(functions[0].cache() == nullptr);
+    functions[numberOfFunctions - 1].setCache(cache);
+  }
+  // Functions do not point to destroyed caches
+  for (int i = 0; i < numberOfFunctions; i++) {
+    quiz_assert(functions[i].cache() == nullptr);
+  }
+}
+
 }  // namespace Graph
@@ -371,48 +371,86 @@ void ValuesController::setStartEndMessages(
 }
 
 void ValuesController::createMemoizedLayout(int column, int row, int index) {
+  Poincare::Context *context = textFieldDelegateApp()->localContext();
+  *memoizedLayoutAtIndex(index) = valueAtLocation(column, row).createLayout(
+      Preferences::PrintFloatMode::Decimal,
+      Preferences::VeryLargeNumberOfSignificantDigits, context);
+}
+
+void ValuesController::prefetchValueAtLocation(int column, int row) {
+  bool isDerivative = false;
+  Ion::Storage::Record record = recordAtColumn(column, &isDerivative);
+  if (!isDerivative) {
+    if (m_exactValuesAreActivated) {
+      // Exact results are not cached
+      return;
+    }
+    /* Neither are the points of parametric functions and the lists, so that
+     * computing them in advance would be wasted. */
+    Expression reduced =
+        functionStore()->modelForRecord(record)->expressionReduced(
+            textFieldDelegateApp()->localContext());
+    if (reduced.isOfType({ExpressionNode::Type::Point,
+                          ExpressionNode::Type::List,
+                          ExpressionNode::Type::Matrix})) {
+      return;
+    }
+  }
+  valueAtLocation(column, row);
+}
+
+Expression ValuesController::valueAtLocation(int column, int row) {
   double abscissa;
   bool isDerivative = false;
   Shared::ExpiringPointer<ContinuousFunction> function =
       functionAtIndex(column, row, &abscissa, &isDerivative);
+  double value;
+  if ((isDerivative || !m_exactValuesAreActivated) &&
+      approximateValueIsCached(column, row, &value)) {
+    return Float<double>::Builder(value);
+  }
   Poincare::Context *context = textFieldDelegateApp()->localContext();
   Expression result;
   if (isDerivative) {
     // Compute derivative approximate result
-    result = Float<double>::Builder(
-        function->approximateDerivative(abscissa, context, 0, false));
-  } else {
-    // Compute exact result
-    result = function->expressionReduced(context);
-    Poincare::VariableContext abscissaContext =
-        Poincare::VariableContext(Shared::Function::k_unknownName, context);
-    Poincare::Expression abscissaExpression =
-        Poincare::Decimal::Builder<double>(abscissa);
-    abscissaContext.setExpressionForSymbolAbstract(
-        abscissaExpression,
-        Symbol::Builder(Shared::Function::k_unknownName,
-                        strlen(Shared::Function::k_unknownName)));
-    bool simplificationFailure = false;
-    PoincareHelpers::CloneAndSimplify(
-        &result, &abscissaContext, Poincare::ReductionTarget::User,
-        Poincare::SymbolicComputation::
-            ReplaceAllSymbolsWithDefinitionsOrUndefined,
-        Poincare::UnitConversion::Default,
-        Poincare::Preferences::sharedPreferences, true, &simplificationFailure);
-    /* Approximate in case of simplification failure, as we cannot display a
-     * non-beautified expression. */
-    Expression approximation =
-        PoincareHelpers::Approximate<double>(result, context);
-    if (simplificationFailure || !m_exactValuesAreActivated ||
-        ExpressionDisplayPermissions::ShouldOnlyDisplayApproximation(
-            function->originalEquation(), result, approximation, context)) {
-      // Do not show exact expressions in certain cases, use approximate result
-      result = approximation;
-    }
+    value = function->approximateDerivative(abscissa, context, 0, false);
+    cacheApproximateValue(column, row, value);
+    return Float<double>::Builder(value);
   }
-  *memoizedLayoutAtIndex(index) = result.createLayout(
-      Preferences::PrintFloatMode::Decimal,
-      Preferences::VeryLargeNumberOfSignificantDigits, context);
+  // Compute exact result
+  result = function->expressionReduced(context);
+  Poincare::VariableContext abscissaContext =
+      Poincare::VariableContext(Shared::Function::k_unknownName, context);
+  Poincare::Expression abscissaExpression =
+      Poincare::Decimal::Builder<double>(abscissa);
+  abscissaContext.setExpressionForSymbolAbstract(
+      abscissaExpression,
+      Symbol::Builder(Shared::Function::k_unknownName,
+                      strlen(Shared::Function::k_unknownName)));
+  bool simplificationFailure = false;
+  PoincareHelpers::CloneAndSimplify(
+      &result, &abscissaContext, Poincare::ReductionTarget::User,
+      Poincare::SymbolicComputation::ReplaceAllSymbolsWithDefinitionsOrUndefined,
+      Poincare::UnitConversion::Default,
+      Poincare::Preferences::sharedPreferences, true, &simplificationFailure);
+  /* Approximate in case of simplification failure, as we cannot display a
+   * non-beautified expression. */
+  Expression approximation =
+      PoincareHelpers::Approximate<double>(result, context);
+  if (!m_exactValuesAreActivated &&
+      approximation.type() == ExpressionNode::Type::Float) {
+    /* Only scalar approximations are cached: points and lists cannot be
+     * rebuilt from a double. */
+    cacheApproximateValue(column, row,
+                          static_cast<Float<double> &>(approximation).value());
+  }
+  if (simplificationFailure || !m_exactValuesAreActivated ||
+      ExpressionDisplayPermissions::ShouldOnlyDisplayApproximation(
+          function->originalEquation(), result, approximation, context)) {
+    // Do not show exact expressions in certain cases, use approximate result
+    result = approximation;
+  }
+  return result;
 }
 
 int ValuesController::numberOfColumnsForAbscissaColumn(int column) {
@@ -121,6 +121,8 @@ class ValuesController : public Shared::ValuesController,
   void setStartEndMessages(Shared::IntervalParameterController *controller,
                            int column) override;
   void createMemoizedLayout(int column, int row, int index) override;
+  void prefetchValueAtLocation(int column, int row) override;
+  Poincare::Expression valueAtLocation(int column, int row);
   int numberOfColumnsForAbscissaColumn(int column) override;
   void updateSizeMemoizationForColumnAfterIndexChanged(
       int column, KDCoordinate columnPreviousWidth, int changedRow) override;
@@ -11,4 +11,10 @@ void Init() {
   ::Shared::GlobalContext::continuousFunctionStore.init();
 }
 
+void Shutdown() {
+  ::Shared::GlobalContext::continuousFunctionStore.deinit();
+  ::Shared::GlobalContext::sequenceStore.deinit();
+  ::GlobalPreferences::sharedGlobalPreferences.deinit();
+}
+
 }  // namespace Apps
@@ -116,6 +116,10 @@ void ion_main(int argc, const char *const argv[]) {
   Ion::setStackStart((void *)(&stackTop));
 
   AppsContainer::sharedAppsContainer()->run();
+
+  Apps::Shutdown();
+  Escher::Shutdown();
+  Poincare::Shutdown();
 }
 
 #endif
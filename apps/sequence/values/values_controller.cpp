@@ -168,24 +168,35 @@ Layout ValuesController::functionTitleLayout(int column,
 }
 
 void ValuesController::createMemoizedLayout(int column, int row, int index) {
+  Context *context = textFieldDelegateApp()->localContext();
+  *memoizedLayoutAtIndex(index) =
+      Float<double>::Builder(valueAtLocation(column, row))
+          .createLayout(Preferences::PrintFloatMode::Decimal,
+                        Preferences::VeryLargeNumberOfSignificantDigits,
+                        context);
+}
+
+double ValuesController::valueAtLocation(int column, int row) {
+  double value;
+  if (approximateValueIsCached(column, row, &value)) {
+    return value;
+  }
   double abscissa = intervalAtColumn(column)->element(
       row - 1);  // Subtract the title row from row to get the element index
   bool isSumColumn = false;
   Context *context = textFieldDelegateApp()->localContext();
   Shared::ExpiringPointer<Shared::Sequence> sequence =
       functionStore()->modelForRecord(recordAtColumn(column, &isSumColumn));
-  Expression result;
   if (isSumColumn) {
-    result =
+    Expression sum =
         sequence->sumBetweenBounds(sequence->initialRank(), abscissa, context);
+    assert(sum.type() == ExpressionNode::Type::Float);
+    value = static_cast<Float<double> &>(sum).value();
   } else {
-    Coordinate2D<double> xy =
-        sequence->evaluateXYAtParameter(abscissa, context);
-    result = Float<double>::Builder(xy.y());
+    value = sequence->evaluateXYAtParameter(abscissa, context).y();
   }
-  *memoizedLayoutAtIndex(index) = result.createLayout(
-      Preferences::PrintFloatMode::Decimal,
-      Preferences::VeryLargeNumberOfSignificantDigits, context);
+  cacheApproximateValue(column, row, value);
+  return value;
 }
 
 Shared::Interval *ValuesController::intervalAtColumn(int column) {
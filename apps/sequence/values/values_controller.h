@@ -87,6 +87,10 @@ class ValuesController : public Shared::ValuesController,
     setDefaultStartEndMessages();
   }
   void createMemoizedLayout(int i, int j, int index) override;
+  void prefetchValueAtLocation(int i, int j) override {
+    valueAtLocation(i, j);
+  }
+  double valueAtLocation(int column, int row);
   Shared::Interval *intervalAtColumn(int column) override;
   I18n::Message valuesParameterMessageAtColumn(int column) const override {
     return I18n::Message::N;
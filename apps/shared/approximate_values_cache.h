@@ -0,0 +1,67 @@
+#ifndef SHARED_APPROXIMATE_VALUES_CACHE_H
+#define SHARED_APPROXIMATE_VALUES_CACHE_H
+
+#include <assert.h>
+#include <stdint.h>
+
+namespace Shared {
+
+/* ApproximateValuesCache keeps the approximate values of the cells of a values
+ * table, independently of their layouts. It is a ring indexed by the cell
+ * coordinates: a cell is stored in the slot (row % NumberOfRows,
+ * column % NumberOfColumns), so that any window of NumberOfRows rows and
+ * NumberOfColumns columns can be cached at once. */
+
+template <int NumberOfRows, int NumberOfColumns>
+class ApproximateValuesCache {
+ public:
+  ApproximateValuesCache() { reset(); }
+
+  void reset() {
+    for (int i = 0; i < k_numberOfSlots; i++) {
+      m_rows[i] = k_emptySlot;
+    }
+  }
+
+  bool valueAtLocation(int column, int row, double* value) const {
+    int slot = SlotForLocation(column, row);
+    if (m_rows[slot] != row || m_columns[slot] != column) {
+      return false;
+    }
+    *value = m_values[slot];
+    return true;
+  }
+
+  void setValueAtLocation(int column, int row, double value) {
+    assert(row >= 0 && row < INT16_MAX && column >= 0 && column < INT16_MAX);
+    int slot = SlotForLocation(column, row);
+    m_values[slot] = value;
+    m_columns[slot] = column;
+    m_rows[slot] = row;
+  }
+
+  void invalidateRow(int row) {
+    for (int i = 0; i < k_numberOfSlots; i++) {
+      if (m_rows[i] == row) {
+        m_rows[i] = k_emptySlot;
+      }
+    }
+  }
+
+ private:
+  constexpr static int k_numberOfSlots = NumberOfRows * NumberOfColumns;
+  constexpr static int16_t k_emptySlot = -1;
+
+  static int SlotForLocation(int column, int row) {
+    assert(row >= 0 && column >= 0);
+    return (row % NumberOfRows) * NumberOfColumns + column % NumberOfColumns;
+  }
+
+  double m_values[k_numberOfSlots];
+  int16_t m_columns[k_numberOfSlots];
+  int16_t m_rows[k_numberOfSlots];
+};
+
+}  // namespace Shared
+
+#endif
@@ -1,7 +1,6 @@
 #include "continuous_function.h"
 
 #include <apps/apps_container_helper.h>
-#include <escher/palette.h>
 #include <poincare/derivative.h>
 #include <poincare/float.h>
 #include <poincare/function.h>
@@ -33,7 +32,6 @@ namespace Shared {
 
 ContinuousFunction ContinuousFunction::NewModel(
     Ion::Storage::Record::ErrorStatus *error, const char *baseName) {
-  static int s_colorIndex = 0;
   assert(baseName != nullptr);
   // Create the record
   /* WARNING: We create an empty record with the baseName and extension right
@@ -46,7 +44,7 @@ ContinuousFunction ContinuousFunction::NewModel(
    * calling the method "createRecordWithExtension". */
   Ion::Storage::Record record =
       Ion::Storage::Record(baseName, Ion::Storage::funcExtension);
-  RecordDataBuffer data(Escher::Palette::nextDataColor(&s_colorIndex));
+  RecordDataBuffer data(GlobalContext::continuousFunctionStore->nextColor());
   *error =
       Ion::Storage::FileSystem::sharedFileSystem->createRecordWithExtension(
           baseName, Ion::Storage::funcExtension, &data, sizeof(data));
@@ -185,6 +183,24 @@ bool ContinuousFunction::isDiscontinuousBetweenFloatValues(
       Poincare::Preferences::sharedPreferences->angleUnit());
 }
 
+Poincare::Interval<float> ContinuousFunction::enclosureBetweenParameters(
+    float t1, float t2, Context *context, int curveIndex) const {
+  assert(properties().isCartesian() && t1 <= t2);
+  if (t1 < tMin() || t2 > tMax()) {
+    return Poincare::Interval<float>::Unknown();
+  }
+  Expression e = expressionApproximated(context);
+  if (numberOfSubCurves() >= 2) {
+    assert(e.numberOfChildren() > curveIndex);
+    e = e.childAtIndex(curveIndex);
+  }
+  Preferences preferences =
+      Preferences::ClonePreferencesWithNewComplexFormat(complexFormat(context));
+  return Poincare::Interval<float>::ForExpression(
+      e, k_unknownName, t1, t2, context, preferences.complexFormat(),
+      preferences.angleUnit());
+}
+
 void ContinuousFunction::getLineParameters(double *slope, double *intercept,
                                            Context *context) const {
   assert(properties().isLine());
@@ -12,6 +12,7 @@
 #include <apps/i18n.h>
 #include <poincare/comparison.h>
 #include <poincare/conic.h>
+#include <poincare/interval.h>
 #include <poincare/preferences.h>
 #include <poincare/symbol_abstract.h>
 
@@ -134,6 +135,12 @@ class ContinuousFunction : public Function {
     return privateEvaluateXYAtParameter<double>(t, context, curveIndex);
   }
 
+  /* Enclose the values of a cartesian function between two parameters, or
+   * return an unknown interval. */
+  Poincare::Interval<float> enclosureBetweenParameters(
+      float t1, float t2, Poincare::Context *context,
+      int curveIndex = 0) const;
+
   double evaluateCurveParameter(int index, double cursorT, double cursorX,
                                 double cursorY,
                                 Poincare::Context *context) const;
@@ -9,7 +9,6 @@ namespace Shared {
 
 constexpr int ContinuousFunctionCache::k_sizeOfCache;
 constexpr float ContinuousFunctionCache::k_cacheHitTolerance;
-constexpr int ContinuousFunctionCache::k_numberOfAvailableCaches;
 
 // public
 void ContinuousFunctionCache::PrepareForCaching(void *fun,
@@ -18,10 +17,9 @@ void ContinuousFunctionCache::PrepareForCaching(void *fun,
   ContinuousFunction *function = static_cast<ContinuousFunction *>(fun);
 
   if (!cache) {
-    /* ContinuousFunctionStore::cacheAtIndex has returned a nullptr : the index
-     * of the function we are trying to draw is greater than the number of
-     * available caches, so we just tell the function to not lookup any cache.
-     */
+    /* ContinuousFunctionCaches::cacheForFunction has returned a nullptr: the
+     * available caches are all used by other curves, so we just tell the
+     * function to not lookup any cache. */
     function->setCache(nullptr);
     return;
   }
@@ -63,11 +61,13 @@ void ContinuousFunctionCache::clear() {
 Poincare::Coordinate2D<float> ContinuousFunctionCache::valueForParameter(
     const ContinuousFunction *function, Poincare::Context *context, float t,
     int curveIndex) {
-  int resIndex = indexForParameter(function, t, curveIndex);
+  bool isInMiddleOfStep;
+  int resIndex = indexForParameter(function, t, curveIndex, &isInMiddleOfStep);
   if (resIndex < 0) {
     return function->privateEvaluateXYAtParameter(t, context, curveIndex);
   }
-  return valuesAtIndex(function, context, t, resIndex, curveIndex);
+  return valuesAtIndex(function, context, t, resIndex, curveIndex,
+                       isInMiddleOfStep ? m_refinementCache : m_cache);
 }
 
 void ContinuousFunctionCache::ComputeNonCartesianSteps(float *tStep,
@@ -101,6 +101,7 @@ void ContinuousFunctionCache::ComputeNonCartesianSteps(float *tStep,
 void ContinuousFunctionCache::invalidateBetween(int iInf, int iSup) {
   for (int i = iInf; i < iSup; i++) {
     m_cache[i] = OMG::SignalingNan<float>();
+    m_refinementCache[i] = OMG::SignalingNan<float>();
   }
 }
 
@@ -110,13 +111,20 @@ void ContinuousFunctionCache::setRange(float tMin, float tStep) {
 }
 
 int ContinuousFunctionCache::indexForParameter(
-    const ContinuousFunction *function, float t, int curveIndex) const {
+    const ContinuousFunction *function, float t, int curveIndex,
+    bool *isInMiddleOfStep) const {
   assert(!std::isnan(t));
   if (curveIndex != 0 || std::isinf(t)) {
     /* TODO: For now, second curves are not cached. It may (or not) be slightly
      * better to cache both, but it should also be handled in pan. */
     return -1;
   }
+  if (std::fabs(t) < k_parameterRoundingThreshold * m_tStep) {
+    /* Such a parameter is mostly made of rounding errors: the parameter a
+     * cached value was computed at could differ a lot, relatively. Functions
+     * such as 1/x would then return very different values. */
+    return -1;
+  }
   float delta = (t - m_tMin) / m_tStep;
   // Conversion from int to float changes INT_MAX from 2147483647 to 2147483648
   if (delta < 0 || delta >= static_cast<float>(INT_MAX)) {
@@ -126,9 +134,15 @@ int ContinuousFunctionCache::indexForParameter(
   assert(!std::isnan(delta));
   int res = std::round(delta);
   assert(res >= 0);
+  *isInMiddleOfStep = std::fabs(res - delta) > k_cacheHitTolerance;
+  if (*isInMiddleOfStep) {
+    res = std::floor(delta);
+    if (std::fabs(res + 0.5f - delta) > k_cacheHitTolerance) {
+      return -1;
+    }
+  }
   if ((res >= k_sizeOfCache) ||
-      (res >= k_sizeOfCache / 2 && !function->properties().isCartesian()) ||
-      std::fabs(res - delta) > k_cacheHitTolerance) {
+      (res >= k_sizeOfCache / 2 && !function->properties().isCartesian())) {
     return -1;
   }
   assert(function->properties().isCartesian() || m_startOfCache == 0);
@@ -137,23 +151,23 @@ int ContinuousFunctionCache::indexForParameter(
 
 Poincare::Coordinate2D<float> ContinuousFunctionCache::valuesAtIndex(
     const ContinuousFunction *function, Poincare::Context *context, float t,
-    int i, int curveIndex) {
+    int i, int curveIndex, float *cache) {
   assert(curveIndex == 0);
   if (function->properties().isCartesian()) {
-    if (OMG::IsSignalingNan(m_cache[i])) {
-      m_cache[i] =
+    if (OMG::IsSignalingNan(cache[i])) {
+      cache[i] =
           function->privateEvaluateXYAtParameter(t, context, curveIndex).y();
     }
-    return Poincare::Coordinate2D<float>(t, m_cache[i]);
+    return Poincare::Coordinate2D<float>(t, cache[i]);
   }
-  if (OMG::IsSignalingNan(m_cache[2 * i]) ||
-      OMG::IsSignalingNan(m_cache[2 * i + 1])) {
+  if (OMG::IsSignalingNan(cache[2 * i]) ||
+      OMG::IsSignalingNan(cache[2 * i + 1])) {
     Poincare::Coordinate2D<float> res =
         function->privateEvaluateXYAtParameter(t, context, curveIndex);
-    m_cache[2 * i] = res.x();
-    m_cache[2 * i + 1] = res.y();
+    cache[2 * i] = res.x();
+    cache[2 * i + 1] = res.y();
   }
-  return Poincare::Coordinate2D<float>(m_cache[2 * i], m_cache[2 * i + 1]);
+  return Poincare::Coordinate2D<float>(cache[2 * i], cache[2 * i + 1]);
 }
 
 void ContinuousFunctionCache::pan(ContinuousFunction *function, float newTMin) {
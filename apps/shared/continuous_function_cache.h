@@ -12,8 +12,6 @@ class ContinuousFunction;
 
 class ContinuousFunctionCache {
  public:
-  constexpr static int k_numberOfAvailableCaches = 2;
-
   static void PrepareForCaching(void* fun, ContinuousFunctionCache* cache,
                                 float tMin, float tStep);
 
@@ -41,6 +39,9 @@ class ContinuousFunctionCache {
    * The value 128*FLT_EPSILON has been found to be the lowest for which all
    * indices verify indexForParameter(tMin + index * tStep) = index. */
   constexpr static float k_cacheHitTolerance = 128.0f * FLT_EPSILON;
+  /* Parameters closer to 0 than this fraction of the step are not cached,
+   * see indexForParameter. */
+  constexpr static float k_parameterRoundingThreshold = 1e-3f;
   /* The step is a fraction of tmax-tmin. We will evaluate the function at
    * every step and if the consecutive dots are close enough, we won't
    * evaluate any more dot within the step. We pick a very strange fraction
@@ -56,16 +57,24 @@ class ContinuousFunctionCache {
 
   void invalidateBetween(int iInf, int iSup);
   void setRange(float tMin, float tStep);
+  /* Parameters in the middle of two steps are stored in m_refinementCache,
+   * at the index of the step before them. */
   int indexForParameter(const ContinuousFunction* function, float t,
-                        int curveIndex) const;
+                        int curveIndex, bool* isInMiddleOfStep) const;
   Poincare::Coordinate2D<float> valuesAtIndex(
       const ContinuousFunction* function, Poincare::Context* context, float t,
-      int i, int curveIndex);
+      int i, int curveIndex, float* cache);
   void pan(ContinuousFunction* function, float newTMin);
 
   float m_tMin, m_tStep;
   float m_cache[k_sizeOfCache];
-  /* m_startOfCache is used to implement a circular buffer for easy panning
+  /* When two dots are too far apart, the curve drawing evaluates the function
+   * halfway between them. The dots halfway between two steps of the cache are
+   * kept alongside the steps, so that redrawing a part of the curve or panning
+   * does not evaluate them again. Deeper refinement dots are rarer and are not
+   * kept. */
+  float m_refinementCache[k_sizeOfCache];
+  /* m_startOfCache is used to implement circular buffers for easy panning
    * with cartesian functions. When dealing with parametric or polar functions,
    * m_startOfCache should be zero.*/
   int m_startOfCache;
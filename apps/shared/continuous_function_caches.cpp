@@ -0,0 +1,53 @@
+#include "continuous_function_caches.h"
+
+#include "continuous_function.h"
+
+namespace Shared {
+
+ContinuousFunctionCaches::~ContinuousFunctionCaches() {
+  for (int i = 0; i < k_numberOfCaches; i++) {
+    detachOwner(i);
+  }
+}
+
+ContinuousFunctionCache* ContinuousFunctionCaches::cacheForFunction(
+    ContinuousFunction* function) {
+  int index = -1;
+  for (int i = 0; i < k_numberOfCaches; i++) {
+    if (m_owners[i] == function) {
+      index = i;
+      break;
+    }
+  }
+  if (index < 0) {
+    // Lend a free cache, or else the least recently used one
+    for (int i = 0; i < k_numberOfCaches; i++) {
+      if (m_owners[i] == nullptr) {
+        index = i;
+        break;
+      }
+      if (m_lastUses[i] < m_startOfDrawing &&
+          (index < 0 || m_lastUses[i] < m_lastUses[index])) {
+        index = i;
+      }
+    }
+    if (index < 0) {
+      return nullptr;
+    }
+    detachOwner(index);
+    m_owners[index] = function;
+  }
+  m_lastUses[index] = ++m_clock;
+  return m_caches + index;
+}
+
+void ContinuousFunctionCaches::detachOwner(int i) {
+  /* The owner may have dropped the cache since, or its memoized function may
+   * have been replaced by another one. */
+  if (m_owners[i] != nullptr && m_owners[i]->cache() == m_caches + i) {
+    m_owners[i]->setCache(nullptr);
+  }
+  m_owners[i] = nullptr;
+}
+
+}  // namespace Shared
@@ -0,0 +1,51 @@
+#ifndef SHARED_CONTINUOUS_FUNCTION_CACHES_H
+#define SHARED_CONTINUOUS_FUNCTION_CACHES_H
+
+#include <stdint.h>
+
+#include "continuous_function_cache.h"
+
+namespace Shared {
+
+/* ContinuousFunctionCaches lends its caches to the drawn curves. A curve keeps
+ * its cache from one drawing to the next, unless it has been lent to another
+ * curve in the meantime. When all caches are taken, the least recently drawn
+ * curve loses its cache, provided it has not been drawn yet in the current
+ * drawing: otherwise, drawing more curves than there are caches would take the
+ * caches from one curve to the next, without any reuse.
+ * The caches are meant to be owned by an App, whose buffer they share. Since
+ * the functions outlive the App, they are detached from the caches when these
+ * are destroyed. */
+
+class ContinuousFunctionCaches {
+ public:
+  constexpr static int k_numberOfCaches = 6;
+
+  ContinuousFunctionCaches() : m_clock(0), m_startOfDrawing(0) {
+    for (int i = 0; i < k_numberOfCaches; i++) {
+      m_owners[i] = nullptr;
+      m_lastUses[i] = 0;
+    }
+  }
+  ~ContinuousFunctionCaches();
+  ContinuousFunctionCaches(const ContinuousFunctionCaches&) = delete;
+  ContinuousFunctionCaches& operator=(const ContinuousFunctionCaches&) = delete;
+
+  // Curves drawn from now on cannot take the caches of each other
+  void willStartDrawing() { m_startOfDrawing = m_clock + 1; }
+  // Return nullptr if all caches are used by the current drawing
+  ContinuousFunctionCache* cacheForFunction(ContinuousFunction* function);
+
+ private:
+  void detachOwner(int i);
+
+  ContinuousFunctionCache m_caches[k_numberOfCaches];
+  ContinuousFunction* m_owners[k_numberOfCaches];
+  uint32_t m_lastUses[k_numberOfCaches];
+  uint32_t m_clock;
+  uint32_t m_startOfDrawing;
+};
+
+}  // namespace Shared
+
+#endif
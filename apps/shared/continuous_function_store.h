@@ -1,6 +1,8 @@
 #ifndef SHARED_CONTINUOUS_FUNCTION_STORE_H
 #define SHARED_CONTINUOUS_FUNCTION_STORE_H
 
+#include <escher/palette.h>
+
 #include "continuous_function.h"
 #include "function_store.h"
 
@@ -21,7 +23,7 @@ class ContinuousFunctionStore : public FunctionStore {
            static_cast<ContinuousFunction *>(model)->canDisplayDerivative();
   }
 
-  ContinuousFunctionStore() : FunctionStore() {}
+  ContinuousFunctionStore() : FunctionStore(), m_colorIndex(0) {}
   int numberOfActiveFunctionsInTable() const {
     return numberOfModelsSatisfyingTest(&IsFunctionActiveInTable, nullptr);
   }
@@ -60,13 +62,10 @@ class ContinuousFunctionStore : public FunctionStore {
   KDColor colorForRecord(Ion::Storage::Record record) const override {
     return modelForRecord(record)->color();
   }
-  ContinuousFunctionCache *cacheAtIndex(int i) const {
-    return (i < ContinuousFunctionCache::k_numberOfAvailableCaches)
-               ? m_functionCaches + i
-               : nullptr;
-  }
   Ion::Storage::Record::ErrorStatus addEmptyModel() override;
   int maxNumberOfModels() const override { return k_maxNumberOfModels; }
+  // The colors of the new functions cycle through the data colors
+  KDColor nextColor() { return Escher::Palette::nextDataColor(&m_colorIndex); }
 
  private:
   static bool IsFunctionActiveInTable(ExpressionModelHandle *model,
@@ -109,8 +108,7 @@ class ContinuousFunctionStore : public FunctionStore {
   mutable uint32_t m_storageCheckSum;
   mutable int m_memoizedNumberOfActiveFunctions;
   mutable ContinuousFunction m_functions[k_maxNumberOfMemoizedModels];
-  mutable ContinuousFunctionCache
-      m_functionCaches[ContinuousFunctionCache::k_numberOfAvailableCaches];
+  int m_colorIndex;
 };
 
 }  // namespace Shared
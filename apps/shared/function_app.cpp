@@ -62,6 +62,15 @@ bool FunctionApp::storageCanChangeForRecordName(
          strcmp(recordName.extension, functionStore()->modelExtension()) != 0;
 }
 
+int FunctionApp::numberOfIdleTasks() {
+  return m_tabViewController.activeTab() == k_valuesTabIndex;
+}
+
+IdleTask* FunctionApp::idleTaskAtIndex(int i) {
+  assert(i == 0 && numberOfIdleTasks() == 1);
+  return valuesController()->prefetchTask();
+}
+
 FunctionApp::ListTab::ListTab(Shared::FunctionListController* listController)
     : m_listFooter(&m_listHeader, listController, listController,
                    ButtonRowController::Position::Bottom,
@@ -49,6 +49,10 @@ class FunctionApp : public LayoutFieldDelegateApp {
   void prepareForIntrusiveStorageChange() override;
   void concludeIntrusiveStorageChange() override;
 
+  // Prefetch the values table while it is displayed
+  int numberOfIdleTasks() override;
+  Escher::IdleTask *idleTaskAtIndex(int i) override;
+
  protected:
   FunctionApp(Snapshot *snapshot, Escher::AbstractTabUnion *tabs,
               I18n::Message firstTabName);
@@ -83,6 +87,9 @@ class FunctionApp : public LayoutFieldDelegateApp {
     Escher::StackViewController m_valuesStackViewController;
   };
 
+  // Index of the ValuesTab in the tabs of the app
+  constexpr static int k_valuesTabIndex = 2;
+
   Escher::TabUnionViewController m_tabViewController;
   Escher::ViewController *m_activeControllerBeforeStore;
 };
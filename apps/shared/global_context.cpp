@@ -21,8 +21,9 @@ namespace Shared {
 
 constexpr const char *GlobalContext::k_extensions[];
 
-OMG::GlobalBox<SequenceStore> GlobalContext::sequenceStore;
-OMG::GlobalBox<ContinuousFunctionStore> GlobalContext::continuousFunctionStore;
+OMG_INSTANCE_LOCAL OMG::GlobalBox<SequenceStore> GlobalContext::sequenceStore;
+OMG_INSTANCE_LOCAL OMG::GlobalBox<ContinuousFunctionStore>
+    GlobalContext::continuousFunctionStore;
 
 void GlobalContext::storageDidChangeForRecord(Ion::Storage::Record record) {
   m_sequenceContext.resetCache();
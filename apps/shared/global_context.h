@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <ion/storage/file_system.h>
 #include <omg/global_box.h>
+#include <omg/instance_local.h>
 #include <poincare/context.h>
 #include <poincare/decimal.h>
 #include <poincare/float.h>
@@ -44,8 +45,9 @@ class GlobalContext final : public Poincare::Context {
   bool setExpressionForSymbolAbstract(
       const Poincare::Expression &expression,
       const Poincare::SymbolAbstract &symbol) override;
-  static OMG::GlobalBox<SequenceStore> sequenceStore;
-  static OMG::GlobalBox<ContinuousFunctionStore> continuousFunctionStore;
+  static OMG_INSTANCE_LOCAL OMG::GlobalBox<SequenceStore> sequenceStore;
+  static OMG_INSTANCE_LOCAL OMG::GlobalBox<ContinuousFunctionStore>
+      continuousFunctionStore;
   void storageDidChangeForRecord(const Ion::Storage::Record record);
   SequenceContext *sequenceContext() { return &m_sequenceContext; }
   void tidyDownstreamPoolFrom(
@@ -1,12 +1,15 @@
 #include "interval_parameter_controller.h"
 
+#include <omg/instance_local.h>
+
 using namespace Escher;
 
 namespace Shared {
 
 Interval::IntervalParameters *
 IntervalParameterController::SharedTempIntervalParameters() {
-  static Interval::IntervalParameters sTempIntervalParameters;
+  static OMG_INSTANCE_LOCAL Interval::IntervalParameters
+      sTempIntervalParameters;
   return &sTempIntervalParameters;
 }
 
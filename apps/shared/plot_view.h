@@ -174,6 +174,8 @@ class AbstractPlotView : public Escher::View {
   }
   Escher::View *subviewAtIndex(int i) override;
   void layoutSubviews(bool force = false) override;
+  // Curves and arcs are sampled within the redrawn rect
+  bool drawingDependsOnRect() const override { return true; }
 
   virtual void drawBackground(KDContext *ctx, KDRect rect) const {
     ctx->fillRect(rect, backgroundColor());
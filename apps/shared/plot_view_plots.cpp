@@ -107,6 +107,7 @@ WithCurves::CurveDrawing::CurveDrawing(Curve2D curve, void *context,
       m_context(context),
       m_curveDouble(nullptr),
       m_discontinuity(NoDiscontinuity),
+      m_ordinatesEnclosure(nullptr),
       m_tStart(tStart),
       m_tEnd(tEnd),
       m_tStep(tStep),
@@ -326,6 +327,20 @@ void WithCurves::CurveDrawing::joinDots(const AbstractPlotView *plotView,
        * would otherwise have been visible at higher zoom only, with x in [2,4]
        * and y in [-0.2,0.2] in this case. */
       remainingIterations /= 2;
+      if (m_ordinatesEnclosure) {
+        // Skip the dots entirely if the curve provably stays out of the view
+        Poincare::Interval<float> ordinates =
+            m_ordinatesEnclosure(std::min(t1, t2), std::max(t1, t2),
+                                 m_curve.model(), m_context);
+        AbstractPlotView::Axis ordinateAxis =
+            AbstractPlotView::OtherAxis(m_axis);
+        float margin =
+            k_stampMarginInPixels * plotView->pixelLength(ordinateAxis);
+        if (!ordinates.intersects(plotView->rangeMin(ordinateAxis) - margin,
+                                  plotView->rangeMax(ordinateAxis) + margin)) {
+          return;
+        }
+      }
     }
 
     joinDots(plotView, ctx, rect, t1, xy1, t12, xy12, remainingIterations,
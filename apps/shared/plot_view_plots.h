@@ -1,6 +1,8 @@
 #ifndef SHARED_PLOT_VIEW_PLOTS_H
 #define SHARED_PLOT_VIEW_PLOTS_H
 
+#include <poincare/interval.h>
+
 #include <initializer_list>
 
 #include "plot_view.h"
@@ -44,6 +46,11 @@ class WithCurves {
 
   static bool NoDiscontinuity(float, float, void *, void *) { return false; }
 
+  /* Enclose the ordinates of the curve between two parameters, along the
+   * curve axis, or return an unknown interval. */
+  typedef Poincare::Interval<float> (*OrdinatesEnclosure)(float, float, void *,
+                                                          void *);
+
   /* The screen is tiled with a 4×4 pattern. It takes the form of a
    * lattice with four colored sections and a transparent background.
    * e.g. With sections 1 and 3 colored by Xs:
@@ -92,6 +99,9 @@ class WithCurves {
     void setPrecisionOptions(bool drawStraightLinesEarly,
                              Curve2DEvaluation<double> curveDouble,
                              DiscontinuityTest discontinuity);
+    void setOrdinatesEnclosure(OrdinatesEnclosure ordinatesEnclosure) {
+      m_ordinatesEnclosure = ordinatesEnclosure;
+    }
     void draw(const AbstractPlotView *plotView, KDContext *ctx,
               KDRect rect) const;
 
@@ -103,6 +113,9 @@ class WithCurves {
      * screen though.
      */
     constexpr static int k_maxNumberOfIterations = 8;
+    /* Ordinates further than this from the view may still be stamped in it
+     * by thick curves. */
+    constexpr static float k_stampMarginInPixels = 4.f;
 
     void joinDots(const AbstractPlotView *plotView, KDContext *ctx, KDRect rect,
                   float t1, Poincare::Coordinate2D<float> xy1, float t2,
@@ -116,6 +129,7 @@ class WithCurves {
     void *m_context;
     Curve2DEvaluation<double> m_curveDouble;
     DiscontinuityTest m_discontinuity;
+    OrdinatesEnclosure m_ordinatesEnclosure;
     float m_tStart;
     float m_tEnd;
     float m_tStep;
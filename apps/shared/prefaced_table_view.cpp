@@ -20,6 +20,8 @@ PrefacedTableView::PrefacedTableView(
   m_mainTableView->setParentResponder(parentResponder);
   m_mainTableView->setDelegate(this);
   m_rowPrefaceView.hideScrollBars();
+  // m_barDecorator is drawn over the tables
+  m_rowPrefaceView.setScrollsByMovingPixels(false);
 }
 
 void PrefacedTableView::setMargins(KDCoordinate top, KDCoordinate right,
@@ -151,6 +153,7 @@ void PrefacedTableView::layoutSubviewsInRect(KDRect rect, bool force) {
 
 void PrefacedTableView::layoutScrollbars(bool force) {
   m_mainTableView->hideScrollBars();
+  m_mainTableView->setScrollsByMovingPixels(false);
   // Content offset if we had no prefaces hiding a part of the table
   KDPoint virtualOffset = m_mainTableView->contentOffset()
                               .relativeTo(relativeChildOrigin(m_mainTableView))
@@ -20,6 +20,7 @@ PrefacedTwiceTableView::PrefacedTwiceTableView(
                                 &m_prefaceIntersectionDataSource),
       m_mainTableViewLeftMargin(0) {
   m_columnPrefaceView.hideScrollBars();
+  m_columnPrefaceView.setScrollsByMovingPixels(false);
 }
 
 void PrefacedTwiceTableView::setMargins(KDCoordinate top, KDCoordinate right,
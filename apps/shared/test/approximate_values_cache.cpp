@@ -0,0 +1,41 @@
+#include "../approximate_values_cache.h"
+
+#include <quiz.h>
+
+namespace Shared {
+
+QUIZ_CASE(approximate_values_cache) {
+  ApproximateValuesCache<4, 2> cache;
+  double value;
+  quiz_assert(!cache.valueAtLocation(0, 0, &value));
+
+  cache.setValueAtLocation(1, 3, 2.5);
+  quiz_assert(cache.valueAtLocation(1, 3, &value) && value == 2.5);
+  // Cells sharing a slot do not alias
+  quiz_assert(!cache.valueAtLocation(1, 7, &value));
+  quiz_assert(!cache.valueAtLocation(3, 3, &value));
+
+  // A window of 4 rows and 2 columns fits at once
+  for (int row = 5; row < 9; row++) {
+    for (int column = 2; column < 4; column++) {
+      cache.setValueAtLocation(column, row, row * 10 + column);
+    }
+  }
+  for (int row = 5; row < 9; row++) {
+    for (int column = 2; column < 4; column++) {
+      quiz_assert(cache.valueAtLocation(column, row, &value) &&
+                  value == row * 10 + column);
+    }
+  }
+  quiz_assert(!cache.valueAtLocation(1, 3, &value));
+
+  cache.invalidateRow(6);
+  quiz_assert(!cache.valueAtLocation(2, 6, &value));
+  quiz_assert(!cache.valueAtLocation(3, 6, &value));
+  quiz_assert(cache.valueAtLocation(2, 5, &value));
+
+  cache.reset();
+  quiz_assert(!cache.valueAtLocation(2, 5, &value));
+}
+
+}  // namespace Shared
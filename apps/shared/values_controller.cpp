@@ -26,6 +26,10 @@ ValuesController::ValuesController(Responder *parentResponder,
       m_prefacedTwiceTableView(0, 0, this, &m_selectableTableView, this, this),
       m_firstMemoizedColumn(INT_MAX),
       m_firstMemoizedRow(INT_MAX),
+      m_prefetchTask(this),
+      m_firstPrefetchedColumn(0),
+      m_firstPrefetchedRow(0),
+      m_prefetchCursor(0),
       m_abscissaParameterController(this, this) {
   m_prefacedTwiceTableView.setBackgroundColor(Palette::WallScreenDark);
   m_prefacedTwiceTableView.setCellOverlap(0, 0);
@@ -269,6 +273,7 @@ void ValuesController::didChangeCell(int column, int row) {
   /* Update the row memoization if it exists */
   // the first row is never reloaded as it corresponds to title row
   assert(row > 0);
+  m_approximateValuesCache.invalidateRow(valuesRowForAbsoluteRow(row));
   // Conversion of coordinates from absolute table to values table
   int memoizedRow = valuesRowForAbsoluteRow(row) - m_firstMemoizedRow;
   if (0 > memoizedRow || memoizedRow >= k_maxNumberOfDisplayableRows) {
@@ -363,6 +368,66 @@ void ValuesController::resetLayoutMemoization() {
   m_prefacedTwiceTableView.resetDataSourceSizeMemoization();
   m_firstMemoizedColumn = INT_MAX;
   m_firstMemoizedRow = INT_MAX;
+  resetApproximateValuesCache();
+}
+
+void ValuesController::resetApproximateValuesCache() {
+  m_approximateValuesCache.reset();
+  m_prefetchTask.cancel();
+}
+
+bool ValuesController::approximateValueIsCached(int column, int row,
+                                                double *value) {
+  return m_approximateValuesCache.valueAtLocation(
+      valuesColumnForAbsoluteColumn(column), valuesRowForAbsoluteRow(row),
+      value);
+}
+
+void ValuesController::cacheApproximateValue(int column, int row,
+                                             double value) {
+  m_approximateValuesCache.setValueAtLocation(
+      valuesColumnForAbsoluteColumn(column), valuesRowForAbsoluteRow(row),
+      value);
+}
+
+void ValuesController::schedulePrefetch(int columnDirection,
+                                        int rowDirection) {
+  assert(columnDirection >= -1 && columnDirection <= 1);
+  assert(rowDirection >= -1 && rowDirection <= 1);
+  assert(columnDirection != 0 || rowDirection != 0);
+  m_firstPrefetchedColumn =
+      m_firstMemoizedColumn + columnDirection * k_maxNumberOfDisplayableColumns;
+  m_firstPrefetchedRow =
+      m_firstMemoizedRow + rowDirection * k_maxNumberOfDisplayableRows;
+  m_prefetchCursor = 0;
+  m_prefetchTask.schedule();
+}
+
+bool ValuesController::prefetchNextValue() {
+  /* Like the memoized table, the prefetched screen is walked row by row to
+   * step all sequences at the same time. */
+  const int nbOfMemoizedColumns = k_maxNumberOfDisplayableColumns;
+  while (m_prefetchCursor < k_maxNumberOfDisplayableCells) {
+    int valuesRow =
+        m_firstPrefetchedRow + m_prefetchCursor / nbOfMemoizedColumns;
+    int valuesCol =
+        m_firstPrefetchedColumn + m_prefetchCursor % nbOfMemoizedColumns;
+    m_prefetchCursor++;
+    if (valuesRow < 0 || valuesCol < 0 ||
+        valuesCol >= numberOfValuesColumns()) {
+      continue;
+    }
+    int column = absoluteColumnForValuesColumn(valuesCol);
+    double value;
+    if (valuesRow >= numberOfElementsInColumn(column) ||
+        m_approximateValuesCache.valueAtLocation(valuesCol, valuesRow,
+                                                 &value)) {
+      continue;
+    }
+    prefetchValueAtLocation(column, absoluteRowForValuesRow(valuesRow));
+    break;
+  }
+  return m_prefetchCursor < k_maxNumberOfDisplayableCells;
 }
 
 Layout ValuesController::memoizedLayoutForCell(int column, int row) {
@@ -389,6 +454,13 @@ Layout ValuesController::memoizedLayoutForCell(int column, int row) {
 
   // Apply the offset
   if (offset != 0) {
+    /* Prefetch the next screen along the move of the memoized table, or
+     * downwards when the table is first displayed. */
+    bool firstDisplay = m_firstMemoizedRow == INT_MAX;
+    int prefetchColumnDirection =
+        firstDisplay ? 0 : (offsetCol > 0) - (offsetCol < 0);
+    int prefetchRowDirection =
+        firstDisplay ? 1 : (offsetRow > 0) - (offsetRow < 0);
     m_firstMemoizedColumn = m_firstMemoizedColumn + offsetCol;
     m_firstMemoizedRow = m_firstMemoizedRow + offsetRow;
     // Shift already memoized cells
@@ -439,6 +511,7 @@ Layout ValuesController::memoizedLayoutForCell(int column, int row) {
             row * nbOfMemoizedColumns + col);
       }
     }
+    schedulePrefetch(prefetchColumnDirection, prefetchRowDirection);
   }
   return *memoizedLayoutAtIndex((valuesRow - m_firstMemoizedRow) *
                                     nbOfMemoizedColumns +
@@ -447,6 +520,7 @@ Layout ValuesController::memoizedLayoutForCell(int column, int row) {
 
 void ValuesController::clearSelectedColumn() {
   intervalAtColumn(selectedColumn())->clear();
+  resetApproximateValuesCache();
   selectCellAtLocation(selectedColumn(), 1);
   resetMemoization();
 }
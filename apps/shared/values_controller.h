@@ -7,8 +7,10 @@
 #include <escher/even_odd_editable_text_cell.h>
 #include <escher/even_odd_expression_cell.h>
 #include <escher/even_odd_message_text_cell.h>
+#include <escher/idle_task.h>
 #include <escher/tab_view_controller.h>
 
+#include "approximate_values_cache.h"
 #include "editable_cell_table_view_controller.h"
 #include "expression_function_title_cell.h"
 #include "function_store.h"
@@ -66,6 +68,10 @@ class ValuesController : public EditableCellTableViewController,
   virtual IntervalParameterController* intervalParameterController() = 0;
   void initializeInterval();
 
+  // Prefetch of the approximate values, run when the user is inactive
+  Escher::IdleTask* prefetchTask() { return &m_prefetchTask; }
+  void resetApproximateValuesCache();
+
  protected:
   constexpr static int k_abscissaTitleCellType = 0;
   constexpr static int k_functionTitleCellType = 1;
@@ -113,6 +119,15 @@ class ValuesController : public EditableCellTableViewController,
   // Coordinates of memoizedLayoutForCell refer to the absolute table
   Poincare::Layout memoizedLayoutForCell(int i, int j);
 
+  /* Approximate values memoization
+   * The approximate values of the cells of the memoized table and of the
+   * screen ahead of it in the scroll direction are kept in a compact cache of
+   * doubles. The cells ahead are computed by the prefetch task when the user
+   * is inactive, so that scrolling only has to lay them out. Coordinates refer
+   * to the absolute table. */
+  bool approximateValueIsCached(int column, int row, double* value);
+  void cacheApproximateValue(int column, int row, double value);
+
   Escher::SelectableViewController* columnParameterController() override;
   Shared::ColumnParameters* columnParameters() override;
 
@@ -160,6 +175,9 @@ class ValuesController : public EditableCellTableViewController,
   /* Coordinates of createMemoizedLayout refer to the absolute table but the
    * index refers to the memoized table */
   virtual void createMemoizedLayout(int i, int j, int index) = 0;
+  /* Compute the approximate value of the cell (i, j) of the absolute table and
+   * cache it, if it can be displayed from a double. */
+  virtual void prefetchValueAtLocation(int i, int j) = 0;
   /* m_firstMemoizedColumn and m_firstMemoizedRow are coordinates of the table
    * of values cells.*/
   virtual int numberOfColumnsForAbscissaColumn(int column) {
@@ -169,6 +187,30 @@ class ValuesController : public EditableCellTableViewController,
   mutable int m_firstMemoizedColumn;
   mutable int m_firstMemoizedRow;
 
+  class PrefetchTask : public Escher::IdleTask {
+   public:
+    PrefetchTask(ValuesController* controller)
+        : Escher::IdleTask(Priority::Low), m_controller(controller) {}
+
+   private:
+    bool step() override { return m_controller->prefetchNextValue(); }
+    // Prefetched values are not displayed yet
+    bool didRun(bool completed) override { return false; }
+    ValuesController* m_controller;
+  };
+  /* Each direction is 1 to prefetch the cells after the memoized table along
+   * its axis, -1 before it and 0 alongside it. */
+  void schedulePrefetch(int columnDirection, int rowDirection);
+  bool prefetchNextValue();
+  ApproximateValuesCache<2 * k_maxNumberOfDisplayableRows,
+                         2 * k_maxNumberOfDisplayableColumns>
+      m_approximateValuesCache;
+  PrefetchTask m_prefetchTask;
+  // Coordinates of the table of values cells
+  int m_firstPrefetchedColumn;
+  int m_firstPrefetchedRow;
+  int m_prefetchCursor;
+
   virtual void updateSizeMemoizationForColumnAfterIndexChanged(
       int column, KDCoordinate columnPreviousWidth, int changedRow) {}
 
@@ -13,4 +13,5 @@ EPSILON_GETOPT ?= 0
 ESCHER_LOG_EVENTS_BINARY ?= 0
 ESCHER_LOG_EVENTS_NAME ?= $(DEBUG)
 I18N_COMPRESS ?= 0
+PYTHON_PROFILER ?= 0
 ASSERTIONS ?= $(DEBUG)
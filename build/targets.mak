@@ -43,6 +43,19 @@ $(BUILD_DIR)/test.$(EXE): $(call flavored_object_for,$(test_runner_src),consoled
 
 HANDY_TARGETS += test
 
+# Benchmarks
+# They are run by the test runner, with their own quiz cases.
+
+benchmark_runner_src = $(base_src) $(apps_tests_src) apps/apps_container_helper_tests.cpp $(filter-out %/tests_symbols.c,$(runner_src))
+
+$(BUILD_DIR)/benchmark.kandinsky.$(EXE): $(call flavored_object_for,$(benchmark_runner_src) $(BUILD_DIR)/quiz/src/benchmark_kandinsky_symbols.c $(benchmark_kandinsky_src),consoledisplay)
+
+HANDY_TARGETS += benchmark.kandinsky
+
+$(BUILD_DIR)/benchmark.poincare.$(EXE): $(call flavored_object_for,$(benchmark_runner_src) $(BUILD_DIR)/quiz/src/benchmark_poincare_symbols.c $(benchmark_poincare_src),consoledisplay)
+
+HANDY_TARGETS += benchmark.poincare
+
 # Load platform-specific targets
 # We include them before the standard ones to give them precedence.
 -include build/targets.$(PLATFORM).mak
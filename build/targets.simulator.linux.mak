@@ -11,3 +11,33 @@ reload: default
 # If MICROPY_NLR_SETJMP is 0, the MicroPython NLR done by
 # python/src/py/nlrx64.c crashes on linux.
 SFLAGS += -DMICROPY_NLR_SETJMP=1
+
+# Embeddable engine
+# The simulator entry point is left out: the host program drives Epsilon with
+# the API of apps/engine.h, and links with the LDFLAGS of the simulator.
+
+libepsilon_src = $(filter-out ion/src/simulator/shared/main.cpp,$(epsilon_src)) apps/engine.cpp
+
+$(BUILD_DIR)/libepsilon.a: $(call flavored_object_for,$(libepsilon_src),)
+	$(call rule_label,AR)
+	$(Q) rm -f $@ && $(AR) rcs $@ $^
+
+.PHONY: libepsilon.a
+libepsilon.a: $(BUILD_DIR)/libepsilon.a
+
+# Engine stress test
+# Concurrent engines replay the events benchmark scenarios, and must draw the
+# same frames as a single engine. Run it with "make engine_stress_run".
+
+$(BUILD_DIR)/engine_stress.$(EXE): $(call flavored_object_for,$(libepsilon_src) apps/engine_stress.cpp,)
+$(BUILD_DIR)/engine_stress.$(EXE): LDFLAGS += -lpthread
+
+HANDY_TARGETS += engine_stress
+
+# Fuzzer smoke test
+# Inputs run back to back in one process, as when fuzzing, and must not depend
+# on each other. Run it with "make fuzzer_smoke_run".
+
+$(BUILD_DIR)/fuzzer_smoke.$(EXE): $(call flavored_object_for,$(libepsilon_src) apps/fuzzer_smoke.cpp,)
+
+HANDY_TARGETS += fuzzer_smoke
@@ -15,6 +15,7 @@ __ZN6Escher10Invocation7performEPv \
 __ZN11MicroPython20ExecutionEnvironment7runCodeEPKc \
 __ZN13AppsContainer13dispatchEventEN3Ion6Events5EventE \
 __ZN13AppsContainer3runEv \
+__ZN13AppsContainer13runStepsWhileEPFbPvES0_ \
 __ZN13AppsContainer18switchToBuiltinAppEPN6Escher3App8SnapshotE \
 __ZN6Escher19ButtonRowController23didBecomeFirstResponderEv \
 __ZN6Escher19ModalViewController23didBecomeFirstResponderEv \
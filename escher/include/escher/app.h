@@ -2,6 +2,7 @@
 #define ESCHER_APP_H
 
 #include <escher/i18n.h>
+#include <escher/idle_task.h>
 #include <escher/image.h>
 #include <escher/modal_view_controller.h>
 #include <escher/responder.h>
@@ -82,6 +83,13 @@ class App : public Responder {
     assert(false);
     return nullptr;
   }
+  /* Idle tasks are run by the container when the user is inactive. Controllers
+   * schedule them when they have some work to do. */
+  virtual int numberOfIdleTasks() { return 0; }
+  virtual IdleTask* idleTaskAtIndex(int i) {
+    assert(false);
+    return nullptr;
+  }
   virtual Poincare::Context* localContext() { return nullptr; }
 
   virtual bool storageCanChangeForRecordName(
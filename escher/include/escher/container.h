@@ -14,6 +14,7 @@
 #include <escher/run_loop.h>
 #include <escher/window.h>
 #include <ion/events.h>
+#include <omg/instance_local.h>
 
 namespace Escher {
 
@@ -33,13 +34,15 @@ class Container : public RunLoop {
 
  protected:
   virtual Window* window() = 0;
-  static App* s_activeApp;
+  static OMG_INSTANCE_LOCAL App* s_activeApp;
 
  private:
   int numberOfTimers() override;
   Timer* timerAtIndex(int i) override;
   virtual int numberOfContainerTimers();
   virtual Timer* containerTimerAtIndex(int i);
+  int numberOfIdleTasks() override;
+  IdleTask* idleTaskAtIndex(int i) override;
 };
 
 }  // namespace Escher
@@ -0,0 +1,66 @@
+#ifndef ESCHER_IDLE_TASK_H
+#define ESCHER_IDLE_TASK_H
+
+#include <stdint.h>
+
+namespace Escher {
+
+/* An IdleTask is a resumable piece of work performed by the RunLoop while the
+ * user is inactive. The work is split into short steps: once the task has been
+ * scheduled, step is called repeatedly until it returns false. The RunLoop
+ * interrupts the task between two steps when its time budget is spent or when
+ * an event is pending, and resumes it at the next idle time.
+ *
+ * Tasks with a higher priority are run first. The time spent in each task is
+ * accounted for, to tune budgets and to spot slow tasks. */
+
+class IdleTask {
+ public:
+  enum class Priority : uint8_t { Low = 0, Normal, High };
+  constexpr static uint32_t k_defaultBudget = 50;  // In milliseconds
+
+  IdleTask(Priority priority = Priority::Normal,
+           uint32_t budget = k_defaultBudget)
+      : m_budget(budget),
+        m_elapsedTime(0),
+        m_numberOfSteps(0),
+        m_priority(priority),
+        m_isPending(false) {}
+
+  Priority priority() const { return m_priority; }
+  uint32_t budget() const { return m_budget; }
+  bool isPending() const { return m_isPending; }
+  void schedule() { m_isPending = true; }
+  void cancel() { m_isPending = false; }
+
+  // Time accounting
+  uint32_t elapsedTime() const { return m_elapsedTime; }
+  uint32_t numberOfSteps() const { return m_numberOfSteps; }
+  void resetTimeAccounting() {
+    m_elapsedTime = 0;
+    m_numberOfSteps = 0;
+  }
+
+  /* Run steps until the task is complete, its budget is spent or
+   * shouldYield returns true. Return true if the screen needs to be
+   * redrawn. */
+  bool run(bool (*shouldYield)());
+
+ protected:
+  // Perform a bounded amount of work and return true if some work is left.
+  virtual bool step() = 0;
+  /* Called when the task has been interrupted or completed. Return true if
+   * the screen needs to be redrawn. */
+  virtual bool didRun(bool completed) { return completed; }
+
+ private:
+  uint32_t m_budget;
+  uint32_t m_elapsedTime;
+  uint32_t m_numberOfSteps;
+  Priority m_priority;
+  bool m_isPending;
+};
+
+}  // namespace Escher
+
+#endif
@@ -1,6 +1,7 @@
 #ifndef ESCHER_RUN_LOOP_H
 #define ESCHER_RUN_LOOP_H
 
+#include <escher/idle_task.h>
 #include <escher/timer.h>
 #include <ion.h>
 
@@ -11,11 +12,17 @@ class RunLoop {
   RunLoop();
   void run();
   void runWhile(bool (*callback)(void* ctx), void* ctx);
+  bool isTerminated() const { return m_breakAllLoops; }
 
  protected:
   virtual bool dispatchEvent(Ion::Events::Event e) = 0;
   virtual int numberOfTimers();
   virtual Timer* timerAtIndex(int i);
+  virtual int numberOfIdleTasks();
+  virtual IdleTask* idleTaskAtIndex(int i);
+  /* Run the pending idle tasks until they are complete, an event is pending or
+   * a tick has elapsed. Return the time spent in milliseconds. */
+  int runIdleTasks();
 
  private:
   // Returns true while the Termination event is not fired.
@@ -102,6 +102,12 @@ class ScrollView : public View {
 
   void setContentOffset(KDPoint offset);
   KDPoint contentOffset() const { return m_dataSource->offset(); }
+  /* Scrolling moves the pixels already on screen instead of redrawing them.
+   * It must be disabled when views outside of the scroll view are drawn over
+   * its content. */
+  void setScrollsByMovingPixels(bool scrollsByMovingPixels) {
+    m_scrollsByMovingPixels = scrollsByMovingPixels;
+  }
 
   void scrollToContentPoint(KDPoint point);
   // Minimal scrolling to make this rect visible
@@ -121,6 +127,10 @@ class ScrollView : public View {
   }
   virtual bool alwaysForceRelayoutOfContentView() const { return false; }
   virtual float marginPortionTolerance() const { return 0.8f; }
+  /* Called when the content has been scrolled by moving its pixels. Views
+   * whose layout changes the content without moving it must mark it as dirty
+   * again. */
+  virtual void didScrollPixels() {}
 #if ESCHER_VIEW_LOGGING
   const char *className() const override;
   void logAttributes(std::ostream &os) const override;
@@ -145,10 +155,32 @@ class ScrollView : public View {
       assert(index == 0);
       return m_scrollView->m_contentView;
     }
-    const ScrollView *m_scrollView;
+    KDRect willRedraw(KDContext *ctx, KDRect visibleRect,
+                      KDRect forceRedrawRect) override {
+      return m_scrollView->moveScrolledPixels(ctx, visibleRect,
+                                              forceRedrawRect);
+    }
+    ScrollView *m_scrollView;
   };
 
+  /* Moving the pixels is only done where they are copied within a
+   * framebuffer. On the device, they would be pulled from the display and
+   * pushed back, which has not been measured to beat redrawing them. */
+#if PLATFORM_DEVICE
+  constexpr static bool k_canScrollByMovingPixels = false;
+#else
+  constexpr static bool k_canScrollByMovingPixels = true;
+#endif
+
   KDRect layoutDecorator(bool force);
+  KDRect indicatorsFrame();
+  /* Scrolling does not redraw the whole content: the pixels already on screen
+   * are moved at the next redraw and only the newly exposed area is marked as
+   * dirty. */
+  void scrollPixels(KDPoint delta, KDRect previousInnerFrame,
+                    KDSize previousContentSize, KDRect previousDirtyRect);
+  KDRect moveScrolledPixels(KDContext *ctx, KDRect visibleRect,
+                            KDRect forceRedrawRect);
 
   ScrollViewDataSource *m_dataSource;
   View *m_contentView;
@@ -162,6 +194,12 @@ class ScrollView : public View {
   mutable KDCoordinate m_excessHeight;
 
   KDColor m_backgroundColor;
+
+  // Translation of the pixels on screen, to apply at the next redraw
+  KDPoint m_pendingScroll;
+  // Indicators drawn over the inner view before the pending scroll
+  KDRect m_pendingScrollIndicatorsFrame;
+  bool m_scrollsByMovingPixels;
 };
 
 }  // namespace Escher
@@ -53,6 +53,7 @@ class SelectableTableView : public TableView, public Responder {
 
  protected:
   void layoutSubviews(bool force = false) override;
+  void didScrollPixels() override;
   SelectableTableViewDataSource* m_selectionDataSource;
   SelectableTableViewDelegate* m_delegate;
 
@@ -4,6 +4,7 @@
 #include <escher/responder.h>
 #include <escher/view.h>
 #include <omg/global_box.h>
+#include <omg/instance_local.h>
 
 namespace Escher {
 
@@ -15,6 +16,7 @@ class TextCursorView : public View {
  public:
   constexpr static KDCoordinate k_width = 1;
   static void InitSharedCursor() { sharedTextCursor.init(); }
+  static void ShutdownSharedCursor() { sharedTextCursor.deinit(); }
 
   TextCursorView() : m_visible(false) {}
 
@@ -61,7 +63,7 @@ class TextCursorView : public View {
  private:
   /* Keep this private so that only CursorFieldView and WithBlinkingCursor can
    * reach this object. */
-  static OMG::GlobalBox<TextCursorView> sharedTextCursor;
+  static OMG_INSTANCE_LOCAL OMG::GlobalBox<TextCursorView> sharedTextCursor;
 
   bool isInField(const CursorFieldView* field) { return m_field == field; }
   bool shouldBlink() { return m_field; }
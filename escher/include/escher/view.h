@@ -32,6 +32,8 @@ class Window;
 class View {
   friend class Shared::MemoizedCursorView;
   friend class TextCursorView;
+  // ScrollView moves the pixels of its content instead of redrawing them
+  friend class ScrollView;
   // We only want Window to be able to invoke View::redraw
   friend class Window;
 
@@ -72,7 +74,8 @@ class View {
    * bound to a view, it's really absolute pixels that count.
    *
    * That being said, what are the case of dirtyness that we know of?
-   *  - Scrolling -> well, everything has to be redrawn anyway
+   *  - Scrolling -> the pixels already drawn can be moved, so that only the
+   *    newly exposed area has to be redrawn (see ScrollView)
    *  - Moving a cursor -> In that case, there's really a much more efficient
    * way
    *  - ... and that's all I can think of.
@@ -88,12 +91,29 @@ class View {
 #endif
   virtual int numberOfSubviews() const { return 0; }
   virtual View *subviewAtIndex(int index) { return nullptr; }
+  /* Whether the pixels drawn by drawRect depend on the rect, for instance
+   * because curves are sampled within it. ScrollView then redraws the view
+   * entirely instead of moving its pixels, so that they do not depend on the
+   * scroll history. */
+  virtual bool drawingDependsOnRect() const { return false; }
 
  private:
   void setFrame(KDRect frame, bool force);
   virtual void layoutSubviews(bool force = false) {}
   void translate(KDPoint origin);
   KDRect redraw(KDRect rect, KDRect forceRedrawRect = KDRectZero);
+  /* Called by redraw before the view is drawn into ctx. A view can update some
+   * of its pixels by other means than drawRect, and return the absolute area
+   * updated this way: its subviews will not redraw it, but the views drawn
+   * afterwards will be drawn over it. */
+  virtual KDRect willRedraw(KDContext *ctx, KDRect visibleRect,
+                            KDRect forceRedrawRect) {
+    return KDRectZero;
+  }
+  KDRect dirtyRectOfHierarchy();
+  /* Mark the hierarchy as clean, except the views whose drawing depends on the
+   * rect, which are marked as entirely dirty. */
+  void markHierarchyAsMoved();
 
   /* At destruction, subviews aren't notified that their own pointer
    * 'm_superview' is outdated. This is not an issue since all view hierarchy
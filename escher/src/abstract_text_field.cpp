@@ -7,6 +7,7 @@
 #include <ion/keyboard/layout_events.h>
 #include <ion/unicode/utf8_decoder.h>
 #include <ion/unicode/utf8_helper.h>
+#include <omg/instance_local.h>
 #include <poincare/aliases_list.h>
 #include <poincare/parametered_expression.h>
 #include <poincare/serialization_helper.h>
@@ -16,8 +17,9 @@
 #include <algorithm>
 
 namespace Escher {
-static char s_draftTextBuffer[AbstractTextField::MaxBufferSize()];
-static size_t s_currentDraftTextLength;
+static OMG_INSTANCE_LOCAL char
+    s_draftTextBuffer[AbstractTextField::MaxBufferSize()];
+static OMG_INSTANCE_LOCAL size_t s_currentDraftTextLength;
 
 /* AbstractTextField::ContentView */
 
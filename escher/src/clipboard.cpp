@@ -2,12 +2,13 @@
 #include <escher/text_field.h>
 #include <ion/clipboard.h>
 #include <ion/unicode/utf8_decoder.h>
+#include <omg/instance_local.h>
 
 #include <algorithm>
 
 namespace Escher {
 
-static Clipboard s_clipboard;
+static OMG_INSTANCE_LOCAL Clipboard s_clipboard;
 
 Clipboard* Clipboard::SharedClipboard() { return &s_clipboard; }
 
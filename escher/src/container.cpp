@@ -6,7 +6,7 @@ namespace Escher {
 Container::Container() : RunLoop() {}
 
 // Initialize private static member
-App* Container::s_activeApp = nullptr;
+OMG_INSTANCE_LOCAL App* Container::s_activeApp = nullptr;
 
 Container::~Container() {
   if (s_activeApp) {
@@ -60,6 +60,15 @@ Timer* Container::timerAtIndex(int i) {
   return containerTimerAtIndex(i - s_activeApp->numberOfTimers());
 }
 
+int Container::numberOfIdleTasks() {
+  return s_activeApp ? s_activeApp->numberOfIdleTasks() : 0;
+}
+
+IdleTask* Container::idleTaskAtIndex(int i) {
+  assert(s_activeApp);
+  return s_activeApp->idleTaskAtIndex(i);
+}
+
 int Container::numberOfContainerTimers() { return 0; }
 
 Timer* Container::containerTimerAtIndex(int i) {
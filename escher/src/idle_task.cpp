@@ -0,0 +1,21 @@
+#include <assert.h>
+#include <escher/idle_task.h>
+#include <ion/timing.h>
+
+namespace Escher {
+
+bool IdleTask::run(bool (*shouldYield)()) {
+  assert(m_isPending);
+  uint64_t start = Ion::Timing::millis();
+  uint64_t now = start;
+  do {
+    m_numberOfSteps++;
+    m_isPending = step();
+    now = Ion::Timing::millis();
+  } while (m_isPending && now - start < m_budget &&
+           (shouldYield == nullptr || !shouldYield()));
+  m_elapsedTime += now - start;
+  return didRun(!m_isPending);
+}
+
+}  // namespace Escher
@@ -1,3 +1,4 @@
+#include <escher/clipboard.h>
 #include <escher/init.h>
 #include <escher/text_cursor_view.h>
 #include <kandinsky/ion_context.h>
@@ -7,6 +8,13 @@ namespace Escher {
 void Init() {
   KDIonContext::SharedContext.init();
   TextCursorView::InitSharedCursor();
+  // The clipboard is a plain global: empty what a previous run copied
+  Clipboard::SharedClipboard()->reset();
+}
+
+void Shutdown() {
+  TextCursorView::ShutdownSharedCursor();
+  KDIonContext::SharedContext.deinit();
 }
 
 }  // namespace Escher
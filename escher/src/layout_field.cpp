@@ -4,6 +4,7 @@
 #include <escher/text_field.h>
 #include <ion/events.h>
 #include <ion/keyboard/layout_events.h>
+#include <omg/instance_local.h>
 #include <poincare/code_point_layout.h>
 #include <poincare/expression.h>
 #include <poincare/horizontal_layout.h>
@@ -121,7 +122,8 @@ LayoutField::ContentView::ContentView(KDGlyph::Format format)
 /* TODO: This buffer could probably be shared with some other temporary
  * space. It can't be shared with the one from TextField if we want to remove
  * double buffering in TextField and still open the store menu within texts. */
-static char s_draftBuffer[AbstractTextField::MaxBufferSize()];
+static OMG_INSTANCE_LOCAL char
+    s_draftBuffer[AbstractTextField::MaxBufferSize()];
 
 LayoutField::LayoutField(Responder *parentResponder,
                          InputEventHandlerDelegate *inputEventHandlerDelegate,
@@ -1,5 +1,6 @@
 #include <assert.h>
 #include <escher/run_loop.h>
+#include <ion/timing.h>
 #include <kandinsky/font.h>
 #if ESCHER_LOG_EVENTS_NAME
 #include <ion/console.h>
@@ -17,6 +18,56 @@ Timer* RunLoop::timerAtIndex(int i) {
   return nullptr;
 }
 
+int RunLoop::numberOfIdleTasks() { return 0; }
+
+IdleTask* RunLoop::idleTaskAtIndex(int i) {
+  assert(false);
+  return nullptr;
+}
+
+/* Idle tasks give way to any upcoming event: a pressed key, or an event
+ * injected in the replayed journal (state files, engine API, fuzzer). */
+static bool EventIsPending() {
+#if ION_EVENTS_JOURNAL
+  if (Ion::Events::hasPendingReplayedEvent()) {
+    return true;
+  }
+#endif
+  return Ion::Keyboard::scan() != 0;
+}
+
+int RunLoop::runIdleTasks() {
+  uint64_t start = Ion::Timing::millis();
+  uint64_t elapsed = 0;
+  bool needsRedraw = false;
+  bool hasPendingTask = true;
+  while (hasPendingTask && elapsed < Timer::TickDuration && !EventIsPending()) {
+    /* Each pending task runs once per round, by decreasing priority, so that a
+     * long task does not starve the other ones. */
+    hasPendingTask = false;
+    for (int p = static_cast<int>(IdleTask::Priority::High);
+         p >= static_cast<int>(IdleTask::Priority::Low); p--) {
+      for (int i = 0; i < numberOfIdleTasks(); i++) {
+        IdleTask* task = idleTaskAtIndex(i);
+        if (!task->isPending() || static_cast<int>(task->priority()) != p) {
+          continue;
+        }
+        if (EventIsPending()) {
+          hasPendingTask = false;
+          break;
+        }
+        needsRedraw = task->run(EventIsPending) || needsRedraw;
+        hasPendingTask = hasPendingTask || task->isPending();
+      }
+    }
+    elapsed = Ion::Timing::millis() - start;
+  }
+  if (needsRedraw) {
+    dispatchEvent(Ion::Events::TimerFire);
+  }
+  return elapsed;
+}
+
 void RunLoop::run() { runWhile(nullptr, nullptr); }
 
 void RunLoop::runWhile(bool (*callback)(void* ctx), void* ctx) {
@@ -47,6 +98,13 @@ bool RunLoop::step() {
    * TickDuration.  The event returned can be None if nothing worth taking care
    * of happened. In other words, getEvent is a blocking call with a timeout. */
 
+  /* The user is inactive: perform the pending idle tasks. The time they take
+   * counts towards the timers. */
+  if ((event == Ion::Events::None || event == Ion::Events::Idle) &&
+      numberOfIdleTasks() > 0) {
+    eventDuration += runIdleTasks();
+  }
+
   m_time += eventDuration;
 
   if (m_time >= Timer::TickDuration) {
@@ -6,6 +6,7 @@ extern "C" {
 #include <assert.h>
 }
 #include <algorithm>
+#include <cstdlib>
 
 namespace Escher {
 
@@ -20,7 +21,10 @@ ScrollView::ScrollView(View *contentView, ScrollViewDataSource *dataSource)
       m_leftMargin(0),
       m_excessWidth(0),
       m_excessHeight(0),
-      m_backgroundColor(Palette::WallScreen) {
+      m_backgroundColor(Palette::WallScreen),
+      m_pendingScroll(KDPointZero),
+      m_pendingScrollIndicatorsFrame(KDRectZero),
+      m_scrollsByMovingPixels(true) {
   assert(m_dataSource != nullptr);
 }
 
@@ -183,9 +187,107 @@ void ScrollView::layoutSubviews(bool force) {
 }
 
 void ScrollView::setContentOffset(KDPoint offset) {
-  if (m_dataSource->setOffset(offset)) {
-    layoutSubviews();
+  KDPoint previousOffset = contentOffset();
+  if (!k_canScrollByMovingPixels || !m_scrollsByMovingPixels) {
+    if (m_dataSource->setOffset(offset)) {
+      layoutSubviews();
+    }
+    return;
+  }
+  if (offset == previousOffset) {
+    return;
+  }
+  /* The hierarchy is browsed before changing the offset, while it is still
+   * consistent with its last layout. */
+  KDRect previousInnerFrame = m_innerView.absoluteFrame();
+  KDSize previousContentSize = m_contentView->bounds().size();
+  KDRect previousDirtyRect = m_innerView.dirtyRectOfHierarchy();
+  if (m_pendingScroll == KDPointZero) {
+    m_pendingScrollIndicatorsFrame = indicatorsFrame();
+  }
+  if (!m_dataSource->setOffset(offset)) {
+    return;
+  }
+  layoutSubviews();
+  scrollPixels(previousOffset.relativeTo(contentOffset()), previousInnerFrame,
+               previousContentSize, previousDirtyRect);
+}
+
+KDRect ScrollView::indicatorsFrame() {
+  KDRect frame = KDRectZero;
+  int numberOfIndicators = numberOfSubviews();
+  for (int i = 1; i < numberOfIndicators; i++) {
+    frame = frame.unionedWith(subviewAtIndex(i)->absoluteFrame());
+  }
+  return frame.intersectedWith(m_innerView.absoluteFrame());
+}
+
+void ScrollView::scrollPixels(KDPoint delta, KDRect previousInnerFrame,
+                              KDSize previousContentSize,
+                              KDRect previousDirtyRect) {
+  KDRect innerFrame = m_innerView.absoluteFrame();
+  /* Indicators are drawn over the inner view: the pixels under them are not
+   * moved but redrawn. */
+  KDRect movableFrame =
+      innerFrame.differencedWith(m_pendingScrollIndicatorsFrame);
+  KDPoint pendingScroll = m_pendingScroll.translatedBy(delta);
+  if (innerFrame != previousInnerFrame ||
+      !(m_contentView->bounds().size() == previousContentSize) ||
+      movableFrame.intersects(m_pendingScrollIndicatorsFrame) ||
+      std::abs(pendingScroll.x()) >= movableFrame.width() ||
+      std::abs(pendingScroll.y()) >= movableFrame.height()) {
+    /* The content has been relayouted or has moved too far: nothing can be
+     * kept on screen. */
+    m_pendingScroll = KDPointZero;
+    m_innerView.markWholeFrameAsDirty();
+    return;
+  }
+  m_pendingScroll = pendingScroll;
+  /* Relayouting the content at its new offset dirtied it entirely, but the
+   * pixels on screen will be moved: only the newly exposed area and the
+   * pixels that were already dirty need to be redrawn. */
+  m_innerView.markHierarchyAsMoved();
+  m_innerView.markAbsoluteRectAsDirty(
+      movableFrame.differencedWith(movableFrame.translatedBy(delta)));
+  m_innerView.markAbsoluteRectAsDirty(
+      previousDirtyRect.intersectedWith(movableFrame).translatedBy(delta));
+  didScrollPixels();
+}
+
+KDRect ScrollView::moveScrolledPixels(KDContext *ctx, KDRect visibleRect,
+                                      KDRect forceRedrawRect) {
+  KDPoint delta = m_pendingScroll;
+  if (delta == KDPointZero) {
+    return KDRectZero;
+  }
+  m_pendingScroll = KDPointZero;
+  KDRect innerFrame = m_innerView.absoluteFrame();
+  if (forceRedrawRect.containsRect(innerFrame) ||
+      m_innerView.m_dirtyRect == innerFrame) {
+    // Everything is redrawn anyway
+    return KDRectZero;
+  }
+  if (!visibleRect.containsRect(innerFrame)) {
+    // Pixels moved from outside the visible rect would not be on screen
+    m_innerView.markWholeFrameAsDirty();
+    return KDRectZero;
+  }
+  KDRect movableFrame =
+      innerFrame.differencedWith(m_pendingScrollIndicatorsFrame);
+  KDRect movedRect =
+      movableFrame.intersectedWith(movableFrame.translatedBy(delta.opposite()));
+  ctx->setOrigin(KDPointZero);
+  ctx->setClippingRect(movableFrame);
+  ctx->copyRect(movedRect, movedRect.origin().translatedBy(delta));
+  if (!m_pendingScrollIndicatorsFrame.isEmpty()) {
+    /* The content under the indicators is redrawn separately, not to merge
+     * this area with the dirty rect. */
+    KDRect dirtyRect = m_innerView.m_dirtyRect;
+    m_innerView.m_dirtyRect = KDRectZero;
+    m_innerView.redraw(visibleRect, m_pendingScrollIndicatorsFrame);
+    m_innerView.m_dirtyRect = dirtyRect;
   }
+  return movedRect.translatedBy(delta);
 }
 
 KDRect ScrollView::layoutDecorator(bool force) {
@@ -280,4 +280,12 @@ void SelectableTableView::layoutSubviews(bool force) {
   }
 }
 
+void SelectableTableView::didScrollPixels() {
+  // The selected cell was highlighted at its new position by layoutSubviews
+  HighlightCell* cell = selectedCell();
+  if (cell) {
+    cell->reloadCell();
+  }
+}
+
 }  // namespace Escher
@@ -3,7 +3,8 @@
 
 namespace Escher {
 
-OMG::GlobalBox<TextCursorView> TextCursorView::sharedTextCursor;
+OMG_INSTANCE_LOCAL OMG::GlobalBox<TextCursorView>
+    TextCursorView::sharedTextCursor;
 
 void TextCursorView::CursorFieldView::layoutCursorSubview(bool force) {
   if (TextCursorView::sharedTextCursor->isInField(this)) {
@@ -38,6 +38,8 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
     return KDRectZero;
   }
   KDRect visibleRect = rect.intersectedWith(m_frame);
+  KDContext *ctx = KDIonContext::SharedContext;
+  KDRect updatedArea = willRedraw(ctx, visibleRect, forceRedrawRect);
   KDRect rectNeedingRedraw =
       visibleRect.intersectedWith(m_dirtyRect)
           .unionedWith(forceRedrawRect.intersectedWith(m_frame));
@@ -45,7 +47,6 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
   // This redraws the rectNeedingRedraw calling drawRect.
   if (!rectNeedingRedraw.isEmpty()) {
     KDPoint absOrigin = absoluteOrigin();
-    KDContext *ctx = KDIonContext::SharedContext;
     ctx->setOrigin(absOrigin);
     ctx->setClippingRect(rectNeedingRedraw);
     drawRect(ctx, rectNeedingRedraw.relativeTo(m_frame.origin()));
@@ -71,8 +72,39 @@ KDRect View::redraw(KDRect rect, KDRect forceRedrawRect) {
   // Eventually, mark that we don't need to be redrawn
   m_dirtyRect = KDRectZero;
 
-  // The function returns the total area that have been redrawn.
-  return redrawnArea;
+  /* The function returns the total area that have been redrawn, or updated
+   * without being drawn. */
+  return redrawnArea.unionedWith(updatedArea);
+}
+
+KDRect View::dirtyRectOfHierarchy() {
+  KDRect dirtyRect = m_dirtyRect;
+  uint8_t subviewsNumber = numberOfSubviews();
+  for (uint8_t i = 0; i < subviewsNumber; i++) {
+    View *subview = subviewAtIndex(i);
+    if (subview == nullptr) {
+      continue;
+    }
+    dirtyRect = dirtyRect.unionedWith(subview->dirtyRectOfHierarchy());
+  }
+  return dirtyRect;
+}
+
+void View::markHierarchyAsMoved() {
+  if (drawingDependsOnRect()) {
+    // Redrawing the view also redraws its subviews
+    markWholeFrameAsDirty();
+    return;
+  }
+  m_dirtyRect = KDRectZero;
+  uint8_t subviewsNumber = numberOfSubviews();
+  for (uint8_t i = 0; i < subviewsNumber; i++) {
+    View *subview = subviewAtIndex(i);
+    if (subview == nullptr) {
+      continue;
+    }
+    subview->markHierarchyAsMoved();
+  }
 }
 
 void View::setSize(KDSize size) {
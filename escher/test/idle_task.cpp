@@ -0,0 +1,126 @@
+#include <escher/idle_task.h>
+#include <escher/run_loop.h>
+#include <quiz.h>
+
+using namespace Escher;
+
+class CountingTask : public IdleTask {
+ public:
+  CountingTask(Priority priority, int numberOfSteps, int* log, int* logLength,
+               int id)
+      : IdleTask(priority),
+        m_remainingSteps(numberOfSteps),
+        m_log(log),
+        m_logLength(logLength),
+        m_id(id) {}
+  int remainingSteps() const { return m_remainingSteps; }
+
+ private:
+  bool step() override {
+    m_log[(*m_logLength)++] = m_id;
+    return --m_remainingSteps > 0;
+  }
+  int m_remainingSteps;
+  int* m_log;
+  int* m_logLength;
+  int m_id;
+};
+
+class TestRunLoop : public RunLoop {
+ public:
+  TestRunLoop(IdleTask** tasks, int numberOfTasks)
+      : m_tasks(tasks), m_numberOfTasks(numberOfTasks), m_numberOfRedraws(0) {}
+  using RunLoop::runIdleTasks;
+  int numberOfRedraws() const { return m_numberOfRedraws; }
+
+ private:
+  bool dispatchEvent(Ion::Events::Event e) override {
+    m_numberOfRedraws += e == Ion::Events::TimerFire;
+    return true;
+  }
+  int numberOfIdleTasks() override { return m_numberOfTasks; }
+  IdleTask* idleTaskAtIndex(int i) override { return m_tasks[i]; }
+
+  IdleTask** m_tasks;
+  int m_numberOfTasks;
+  int m_numberOfRedraws;
+};
+
+static bool alwaysYield() { return true; }
+
+QUIZ_CASE(escher_idle_task_run) {
+  int log[16];
+  int logLength = 0;
+  CountingTask task(IdleTask::Priority::Normal, 3, log, &logLength, 0);
+  quiz_assert(!task.isPending());
+  task.schedule();
+  // Yielding still lets one step run
+  quiz_assert(!task.run(alwaysYield));
+  quiz_assert(task.isPending() && task.numberOfSteps() == 1);
+  quiz_assert(task.run(nullptr));
+  quiz_assert(!task.isPending() && task.numberOfSteps() == 3);
+  quiz_assert(task.remainingSteps() == 0 && logLength == 3);
+  task.resetTimeAccounting();
+  quiz_assert(task.numberOfSteps() == 0 && task.elapsedTime() == 0);
+}
+
+QUIZ_CASE(escher_idle_task_run_loop) {
+  int log[16];
+  int logLength = 0;
+  CountingTask low(IdleTask::Priority::Low, 2, log, &logLength, 0);
+  CountingTask high(IdleTask::Priority::High, 2, log, &logLength, 1);
+  CountingTask idle(IdleTask::Priority::High, 2, log, &logLength, 2);
+  IdleTask* tasks[] = {&low, &high, &idle};
+  TestRunLoop runLoop(tasks, 3);
+
+  // Nothing to do
+  runLoop.runIdleTasks();
+  quiz_assert(logLength == 0 && runLoop.numberOfRedraws() == 0);
+
+  low.schedule();
+  high.schedule();
+  runLoop.runIdleTasks();
+  quiz_assert(!low.isPending() && !high.isPending() && !idle.isPending());
+  quiz_assert(runLoop.numberOfRedraws() == 1);
+  // Higher priorities first
+  quiz_assert(logLength == 4 && log[0] == 1 && log[1] == 1 && log[2] == 0 &&
+              log[3] == 0);
+  quiz_assert(idle.numberOfSteps() == 0);
+}
+
+#if ION_EVENTS_JOURNAL
+class SingleEventJournal : public Ion::Events::Journal {
+ public:
+  void pushEvent(Ion::Events::Event e) override { m_event = e; }
+  Ion::Events::Event popEvent() override {
+    Ion::Events::Event e = m_event;
+    m_event = Ion::Events::None;
+    return e;
+  }
+  bool isEmpty() override { return m_event == Ion::Events::None; }
+
+ private:
+  Ion::Events::Event m_event = Ion::Events::None;
+};
+
+QUIZ_CASE(escher_idle_task_preempted_by_replayed_event) {
+  int log[16];
+  int logLength = 0;
+  CountingTask task(IdleTask::Priority::Normal, 2, log, &logLength, 0);
+  IdleTask* tasks[] = {&task};
+  TestRunLoop runLoop(tasks, 1);
+
+  SingleEventJournal journal;
+  journal.pushEvent(Ion::Events::OK);
+  Ion::Events::replayFrom(&journal);
+  task.schedule();
+  runLoop.runIdleTasks();
+  // The replayed event comes first
+  quiz_assert(task.isPending() && logLength == 0);
+
+  journal.popEvent();
+  runLoop.runIdleTasks();
+  quiz_assert(!task.isPending() && logLength == 2);
+  Ion::Events::replayFrom(nullptr);
+}
+#endif
@@ -21,6 +21,9 @@ namespace Display {
 void pushRect(KDRect r, const KDColor* pixels);
 void pushRectUniform(KDRect r, KDColor c);
 void pullRect(KDRect r, KDColor* pixels);
+/* Move the pixels of r on screen so that its top left corner lands on
+ * destination. Both rects must be on screen and may overlap. */
+void copyRect(KDRect r, KDPoint destination);
 
 bool waitForVBlank();
 
@@ -76,6 +76,9 @@ class Journal {
 
 void replayFrom(Journal* l);
 void logTo(Journal* l);
+/* Return true if the journal being replayed still holds events, which getEvent
+ * will return before any key press. */
+bool hasPendingReplayedEvent();
 #endif
 
 enum class ShiftAlphaStatus : uint8_t {
@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <ion/unicode/utf8_helper.h>
 #include <omg/global_box.h>
+#include <omg/instance_local.h>
 
 #include "record.h"
 #include "record_name_verifier.h"
@@ -32,13 +33,18 @@ class FileSystem {
   static_assert(UINT16_MAX >= k_storageSize - 1,
                 "record_size_t not big enough");
 
-  static OMG::GlobalBox<FileSystem> sharedFileSystem;
+  static OMG_INSTANCE_LOCAL OMG::GlobalBox<FileSystem> sharedFileSystem;
 
 #if ION_STORAGE_LOG
   void log();
 #endif
 
   size_t availableSize();
+  // Records as laid out above, without the magics and up to the null size
+  const char *records() const { return m_buffer; }
+  size_t sizeOfRecords() {
+    return endBuffer() - m_buffer + sizeof(record_size_t);
+  }
   size_t putAvailableSpaceAtEndOfRecord(Record r);
   void getAvailableSpaceFromEndOfRecord(Record r, size_t recordAvailableSpace);
   uint32_t checksum();
@@ -1,3 +1,4 @@
+#include <assert.h>
 #include <drivers/display.h>
 #include <drivers/svcall.h>
 #include <ion/display.h>
@@ -18,6 +19,20 @@ void SVC_ATTRIBUTES pullRect(KDRect r, KDColor* pixels) {
   SVC_RETURNING_VOID(SVC_DISPLAY_PULL_RECT)
 }
 
+void copyRect(KDRect r, KDPoint destination) {
+  /* The display controller cannot move pixels by itself: they are pulled and
+   * pushed back one line at a time, from the last line if they move down so
+   * that no line is overwritten before it is read. */
+  assert(r.width() <= Width);
+  KDColor line[Width];
+  bool downwards = destination.y() > r.y();
+  for (KDCoordinate j = 0; j < r.height(); j++) {
+    KDCoordinate y = downwards ? r.height() - 1 - j : j;
+    pullRect(KDRect(r.x(), r.y() + y, r.width(), 1), line);
+    pushRect(KDRect(destination.x(), destination.y() + y, r.width(), 1), line);
+  }
+}
+
 bool SVC_ATTRIBUTES waitForVBlank() {
   SVC_RETURNING_R0(SVC_DISPLAY_WAIT_FOR_V_BLANK, bool)
 }
@@ -1,9 +1,10 @@
 #include <ion/usb.h>
+#include <omg/instance_local.h>
 
 namespace Ion {
 namespace USB {
 
-bool s_plugged = false;
+OMG_INSTANCE_LOCAL bool s_plugged = false;
 
 bool isPlugged() { return s_plugged; }
 
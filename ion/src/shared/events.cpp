@@ -17,7 +17,7 @@ extern "C" {
 namespace Ion {
 namespace Events {
 
-OMG::GlobalBox<State> SharedState;
+OMG_INSTANCE_LOCAL OMG::GlobalBox<State> SharedState;
 
 // Implementation of public Ion::Events functions
 
@@ -4,6 +4,7 @@
 #include <ion/events.h>
 #include <ion/keyboard.h>
 #include <omg/global_box.h>
+#include <omg/instance_local.h>
 
 namespace Ion {
 namespace Events {
@@ -33,7 +34,7 @@ class State {
   bool m_idleWasSent;
 };
 
-extern OMG::GlobalBox<State> SharedState;
+extern OMG_INSTANCE_LOCAL OMG::GlobalBox<State> SharedState;
 
 // Functions defined in events.cpp
 Event sharedGetEvent(int* timeout);
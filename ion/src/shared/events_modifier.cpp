@@ -5,7 +5,7 @@
 namespace Ion {
 namespace Events {
 
-OMG::GlobalBox<ModifierState> SharedModifierState;
+OMG_INSTANCE_LOCAL OMG::GlobalBox<ModifierState> SharedModifierState;
 
 // Implementation of public Ion::Events functions
 
@@ -3,6 +3,7 @@
 
 #include <ion/events.h>
 #include <omg/global_box.h>
+#include <omg/instance_local.h>
 
 namespace Ion {
 namespace Events {
@@ -41,7 +42,7 @@ class ModifierState {
                             // (Raw value)
 };
 
-extern OMG::GlobalBox<ModifierState> SharedModifierState;
+extern OMG_INSTANCE_LOCAL OMG::GlobalBox<ModifierState> SharedModifierState;
 
 }  // namespace Events
 }  // namespace Ion
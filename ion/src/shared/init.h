@@ -4,6 +4,9 @@
 namespace Ion {
 
 void Init();
+/* Tear down the globals set up by Init, so that Init can be called again. Only
+ * the simulator, which runs several fuzzer inputs in one process, needs it. */
+void Shutdown();
 
 }
 
@@ -1,6 +1,7 @@
 #include "keyboard.h"
 
 #include <ion/keyboard.h>
+#include <omg/instance_local.h>
 
 #include "events.h"
 #include "keyboard_queue.h"
@@ -15,7 +16,7 @@ State popState() {
   return Queue::sharedQueue()->queuePop();
 }
 
-State sState(0);
+OMG_INSTANCE_LOCAL State sState(0);
 
 void resetMemoizedState() { sState = 0; }
 
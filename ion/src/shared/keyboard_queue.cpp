@@ -1,5 +1,7 @@
 #include "keyboard_queue.h"
 
+#include <omg/instance_local.h>
+
 #include "events.h"
 #include "keyboard.h"
 
@@ -7,7 +9,7 @@ namespace Ion {
 namespace Keyboard {
 
 Queue* Queue::sharedQueue() {
-  static Queue sQueue;
+  static OMG_INSTANCE_LOCAL Queue sQueue;
   return &sQueue;
 }
 
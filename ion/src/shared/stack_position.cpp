@@ -1,9 +1,10 @@
 #include <ion.h>
+#include <omg/instance_local.h>
 
 namespace Ion {
 
 // Stack start will be defined in ion_main.
-static void* s_stackStart = nullptr;
+static OMG_INSTANCE_LOCAL void* s_stackStart = nullptr;
 
 void* stackStart() {
   assert(s_stackStart != nullptr);
@@ -12,7 +12,7 @@ namespace Ion {
 
 namespace Storage {
 
-OMG::GlobalBox<FileSystem> FileSystem::sharedFileSystem;
+OMG_INSTANCE_LOCAL OMG::GlobalBox<FileSystem> FileSystem::sharedFileSystem;
 
 // STORAGE
 
@@ -2,6 +2,7 @@
 #include <assert.h>
 #include <ion/src/simulator/linux/platform_images.h>
 #include <jpeglib.h>
+#include <kandinsky/pixel_kernels.h>
 #include <png.h>
 #include <stdlib.h>
 
@@ -174,19 +175,6 @@ SDL_Texture *loadImage(SDL_Renderer *renderer, const char *identifier) {
   return texture;
 }
 
-class RGB888Pixel {
- public:
-  RGB888Pixel() {}
-  RGB888Pixel(KDColor c)
-      : m_red(c.red()), m_green(c.green()), m_blue(c.blue()) {}
-
- private:
-  uint8_t m_red;
-  uint8_t m_green;
-  uint8_t m_blue;
-};
-static_assert(sizeof(RGB888Pixel) == 3, "RGB888Pixel shall be 3 bytes long");
-
 void saveImage(const KDColor *pixels, int width, int height, const char *path) {
   FILE *file = fopen(path, "wb");  // Write in binary mode
 
@@ -202,12 +190,10 @@ void saveImage(const KDColor *pixels, int width, int height, const char *path) {
 
   png_write_info(png, info);
 
-  RGB888Pixel *row = new RGB888Pixel[3 * width];
+  uint8_t *row = new uint8_t[3 * width];
   for (int j = 0; j < height; j++) {
-    for (int i = 0; i < width; i++) {
-      row[i] = RGB888Pixel(pixels[i + width * j]);
-    }
-    png_write_row(png, reinterpret_cast<png_bytep>(row));
+    KDPixelKernels::ConvertToRGB888(pixels + width * j, row, width);
+    png_write_row(png, row);
   }
   delete[] row;
 
@@ -1,19 +1,21 @@
 #include <assert.h>
 #include <ion/circuit_breaker.h>
+#include <omg/instance_local.h>
 
 namespace Ion {
 namespace CircuitBreaker {
 
-Status sStatus = Status::Interrupted;
+OMG_INSTANCE_LOCAL Status sStatus = Status::Interrupted;
 constexpr static int k_numberOfCheckpointTypes =
     static_cast<uint8_t>(CheckpointType::NumberOfCheckpoints);  // 3
-bool sCheckpointsSet[k_numberOfCheckpointTypes] = {false, false, false};
-jmp_buf sBuffers[k_numberOfCheckpointTypes];
-jmp_buf sDummyBuffer;
+OMG_INSTANCE_LOCAL bool sCheckpointsSet[k_numberOfCheckpointTypes] = {
+    false, false, false};
+OMG_INSTANCE_LOCAL jmp_buf sBuffers[k_numberOfCheckpointTypes];
+OMG_INSTANCE_LOCAL jmp_buf sDummyBuffer;
 
-int sNumberOfLocks = 0;
-bool sLoadCheckpointInterrupted = false;
-CheckpointType sLockedCheckpointType;
+OMG_INSTANCE_LOCAL int sNumberOfLocks = 0;
+OMG_INSTANCE_LOCAL bool sLoadCheckpointInterrupted = false;
+OMG_INSTANCE_LOCAL CheckpointType sLockedCheckpointType;
 
 Status status() { return sStatus; }
 
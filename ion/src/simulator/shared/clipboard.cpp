@@ -1,5 +1,6 @@
 #include <ion.h>
 #include <ion/clipboard.h>
+#include <omg/instance_local.h>
 #include <string.h>
 
 #include "clipboard_helper.h"
@@ -8,10 +9,10 @@
 namespace Ion {
 namespace Clipboard {
 
-static char s_buffer[k_bufferSize] = {'\0'};
+static OMG_INSTANCE_LOCAL char s_buffer[k_bufferSize] = {'\0'};
 char *buffer() { return s_buffer; }
 
-uint32_t localClipboardVersion;
+OMG_INSTANCE_LOCAL uint32_t localClipboardVersion;
 
 void write(const char *text) {
   if (Simulator::Window::isHeadless()) {
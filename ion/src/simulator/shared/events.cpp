@@ -10,6 +10,7 @@
 #include <ion/src/shared/keyboard.h>
 #include <ion/src/shared/keyboard_queue.h>
 #include <ion/timing.h>
+#include <omg/instance_local.h>
 
 #include <algorithm>
 
@@ -30,7 +31,7 @@ namespace Events {
 // ion/src/simulator/shared/events.h
 
 char *sharedExternalTextBuffer() {
-  static char buffer[sharedExternalTextBufferSize];
+  static OMG_INSTANCE_LOCAL char buffer[sharedExternalTextBufferSize];
   return buffer;
 }
 
@@ -75,10 +76,13 @@ const char *Event::text() const {
 
 #if ION_EVENTS_JOURNAL
 
-static Journal *sSourceJournal = nullptr;
-static Journal *sDestinationJournal = nullptr;
+static OMG_INSTANCE_LOCAL Journal *sSourceJournal = nullptr;
+static OMG_INSTANCE_LOCAL Journal *sDestinationJournal = nullptr;
 void replayFrom(Journal *l) { sSourceJournal = l; }
 void logTo(Journal *l) { sDestinationJournal = l; }
+bool hasPendingReplayedEvent() {
+  return sSourceJournal != nullptr && !sSourceJournal->isEmpty();
+}
 
 Event getEvent(int *timeout) {
   Event res = Events::None;
@@ -3,6 +3,7 @@
 #include <ion/display.h>
 #include <kandinsky/color.h>
 #include <kandinsky/framebuffer.h>
+#include <omg/instance_local.h>
 
 #include "window.h"
 
@@ -17,13 +18,14 @@
  * This is also very useful when running headless because we can easily log the
  * framebuffer to a PNG file. */
 
-static KDColor sPixels[Ion::Display::Width * Ion::Display::Height];
-static bool sFrameBufferActive = false;
+static OMG_INSTANCE_LOCAL KDColor
+    sPixels[Ion::Display::Width * Ion::Display::Height];
+static OMG_INSTANCE_LOCAL bool sFrameBufferActive = false;
 
 namespace Ion {
 namespace Display {
 
-static KDFrameBuffer sFrameBuffer =
+static OMG_INSTANCE_LOCAL KDFrameBuffer sFrameBuffer =
     KDFrameBuffer(sPixels, KDSize(Width, Height));
 
 void pushRect(KDRect r, const KDColor* pixels) {
@@ -46,6 +48,13 @@ void pullRect(KDRect r, KDColor* pixels) {
   }
 }
 
+void copyRect(KDRect r, KDPoint destination) {
+  if (sFrameBufferActive) {
+    Simulator::Window::setNeedsRefresh();
+    sFrameBuffer.copyRect(r, destination);
+  }
+}
+
 }  // namespace Display
 }  // namespace Ion
 
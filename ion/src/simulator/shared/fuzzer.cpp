@@ -0,0 +1,156 @@
+#include "fuzzer.h"
+
+#include <dirent.h>
+#include <ion.h>
+#include <ion/persisting_bytes.h>
+#include <ion/src/shared/init.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include <chrono>
+#include <iterator>
+#include <vector>
+
+#include "journal.h"
+#include "state_file.h"
+
+#ifdef __AFL_FUZZ_TESTCASE_LEN
+__AFL_FUZZ_INIT();
+#endif
+
+namespace Ion {
+namespace Simulator {
+namespace Fuzzer {
+
+/* Inputs are replayed in english, whatever the language of the state file
+ * header, so that crashes can be reproduced. */
+constexpr static const char* k_arguments[] = {"epsilon", "--language", "en"};
+constexpr static const char* k_stateFileMagic = "NWSF";
+constexpr static size_t k_stateFileMagicLength = 4;
+// Restart the process from time to time, in case some state leaks
+constexpr static int k_numberOfPersistentIterations = 10000;
+
+static void resetReplayJournal() {
+  /* The previous input may have stopped before replaying all its events, for
+   * instance by switching the calculator off. */
+  Ion::Events::Journal* journal = Journal::replayJournal();
+  while (!journal->isEmpty()) {
+    journal->popEvent();
+  }
+  journal->setStartingLanguage("");
+}
+
+bool runInput(const uint8_t* data, size_t size) {
+  resetReplayJournal();
+  bool hasHeader = size >= k_stateFileMagicLength &&
+                   memcmp(data, k_stateFileMagic, k_stateFileMagicLength) == 0;
+  if (!StateFile::loadMemory(reinterpret_cast<const char*>(data), size,
+                             !hasHeader)) {
+    /* A truncated header, or the header of another version: skip the input
+     * rather than running the events of the previous one. */
+    return false;
+  }
+  // Reset the state that lives outside of the GlobalBoxes
+  srand(0);
+  PersistingBytes::write(0);
+  /* The simulator is headless: the run loop terminates once the events are
+   * all replayed. */
+  Ion::Init();
+  ion_main(std::size(k_arguments), k_arguments);
+  Ion::Shutdown();
+  return true;
+}
+
+static bool readFile(FILE* f, std::vector<uint8_t>* buffer) {
+  buffer->clear();
+  int c;
+  while ((c = getc(f)) != EOF) {
+    buffer->push_back(c);
+  }
+  return !ferror(f);
+}
+
+static int runFile(const char* path, std::vector<uint8_t>* buffer) {
+  FILE* f = fopen(path, "rb");
+  if (f == nullptr) {
+    fprintf(stderr, "Error opening fuzzer input %s\n", path);
+    return 0;
+  }
+  bool read = readFile(f, buffer);
+  fclose(f);
+  if (!read) {
+    fprintf(stderr, "Error reading fuzzer input %s\n", path);
+    return 0;
+  }
+  return runInput(buffer->data(), buffer->size());
+}
+
+static int runDirectory(DIR* directory, const char* path,
+                        std::vector<uint8_t>* buffer) {
+  int executions = 0;
+  while (struct dirent* entry = readdir(directory)) {
+    if (entry->d_name[0] == '.') {
+      continue;
+    }
+    std::vector<char> filePath(strlen(path) + strlen(entry->d_name) + 2);
+    snprintf(filePath.data(), filePath.size(), "%s/%s", path, entry->d_name);
+    executions += runFile(filePath.data(), buffer);
+  }
+  return executions;
+}
+
+static int runStandardInput(std::vector<uint8_t>* buffer) {
+#ifdef __AFL_FUZZ_TESTCASE_LEN
+  /* Persistent mode: AFL feeds the inputs through shared memory and the
+   * process is only forked once every k_numberOfPersistentIterations. */
+  (void)buffer;
+  int executions = 0;
+  __AFL_INIT();
+  const uint8_t* data = __AFL_FUZZ_TESTCASE_BUF;
+  while (__AFL_LOOP(k_numberOfPersistentIterations)) {
+    executions += runInput(data, __AFL_FUZZ_TESTCASE_LEN);
+  }
+  return executions;
+#else
+  if (!readFile(stdin, buffer)) {
+    return 0;
+  }
+  return runInput(buffer->data(), buffer->size());
+#endif
+}
+
+int run(const char* const* inputs, int numberOfInputs) {
+  std::vector<uint8_t> buffer;
+  int executions = 0;
+  auto start = std::chrono::steady_clock::now();
+  for (int i = 0; i < numberOfInputs; i++) {
+    const char* input = inputs[i];
+    if (strcmp(input, "-") == 0) {
+      executions += runStandardInput(&buffer);
+      continue;
+    }
+    DIR* directory = opendir(input);
+    if (directory != nullptr) {
+      executions += runDirectory(directory, input, &buffer);
+      closedir(directory);
+    } else {
+      executions += runFile(input, &buffer);
+    }
+  }
+  std::chrono::duration<double> duration =
+      std::chrono::steady_clock::now() - start;
+  fprintf(stderr, "%d executions in %.3f s (%.1f exec/s)\n", executions,
+          duration.count(),
+          duration.count() > 0. ? executions / duration.count() : 0.);
+  return 0;
+}
+
+}  // namespace Fuzzer
+}  // namespace Simulator
+}  // namespace Ion
+
+int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size) {
+  // Inputs that fail to load are not added to the corpus
+  return Ion::Simulator::Fuzzer::runInput(data, size) ? 0 : -1;
+}
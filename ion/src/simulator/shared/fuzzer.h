@@ -0,0 +1,34 @@
+#ifndef ION_SIMULATOR_FUZZER_H
+#define ION_SIMULATOR_FUZZER_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/* The fuzzer runs many inputs in a single process. Between two inputs, all the
+ * globals are reset through their GlobalBox, which is much cheaper than
+ * spawning a new simulator for each input.
+ * An input is a sequence of event bytes, optionally preceded by a state file
+ * header so that state files can be used as seeds. */
+
+namespace Ion {
+namespace Simulator {
+namespace Fuzzer {
+
+/* Return false, without running anything, if the input starts with a state
+ * file header that cannot be loaded. */
+bool runInput(const uint8_t* data, size_t size);
+
+/* Run each input, which is either a file, a directory of files or "-". The
+ * latter reads the inputs fed by AFL in persistent mode when built with the
+ * afl toolchain, and a single input from stdin otherwise. Print the number of
+ * executed inputs per second on stderr. */
+int run(const char* const* inputs, int numberOfInputs);
+
+}  // namespace Fuzzer
+}  // namespace Simulator
+}  // namespace Ion
+
+// libFuzzer compatible entry point
+extern "C" int LLVMFuzzerTestOneInput(const uint8_t* data, size_t size);
+
+#endif
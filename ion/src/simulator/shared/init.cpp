@@ -10,4 +10,10 @@ void Init() {
   Storage::FileSystem::sharedFileSystem.init();
 }
 
+void Shutdown() {
+  Storage::FileSystem::sharedFileSystem.deinit();
+  Events::SharedState.deinit();
+  Events::SharedModifierState.deinit();
+}
+
 }  // namespace Ion
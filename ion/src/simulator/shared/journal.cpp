@@ -1,5 +1,7 @@
 #include "journal.h"
 
+#include <omg/instance_local.h>
+
 #include <queue>
 
 #include "journal/queue_journal.h"
@@ -11,12 +13,12 @@ namespace Journal {
 void init() { Events::logTo(logJournal()); }
 
 Events::Journal* replayJournal() {
-  static QueueJournal journal;
+  static OMG_INSTANCE_LOCAL QueueJournal journal;
   return &journal;
 }
 
 Events::Journal* logJournal() {
-  static QueueJournal journal;
+  static OMG_INSTANCE_LOCAL QueueJournal journal;
   return &journal;
 }
 
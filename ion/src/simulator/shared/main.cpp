@@ -22,6 +22,7 @@
 #include <stdio.h>
 
 #include "actions.h"
+#include "fuzzer.h"
 #include "screenshot.h"
 extern "C" {
 extern char *eadk_external_data;
@@ -34,6 +35,7 @@ constexpr static const char *k_loadStateFileKeys[] = {"--load-state-file",
                                                       "-l"};
 constexpr static const char *k_headlessFlags[] = {"--headless", "-h"};
 constexpr static const char *k_languageFlag = "--language";
+constexpr static const char *k_fuzzKey = "--fuzz";
 
 /* The Args class allows parsing and editing command-line arguments
  * The editing part allows us to add/remove arguments before forwarding them to
@@ -165,6 +167,17 @@ int main(int argc, char *argv[]) {
 #endif
 
 #if ION_SIMULATOR_FILES
+  /* Fuzz in-process, without window:
+   * $ ./epsilon.bin --fuzz tests/fuzzer_seeds
+   * $ afl-fuzz -i tests/fuzzer_seeds -o findings -- ./epsilon.bin --fuzz - */
+  std::vector<const char *> fuzzerInputs;
+  while (const char *input = args.pop(k_fuzzKey)) {
+    fuzzerInputs.push_back(input);
+  }
+  if (!fuzzerInputs.empty()) {
+    return Fuzzer::run(fuzzerInputs.data(), fuzzerInputs.size());
+  }
+
   const char *stateFile =
       args.pop(k_loadStateFileKeys, std::size(k_loadStateFileKeys));
   if (stateFile) {
@@ -248,6 +261,7 @@ int main(int argc, char *argv[]) {
 #endif
     Ion::Init();
     ion_main(args.argc(), args.argv());
+    Ion::Shutdown();
 #if ION_SIMULATOR_FILES
   }
 #endif
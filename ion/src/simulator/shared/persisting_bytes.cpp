@@ -1,10 +1,11 @@
 #include <assert.h>
 #include <ion/persisting_bytes.h>
+#include <omg/instance_local.h>
 
 namespace Ion {
 namespace PersistingBytes {
 
-PersistingBytesInt s_persistedBytes = 0;
+OMG_INSTANCE_LOCAL PersistingBytesInt s_persistedBytes = 0;
 
 void write(PersistingBytesInt value) { s_persistedBytes = value; }
 
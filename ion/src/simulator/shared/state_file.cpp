@@ -4,6 +4,7 @@
 #include <string.h>
 
 #include "journal.h"
+#include "state_file.h"
 
 namespace Ion {
 namespace Simulator {
@@ -107,16 +108,16 @@ void load(const char* filename, bool headlessStateFile) {
   }
 }
 
-void loadMemory(const char* buffer, size_t length, bool headlessStateFile) {
+bool loadMemory(const char* buffer, size_t length, bool headlessStateFile) {
   const uint8_t* e;
   if (headlessStateFile) {
     e = reinterpret_cast<const uint8_t*>(buffer);
   } else {
     if (length < sHeaderLength) {
-      return;
+      return false;
     }
     if (!loadFileHeader(buffer)) {
-      return;
+      return false;
     }
     e = reinterpret_cast<const uint8_t*>(buffer + sHeaderLength);
   }
@@ -125,6 +126,7 @@ void loadMemory(const char* buffer, size_t length, bool headlessStateFile) {
     pushEvent(*e++);
   }
   Ion::Events::replayFrom(Journal::replayJournal());
+  return true;
 }
 
 static inline bool save(FILE* f) {
@@ -1,6 +1,8 @@
 #ifndef ION_SIMULATOR_STATE_FILE_H
 #define ION_SIMULATOR_STATE_FILE_H
 
+#include <stddef.h>
+
 namespace Ion {
 namespace Simulator {
 namespace StateFile {
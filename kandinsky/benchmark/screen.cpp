@@ -0,0 +1,127 @@
+#include <ion/display.h>
+#include <kandinsky/context.h>
+#include <kandinsky/framebuffer.h>
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+
+#include <cmath>
+
+/* Microbenchmark of the kandinsky rect kernels
+ *
+ * Redraw a full screen of text and plot patterns many times into an
+ * off-screen frame buffer, and print the time spent for each pattern. On the
+ * simulator, run it with:
+ *   make benchmark.kandinsky.bin
+ *   output/release/simulator/<target>/benchmark.kandinsky.bin --headless */
+
+constexpr static int k_numberOfFrames = 1000;
+constexpr static KDCoordinate k_dotDiameter = 7;
+
+class FrameBufferContext : public KDContext {
+ public:
+  FrameBufferContext(KDFrameBuffer* frameBuffer)
+      : KDContext(KDPointZero, frameBuffer->bounds()),
+        m_frameBuffer(frameBuffer) {}
+
+ private:
+  void pushRect(KDRect rect, const KDColor* pixels) override {
+    m_frameBuffer->pushRect(rect, pixels);
+  }
+  void pushRectUniform(KDRect rect, KDColor color) override {
+    m_frameBuffer->pushRectUniform(rect, color);
+  }
+  void pullRect(KDRect rect, KDColor* pixels) override {
+    m_frameBuffer->pullRect(rect, pixels);
+  }
+  KDFrameBuffer* m_frameBuffer;
+};
+
+static KDColor s_pixels[Ion::Display::Width * Ion::Display::Height];
+
+static void drawText(KDContext* ctx, int frame) {
+  ctx->fillRect(ctx->clippingRect(), KDColorWhite);
+  const char* text = "sin(x)+1/2 = 0.97942553860420 f(x) = x^2-3x+1";
+  KDFont::Size font =
+      frame % 2 == 0 ? KDFont::Size::Large : KDFont::Size::Small;
+  KDCoordinate lineHeight = KDFont::GlyphHeight(font);
+  for (KDCoordinate y = 0; y < Ion::Display::Height; y += lineHeight) {
+    ctx->drawString(text, KDPoint(-(y + frame) % 40, y),
+                    {.glyphColor = KDColorBlack,
+                     .backgroundColor = KDColorWhite,
+                     .font = font});
+  }
+}
+
+static void drawPlot(KDContext* ctx, int frame) {
+  constexpr KDColor gridColor = KDColor::RGB24(0xEEEEEE);
+  constexpr KDColor curveColor = KDColor::RGB24(0x1A7CF2);
+  ctx->fillRect(ctx->clippingRect(), KDColorWhite);
+  for (KDCoordinate x = frame % 16; x < Ion::Display::Width; x += 16) {
+    ctx->fillRect(KDRect(x, 0, 1, Ion::Display::Height), gridColor);
+  }
+  for (KDCoordinate y = 0; y < Ion::Display::Height; y += 16) {
+    ctx->fillRect(KDRect(0, y, Ion::Display::Width, 1), gridColor);
+  }
+
+  // Antialiased curve
+  float phase = frame * 0.1f;
+  float previousY = 0.0f;
+  for (int x = 0; x <= Ion::Display::Width; x += 2) {
+    float y = Ion::Display::Height / 2 *
+              (1.0f + 0.8f * std::sin(x * 0.03f + phase));
+    if (x > 0) {
+      ctx->drawAntialiasedLine(x - 2, previousY, x, y, curveColor,
+                               KDColorWhite);
+    }
+    previousY = y;
+  }
+
+  // Dots, stamped with a mask like the plot views do
+  uint8_t mask[k_dotDiameter * k_dotDiameter];
+  constexpr float radius = k_dotDiameter / 2.0f;
+  for (int j = 0; j < k_dotDiameter; j++) {
+    for (int i = 0; i < k_dotDiameter; i++) {
+      float distance = std::hypot(i + 0.5f - radius, j + 0.5f - radius);
+      float coverage = std::fmin(1.0f, std::fmax(0.0f, radius - distance));
+      mask[j * k_dotDiameter + i] = 0xFF * (1.0f - coverage);
+    }
+  }
+  KDColor workingBuffer[k_dotDiameter * k_dotDiameter];
+  for (int x = 0; x < Ion::Display::Width; x += 5) {
+    KDCoordinate y = Ion::Display::Height / 2 *
+                     (1.0f + 0.8f * std::cos(x * 0.02f + phase));
+    ctx->blendRectWithMask(KDRect(x, y, k_dotDiameter, k_dotDiameter),
+                           KDColorRed, mask, workingBuffer);
+  }
+
+  // Histogram bars, drawn with an opaque mask
+  for (int x = 0; x + k_dotDiameter < Ion::Display::Width; x += 12) {
+    for (KDCoordinate y = Ion::Display::Height - k_dotDiameter;
+         y > Ion::Display::Height / 2 + (x * 7 + frame) % 100;
+         y -= k_dotDiameter) {
+      ctx->fillRectWithMask(KDRect(x, y, k_dotDiameter, k_dotDiameter),
+                            KDColorOrange, gridColor, mask, workingBuffer);
+    }
+  }
+}
+
+static void benchmark(const char* name,
+                      void (*draw)(KDContext* ctx, int frame)) {
+  KDFrameBuffer frameBuffer(s_pixels,
+                            KDSize(Ion::Display::Width, Ion::Display::Height));
+  FrameBufferContext context(&frameBuffer);
+  quiz_print(name);
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int frame = 0; frame < k_numberOfFrames; frame++) {
+    draw(&context, frame);
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(kandinsky_benchmark_text) {
+  benchmark("1000 screens of text", drawText);
+}
+
+QUIZ_CASE(kandinsky_benchmark_plot) {
+  benchmark("1000 screens of plot", drawPlot);
+}
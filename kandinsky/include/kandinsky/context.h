@@ -40,6 +40,10 @@ class KDContext {
   void blendRectWithMask(KDRect rect, KDColor color, const uint8_t* mask,
                          KDColor* workingBuffer);
   void strokeRect(KDRect rect, KDColor color);
+  /* Move the pixels already drawn in rect so that its top left corner lands
+   * on destination. The source and destination may overlap. Pixels that
+   * would be read or written outside the clipping rect are left untouched. */
+  void copyRect(KDRect rect, KDPoint destination);
 
   // Circle
   void fillAntialiasedCircle(KDPoint topLeft, KDCoordinate radius,
@@ -56,6 +60,8 @@ class KDContext {
   virtual void pushRect(KDRect, const KDColor* pixels) = 0;
   virtual void pushRectUniform(KDRect rect, KDColor color) = 0;
   virtual void pullRect(KDRect rect, KDColor* pixels) = 0;
+  // By default, pixels are pulled and pushed back in small chunks
+  virtual void copyAbsoluteRect(KDRect rect, KDPoint destination);
   KDRect relativeRect(KDRect rect);
 
  private:
@@ -10,6 +10,7 @@ class KDFrameBuffer {
   void pushRect(KDRect rect, const KDColor* pixels);
   void pushRectUniform(KDRect rect, KDColor color);
   void pullRect(KDRect rect, KDColor* pixels);
+  void copyRect(KDRect rect, KDPoint destination);
   KDRect bounds();
 
  private:
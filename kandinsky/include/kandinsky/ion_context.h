@@ -3,12 +3,13 @@
 
 #include <kandinsky/context.h>
 #include <omg/global_box.h>
+#include <omg/instance_local.h>
 
 class KDIonContext : public KDContext {
   friend OMG::GlobalBox<KDIonContext>;
 
  public:
-  static OMG::GlobalBox<KDIonContext> SharedContext;
+  static OMG_INSTANCE_LOCAL OMG::GlobalBox<KDIonContext> SharedContext;
   static void Putchar(char c);
   static void Clear(KDPoint newCursorPosition = KDPointZero);
 
@@ -17,6 +18,7 @@ class KDIonContext : public KDContext {
   void pushRect(KDRect rect, const KDColor* pixels) override;
   void pushRectUniform(KDRect rect, KDColor color) override;
   void pullRect(KDRect rect, KDColor* pixels) override;
+  void copyAbsoluteRect(KDRect rect, KDPoint destination) override;
 };
 
 #endif
@@ -0,0 +1,28 @@
+#ifndef KANDINSKY_PIXEL_KERNELS_H
+#define KANDINSKY_PIXEL_KERNELS_H
+
+#include <kandinsky/color.h>
+#include <stdint.h>
+
+/* Kernels processing contiguous runs of pixels, which are the inner loops of
+ * the rect drawing functions. They are selected at build time: SSE2 and NEON
+ * builds process 8 pixels at once, other builds write two pixels per word.
+ * All implementations yield the same pixels as KDColor::Blend. */
+
+namespace KDPixelKernels {
+
+// pixels[i] = color
+void Fill(KDColor* pixels, int numberOfPixels, KDColor color);
+// pixels[i] = KDColor::Blend(background, color, mask[i])
+void FillWithMask(KDColor* pixels, const uint8_t* mask, int numberOfPixels,
+                  KDColor color, KDColor background);
+// pixels[i] = KDColor::Blend(pixels[i], color, mask[i])
+void BlendWithMask(KDColor* pixels, const uint8_t* mask, int numberOfPixels,
+                   KDColor color);
+// Expand pixels to 3 bytes per pixel, in the order red, green, blue
+void ConvertToRGB888(const KDColor* pixels, uint8_t* rgb,
+                     int numberOfPixels);
+
+}  // namespace KDPixelKernels
+
+#endif
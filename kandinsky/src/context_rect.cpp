@@ -1,5 +1,8 @@
 #include <assert.h>
 #include <kandinsky/context.h>
+#include <kandinsky/pixel_kernels.h>
+
+#include <algorithm>
 
 KDRect KDContext::relativeRect(KDRect rect) {
   return rect.intersectedWith(m_clippingRect).relativeTo(m_origin);
@@ -84,14 +87,10 @@ void KDContext::fillRectWithMask(KDRect rect, KDColor color, KDColor background,
   startingI = std::max<KDCoordinate>(0, startingI);
   startingJ = std::max<KDCoordinate>(0, startingJ);
   for (KDCoordinate j = 0; j < absoluteRect.height(); j++) {
-    for (KDCoordinate i = 0; i < absoluteRect.width(); i++) {
-      KDColor *currentPixelAddress =
-          workingBuffer + i + absoluteRect.width() * j;
-      const uint8_t *currentMaskAddress =
-          mask + i + startingI + rect.width() * (j + startingJ);
-      *currentPixelAddress =
-          KDColor::Blend(background, color, *currentMaskAddress);
-    }
+    KDPixelKernels::FillWithMask(
+        workingBuffer + absoluteRect.width() * j,
+        mask + startingI + rect.width() * (j + startingJ),
+        absoluteRect.width(), color, background);
   }
   pushRect(absoluteRect, workingBuffer);
 }
@@ -113,16 +112,10 @@ void KDContext::blendRectWithMask(KDRect rect, KDColor color,
   startingI = std::max<KDCoordinate>(0, startingI);
   startingJ = std::max<KDCoordinate>(0, startingJ);
   for (KDCoordinate j = 0; j < absoluteRect.height(); j++) {
-    for (KDCoordinate i = 0; i < absoluteRect.width(); i++) {
-      KDColor *currentPixelAddress =
-          workingBuffer + i + absoluteRect.width() * j;
-      const uint8_t *currentMaskAddress =
-          mask + i + startingI + rect.width() * (j + startingJ);
-      *currentPixelAddress =
-          KDColor::Blend(*currentPixelAddress, color, *currentMaskAddress);
-      /* *currentPixelAddress = KDColorBlend(*currentPixelAddress, color,
-       * *currentMaskAddress); */
-    }
+    KDPixelKernels::BlendWithMask(
+        workingBuffer + absoluteRect.width() * j,
+        mask + startingI + rect.width() * (j + startingJ),
+        absoluteRect.width(), color);
   }
   pushRect(absoluteRect, workingBuffer);
 }
@@ -133,3 +126,37 @@ void KDContext::strokeRect(KDRect rect, KDColor color) {
   fillRect(KDRect(rect.origin(), 1, rect.height()), color);
   fillRect(KDRect(KDPoint(rect.right(), rect.y()), 1, rect.height()), color);
 }
+
+void KDContext::copyRect(KDRect rect, KDPoint destination) {
+  KDPoint delta = destination.relativeTo(rect.origin());
+  // Clip the source, then the destination, and bring it back to the source
+  KDRect absoluteRect = absoluteFillRect(rect)
+                            .translatedBy(delta)
+                            .intersectedWith(m_clippingRect)
+                            .translatedBy(delta.opposite());
+  if (absoluteRect.isEmpty() || delta == KDPointZero) {
+    return;
+  }
+  copyAbsoluteRect(absoluteRect, absoluteRect.origin().translatedBy(delta));
+}
+
+void KDContext::copyAbsoluteRect(KDRect rect, KDPoint destination) {
+  /* Lines are copied from the last one if they move down, and chunks from the
+   * last one if they move right, so that no pixel is overwritten before it is
+   * read. */
+  constexpr KDCoordinate k_chunkLength = 32;
+  KDColor chunk[k_chunkLength];
+  bool downwards = destination.y() > rect.y();
+  bool rightwards = destination.x() > rect.x();
+  for (KDCoordinate j = 0; j < rect.height(); j++) {
+    KDCoordinate y = downwards ? rect.height() - 1 - j : j;
+    for (KDCoordinate i = 0; i < rect.width(); i += k_chunkLength) {
+      KDCoordinate length =
+          std::min<KDCoordinate>(k_chunkLength, rect.width() - i);
+      KDCoordinate x = rightwards ? rect.width() - i - length : i;
+      pullRect(KDRect(rect.x() + x, rect.y() + y, length, 1), chunk);
+      pushRect(KDRect(destination.x() + x, destination.y() + y, length, 1),
+               chunk);
+    }
+  }
+}
@@ -1,4 +1,5 @@
 #include <kandinsky/framebuffer.h>
+#include <kandinsky/pixel_kernels.h>
 #include <string.h>
 
 KDFrameBuffer::KDFrameBuffer(KDColor* pixels, KDSize size)
@@ -23,16 +24,14 @@ void KDFrameBuffer::pushRect(KDRect rect, const KDColor* pixels) {
 void KDFrameBuffer::pushRectUniform(KDRect rect, KDColor color) {
   // Caution: this code is used very frequently. It's worth optimizing!
   KDColor* pixel = pixelAddress(rect.origin());
-  int lineDelta = m_size.width() - rect.width();
+  if (rect.width() == m_size.width()) {
+    // Full-width rows are contiguous
+    KDPixelKernels::Fill(pixel, rect.width() * rect.height(), color);
+    return;
+  }
   for (KDCoordinate j = 0; j < rect.height(); j++) {
-    /* KDColor * topLeftPixelAddress =
-     * pixelAddress(rect.origin().translatedBy(KDPoint(0,j)));
-     * *pixelAddress(rect.origin().translatedBy(KDPoint(i,j))) = color; */
-    for (KDCoordinate i = 0; i < rect.width(); i++) {
-      *pixel++ = color;
-      //*pixelAddress(rect.origin().translatedBy(KDPoint(i,j))) = color;
-    }
-    pixel += lineDelta;
+    KDPixelKernels::Fill(pixel, rect.width(), color);
+    pixel += m_size.width();
   }
 }
 
@@ -45,3 +44,20 @@ void KDFrameBuffer::pullRect(KDRect rect, KDColor* pixels) {
     line += rect.width();
   }
 }
+
+void KDFrameBuffer::copyRect(KDRect rect, KDPoint destination) {
+  KDColor* source = pixelAddress(rect.origin());
+  KDColor* target = pixelAddress(destination);
+  int lineStep = m_size.width();
+  if (destination.y() > rect.y()) {
+    // Copy the bottom line first so that no line is overwritten before read
+    source += (rect.height() - 1) * lineStep;
+    target += (rect.height() - 1) * lineStep;
+    lineStep = -lineStep;
+  }
+  for (KDCoordinate j = 0; j < rect.height(); j++) {
+    memmove(target, source, rect.width() * sizeof(KDColor));
+    source += lineStep;
+    target += lineStep;
+  }
+}
@@ -1,7 +1,8 @@
 #include <ion/display.h>
 #include <kandinsky/ion_context.h>
+#include <omg/instance_local.h>
 
-OMG::GlobalBox<KDIonContext> KDIonContext::SharedContext;
+OMG_INSTANCE_LOCAL OMG::GlobalBox<KDIonContext> KDIonContext::SharedContext;
 
 KDIonContext::KDIonContext() : KDContext(KDPointZero, KDRectScreen) {}
 
@@ -17,7 +18,11 @@ void KDIonContext::pullRect(KDRect rect, KDColor* pixels) {
   Ion::Display::pullRect(rect, pixels);
 }
 
-static KDPoint s_cursor = KDPointZero;
+void KDIonContext::copyAbsoluteRect(KDRect rect, KDPoint destination) {
+  Ion::Display::copyRect(rect, destination);
+}
+
+static OMG_INSTANCE_LOCAL KDPoint s_cursor = KDPointZero;
 
 void KDIonContext::Putchar(char c) {
   constexpr KDFont::Size font = KDFont::Size::Large;
@@ -0,0 +1,227 @@
+#include <kandinsky/pixel_kernels.h>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define KD_PIXEL_KERNELS_VECTOR 1
+#elif defined(__ARM_NEON)
+#include <arm_neon.h>
+#define KD_PIXEL_KERNELS_VECTOR 1
+#else
+#define KD_PIXEL_KERNELS_VECTOR 0
+#endif
+
+static_assert(sizeof(KDColor) == sizeof(uint16_t),
+              "Kernels process KDColor as uint16_t");
+
+namespace KDPixelKernels {
+
+#if KD_PIXEL_KERNELS_VECTOR
+
+/* Vectors of 8 uint16_t. The blending arithmetic is written once on top of
+ * these few operations, implemented for each instruction set. */
+
+constexpr static int k_vectorLength = 8;
+
+#if defined(__SSE2__)
+
+typedef __m128i Vector;
+
+static inline Vector Splat(uint16_t value) { return _mm_set1_epi16(value); }
+static inline Vector LoadPixels(const KDColor* pixels) {
+  return _mm_loadu_si128(reinterpret_cast<const __m128i*>(pixels));
+}
+static inline void StorePixels(KDColor* pixels, Vector v) {
+  _mm_storeu_si128(reinterpret_cast<__m128i*>(pixels), v);
+}
+static inline Vector LoadMask(const uint8_t* mask) {
+  return _mm_unpacklo_epi8(
+      _mm_loadl_epi64(reinterpret_cast<const __m128i*>(mask)),
+      _mm_setzero_si128());
+}
+template <int N>
+static inline Vector ShiftLeft(Vector v) {
+  return _mm_slli_epi16(v, N);
+}
+template <int N>
+static inline Vector ShiftRight(Vector v) {
+  return _mm_srli_epi16(v, N);
+}
+static inline Vector And(Vector a, Vector b) { return _mm_and_si128(a, b); }
+static inline Vector Or(Vector a, Vector b) { return _mm_or_si128(a, b); }
+static inline Vector Add(Vector a, Vector b) { return _mm_add_epi16(a, b); }
+static inline Vector Sub(Vector a, Vector b) { return _mm_sub_epi16(a, b); }
+static inline Vector Mul(Vector a, Vector b) { return _mm_mullo_epi16(a, b); }
+static inline Vector Equal(Vector a, Vector b) { return _mm_cmpeq_epi16(a, b); }
+// Pick a where the condition bits are set and b elsewhere
+static inline Vector Select(Vector condition, Vector a, Vector b) {
+  return _mm_or_si128(_mm_and_si128(condition, a),
+                      _mm_andnot_si128(condition, b));
+}
+static inline void StoreRGB(uint8_t* rgb, Vector red, Vector green,
+                            Vector blue) {
+  alignas(16) uint16_t r[k_vectorLength], g[k_vectorLength],
+      b[k_vectorLength];
+  _mm_store_si128(reinterpret_cast<__m128i*>(r), red);
+  _mm_store_si128(reinterpret_cast<__m128i*>(g), green);
+  _mm_store_si128(reinterpret_cast<__m128i*>(b), blue);
+  for (int i = 0; i < k_vectorLength; i++) {
+    *rgb++ = r[i];
+    *rgb++ = g[i];
+    *rgb++ = b[i];
+  }
+}
+
+#else  // __ARM_NEON
+
+typedef uint16x8_t Vector;
+
+static inline Vector Splat(uint16_t value) { return vdupq_n_u16(value); }
+static inline Vector LoadPixels(const KDColor* pixels) {
+  return vld1q_u16(reinterpret_cast<const uint16_t*>(pixels));
+}
+static inline void StorePixels(KDColor* pixels, Vector v) {
+  vst1q_u16(reinterpret_cast<uint16_t*>(pixels), v);
+}
+static inline Vector LoadMask(const uint8_t* mask) {
+  return vmovl_u8(vld1_u8(mask));
+}
+template <int N>
+static inline Vector ShiftLeft(Vector v) {
+  return vshlq_n_u16(v, N);
+}
+template <int N>
+static inline Vector ShiftRight(Vector v) {
+  return vshrq_n_u16(v, N);
+}
+static inline Vector And(Vector a, Vector b) { return vandq_u16(a, b); }
+static inline Vector Or(Vector a, Vector b) { return vorrq_u16(a, b); }
+static inline Vector Add(Vector a, Vector b) { return vaddq_u16(a, b); }
+static inline Vector Sub(Vector a, Vector b) { return vsubq_u16(a, b); }
+static inline Vector Mul(Vector a, Vector b) { return vmulq_u16(a, b); }
+static inline Vector Equal(Vector a, Vector b) { return vceqq_u16(a, b); }
+static inline Vector Select(Vector condition, Vector a, Vector b) {
+  return vbslq_u16(condition, a, b);
+}
+static inline void StoreRGB(uint8_t* rgb, Vector red, Vector green,
+                            Vector blue) {
+  uint8x8x3_t channels = {{vmovn_u16(red), vmovn_u16(green), vmovn_u16(blue)}};
+  vst3_u8(rgb, channels);
+}
+
+#endif
+
+// Same as KDColor::Expand, see color.h
+template <int NumberOfBits>
+static inline Vector Expand(Vector channel) {
+  return Or(ShiftLeft<8 - NumberOfBits>(channel),
+            ShiftRight<NumberOfBits - (8 - NumberOfBits)>(channel));
+}
+
+static inline Vector Red(Vector pixels) {
+  return Expand<5>(ShiftRight<11>(pixels));
+}
+static inline Vector Green(Vector pixels) {
+  return Expand<6>(And(ShiftRight<5>(pixels), Splat(0x3F)));
+}
+static inline Vector Blue(Vector pixels) {
+  return Expand<5>(And(pixels, Splat(0x1F)));
+}
+
+/* Same as KDColor::Blend. The products fit in 16 bits since channels and
+ * alpha are lower than 0x100 and the weights add up to 0x100. */
+static inline Vector Blend(Vector first, Vector second, Vector alpha) {
+  Vector oneMinusAlpha = Sub(Splat(0x100), alpha);
+  Vector red = ShiftRight<8>(
+      Add(Mul(Red(first), alpha), Mul(Red(second), oneMinusAlpha)));
+  Vector green = ShiftRight<8>(
+      Add(Mul(Green(first), alpha), Mul(Green(second), oneMinusAlpha)));
+  Vector blue = ShiftRight<8>(
+      Add(Mul(Blue(first), alpha), Mul(Blue(second), oneMinusAlpha)));
+  Vector blend = Or(Or(ShiftLeft<11>(ShiftRight<3>(red)),
+                       ShiftLeft<5>(ShiftRight<2>(green))),
+                    ShiftRight<3>(blue));
+  /* The formula yields the second color when alpha is 0, but KDColor::Blend
+   * special-cases an alpha of 0xFF to yield the first color exactly. */
+  return Select(Equal(alpha, Splat(0xFF)), first, blend);
+}
+
+#endif
+
+void Fill(KDColor* pixels, int numberOfPixels, KDColor color) {
+  int i = 0;
+#if KD_PIXEL_KERNELS_VECTOR
+  Vector colors = Splat(color);
+  for (; i + k_vectorLength <= numberOfPixels; i += k_vectorLength) {
+    StorePixels(pixels + i, colors);
+  }
+#else
+  // Write two pixels per aligned word
+  typedef uint32_t __attribute__((__may_alias__)) Word;
+  if (i < numberOfPixels && reinterpret_cast<uintptr_t>(pixels) % 4 != 0) {
+    pixels[i++] = color;
+  }
+  Word word = static_cast<uint16_t>(color) * static_cast<Word>(0x10001);
+  Word* words = reinterpret_cast<Word*>(pixels + i);
+  for (; i + 8 <= numberOfPixels; i += 8) {
+    words[0] = word;
+    words[1] = word;
+    words[2] = word;
+    words[3] = word;
+    words += 4;
+  }
+  for (; i + 2 <= numberOfPixels; i += 2) {
+    *words++ = word;
+  }
+#endif
+  for (; i < numberOfPixels; i++) {
+    pixels[i] = color;
+  }
+}
+
+void FillWithMask(KDColor* pixels, const uint8_t* mask, int numberOfPixels,
+                  KDColor color, KDColor background) {
+  int i = 0;
+#if KD_PIXEL_KERNELS_VECTOR
+  Vector colors = Splat(color);
+  Vector backgrounds = Splat(background);
+  for (; i + k_vectorLength <= numberOfPixels; i += k_vectorLength) {
+    StorePixels(pixels + i, Blend(backgrounds, colors, LoadMask(mask + i)));
+  }
+#endif
+  for (; i < numberOfPixels; i++) {
+    pixels[i] = KDColor::Blend(background, color, mask[i]);
+  }
+}
+
+void BlendWithMask(KDColor* pixels, const uint8_t* mask, int numberOfPixels,
+                   KDColor color) {
+  int i = 0;
+#if KD_PIXEL_KERNELS_VECTOR
+  Vector colors = Splat(color);
+  for (; i + k_vectorLength <= numberOfPixels; i += k_vectorLength) {
+    StorePixels(pixels + i,
+                Blend(LoadPixels(pixels + i), colors, LoadMask(mask + i)));
+  }
+#endif
+  for (; i < numberOfPixels; i++) {
+    pixels[i] = KDColor::Blend(pixels[i], color, mask[i]);
+  }
+}
+
+void ConvertToRGB888(const KDColor* pixels, uint8_t* rgb,
+                     int numberOfPixels) {
+  int i = 0;
+#if KD_PIXEL_KERNELS_VECTOR
+  for (; i + k_vectorLength <= numberOfPixels; i += k_vectorLength) {
+    Vector v = LoadPixels(pixels + i);
+    StoreRGB(rgb + 3 * i, Red(v), Green(v), Blue(v));
+  }
+#endif
+  for (; i < numberOfPixels; i++) {
+    rgb[3 * i] = pixels[i].red();
+    rgb[3 * i + 1] = pixels[i].green();
+    rgb[3 * i + 2] = pixels[i].blue();
+  }
+}
+
+}  // namespace KDPixelKernels
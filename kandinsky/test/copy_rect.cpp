@@ -0,0 +1,75 @@
+#include <kandinsky/context.h>
+#include <kandinsky/framebuffer.h>
+#include <quiz.h>
+
+/* Both the generic copy of KDContext and the memmove of KDFrameBuffer must
+ * move the pixels as if the source had been read entirely before writing the
+ * destination, whatever the direction of the overlap. */
+
+constexpr static KDCoordinate k_width = 50;
+constexpr static KDCoordinate k_height = 20;
+
+static KDColor colorAt(int x, int y) {
+  return KDColor::RGB16(static_cast<uint16_t>((y * k_width + x) * 40503u));
+}
+
+class FrameBufferContext : public KDContext {
+ public:
+  FrameBufferContext(KDColor* pixels)
+      : KDContext(KDPointZero, KDRect(0, 0, k_width, k_height)),
+        m_frameBuffer(pixels, KDSize(k_width, k_height)) {}
+
+ private:
+  void pushRect(KDRect rect, const KDColor* pixels) override {
+    m_frameBuffer.pushRect(rect, pixels);
+  }
+  void pushRectUniform(KDRect rect, KDColor color) override {
+    m_frameBuffer.pushRectUniform(rect, color);
+  }
+  void pullRect(KDRect rect, KDColor* pixels) override {
+    m_frameBuffer.pullRect(rect, pixels);
+  }
+  KDFrameBuffer m_frameBuffer;
+};
+
+static void fillPixels(KDColor* pixels) {
+  for (int y = 0; y < k_height; y++) {
+    for (int x = 0; x < k_width; x++) {
+      pixels[y * k_width + x] = colorAt(x, y);
+    }
+  }
+}
+
+static void assertPixelsAreCopied(const KDColor* pixels, KDRect rect,
+                                  KDPoint destination) {
+  KDPoint delta = destination.relativeTo(rect.origin());
+  KDRect target = rect.translatedBy(delta);
+  for (int y = 0; y < k_height; y++) {
+    for (int x = 0; x < k_width; x++) {
+      KDColor expected = target.contains(KDPoint(x, y))
+                             ? colorAt(x - delta.x(), y - delta.y())
+                             : colorAt(x, y);
+      quiz_assert(pixels[y * k_width + x] == expected);
+    }
+  }
+}
+
+QUIZ_CASE(kandinsky_copy_rect) {
+  KDColor pixels[k_width * k_height];
+  KDRect rect(5, 4, 40, 12);
+  constexpr int k_numberOfDeltas = 6;
+  KDPoint deltas[k_numberOfDeltas] = {KDPoint(0, 3),  KDPoint(0, -3),
+                                      KDPoint(4, 0),  KDPoint(-5, 0),
+                                      KDPoint(3, -2), KDPoint(-1, 4)};
+  for (KDPoint delta : deltas) {
+    KDPoint destination = rect.origin().translatedBy(delta);
+    fillPixels(pixels);
+    KDFrameBuffer(pixels, KDSize(k_width, k_height))
+        .copyRect(rect, destination);
+    assertPixelsAreCopied(pixels, rect, destination);
+
+    fillPixels(pixels);
+    FrameBufferContext(pixels).copyRect(rect, destination);
+    assertPixelsAreCopied(pixels, rect, destination);
+  }
+}
@@ -0,0 +1,76 @@
+#include <kandinsky/pixel_kernels.h>
+#include <quiz.h>
+
+/* The kernels must yield the exact pixels of KDColor::Blend, whatever the
+ * instruction set they were built for. Lengths and offsets exercise both the
+ * vector loops and the remaining pixels. */
+
+constexpr static int k_maxNumberOfPixels = 40;
+
+static KDColor pseudoRandomColor(int i) {
+  return KDColor::RGB16(static_cast<uint16_t>(i * 40503u + 0x1234));
+}
+
+QUIZ_CASE(kandinsky_pixel_kernels_fill) {
+  KDColor buffer[k_maxNumberOfPixels + 2];
+  KDColor canary = KDColorBlack;
+  for (int offset = 0; offset < 2; offset++) {
+    for (int n = 0; n <= k_maxNumberOfPixels; n++) {
+      for (KDColor &pixel : buffer) {
+        pixel = canary;
+      }
+      KDPixelKernels::Fill(buffer + offset, n, KDColorOrange);
+      for (int i = 0; i < k_maxNumberOfPixels + 2; i++) {
+        quiz_assert(buffer[i] ==
+                    (i >= offset && i < offset + n ? KDColorOrange : canary));
+      }
+    }
+  }
+}
+
+QUIZ_CASE(kandinsky_pixel_kernels_blend) {
+  uint8_t mask[k_maxNumberOfPixels];
+  KDColor pixels[k_maxNumberOfPixels];
+  KDColor expected[k_maxNumberOfPixels];
+  // Go through every alpha value, including the special cases 0 and 0xFF
+  for (int round = 0; round < 256; round++) {
+    KDColor color = pseudoRandomColor(3 * round);
+    KDColor background = pseudoRandomColor(3 * round + 1);
+    int n = round % (k_maxNumberOfPixels + 1);
+    for (int i = 0; i < n; i++) {
+      mask[i] = (round + 37 * i) % 256;
+    }
+
+    KDPixelKernels::FillWithMask(pixels, mask, n, color, background);
+    for (int i = 0; i < n; i++) {
+      quiz_assert(pixels[i] == KDColor::Blend(background, color, mask[i]));
+    }
+
+    for (int i = 0; i < n; i++) {
+      pixels[i] = pseudoRandomColor(round + i);
+      expected[i] = KDColor::Blend(pixels[i], color, mask[i]);
+    }
+    KDPixelKernels::BlendWithMask(pixels, mask, n, color);
+    for (int i = 0; i < n; i++) {
+      quiz_assert(pixels[i] == expected[i]);
+    }
+  }
+}
+
+QUIZ_CASE(kandinsky_pixel_kernels_rgb888) {
+  KDColor pixels[k_maxNumberOfPixels];
+  uint8_t rgb[3 * k_maxNumberOfPixels];
+  for (int i = 0; i < k_maxNumberOfPixels; i++) {
+    pixels[i] = pseudoRandomColor(i);
+  }
+  pixels[0] = KDColorWhite;
+  pixels[1] = KDColorBlack;
+  KDPixelKernels::ConvertToRGB888(pixels, rgb, k_maxNumberOfPixels);
+  quiz_assert(rgb[0] == 0xFF && rgb[1] == 0xFF && rgb[2] == 0xFF);
+  quiz_assert(rgb[3] == 0 && rgb[4] == 0 && rgb[5] == 0);
+  for (int i = 0; i < k_maxNumberOfPixels; i++) {
+    quiz_assert(rgb[3 * i] == pixels[i].red() &&
+                rgb[3 * i + 1] == pixels[i].green() &&
+                rgb[3 * i + 2] == pixels[i].blue());
+  }
+}
@@ -19,6 +19,13 @@ size_t strlcat(char* dst, const char* src, size_t dstSize);
 size_t strlcpy(char* dst, const char* src, size_t dstSize);
 size_t strlen(const char* s);
 
+/* Let the compiler expand moves and fills of small constant sizes inline.
+ * The builtins fall back to calling the functions above for other sizes. */
+#if defined(__GNUC__) && !defined(LIBA_BUILDING_MEMORY_FUNCTIONS)
+#define memmove(dst, src, n) __builtin_memmove(dst, src, n)
+#define memset(b, c, len) __builtin_memset(b, c, len)
+#endif
+
 LIBA_END_DECLS
 
 #endif
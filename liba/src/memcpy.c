@@ -1,12 +1,62 @@
-#include <string.h>
+#include "memory_words.h"
 
 // Work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=51205
 void * memcpy(void * dst, const void * src, size_t n) __attribute__((externally_visible));
 
-void * __attribute__((noinline)) memcpy(void * dst, const void * src, size_t n) {
-  char * destination = (char *)dst;
-  char * source = (char *)src;
+/* memcpy always copies forward and reads each byte before writing the
+ * destination at the same position: memmove relies on it to copy overlapping
+ * buffers when dst < src. */
 
+void * LIBA_MEMORY_FUNCTION memcpy(void * dst, const void * src, size_t n) {
+  unsigned char * destination = (unsigned char *)dst;
+  const unsigned char * source = (const unsigned char *)src;
+
+  if (n >= LIBA_WORD_THRESHOLD) {
+    // Copy the head bytes until the destination is aligned
+    while (LIBA_WORD_OFFSET(destination) != 0) {
+      *destination++ = *source++;
+      n--;
+    }
+    liba_word_t * destinationWords = (liba_word_t *)destination;
+    int offset = LIBA_WORD_OFFSET(source);
+    if (offset == 0) {
+      const liba_word_t * sourceWords = (const liba_word_t *)source;
+      while (n >= LIBA_BLOCK_SIZE) {
+        liba_word_t a = sourceWords[0];
+        liba_word_t b = sourceWords[1];
+        liba_word_t c = sourceWords[2];
+        liba_word_t d = sourceWords[3];
+        destinationWords[0] = a;
+        destinationWords[1] = b;
+        destinationWords[2] = c;
+        destinationWords[3] = d;
+        sourceWords += 4;
+        destinationWords += 4;
+        n -= LIBA_BLOCK_SIZE;
+      }
+      while (n >= LIBA_WORD_SIZE) {
+        *destinationWords++ = *sourceWords++;
+        n -= LIBA_WORD_SIZE;
+      }
+      source = (const unsigned char *)sourceWords;
+    } else {
+      /* The source is not aligned: read aligned words and merge them. The
+       * aligned words hold at least one byte of the source, so they are never
+       * read out of its bounds. */
+      const liba_word_t * sourceWords = (const liba_word_t *)(source - offset);
+      liba_word_t current = *sourceWords++;
+      while (n >= LIBA_WORD_SIZE) {
+        liba_word_t next = *sourceWords++;
+        *destinationWords++ = liba_merge_words(current, next, offset);
+        current = next;
+        n -= LIBA_WORD_SIZE;
+      }
+      source = (const unsigned char *)sourceWords - LIBA_WORD_SIZE + offset;
+    }
+    destination = (unsigned char *)destinationWords;
+  }
+
+  // Copy the tail bytes
   while (n--) {
     *destination++ = *source++;
   }
@@ -1,20 +1,60 @@
-#include <string.h>
+#include "memory_words.h"
 
-void * memmove(void * dst, const void * src, size_t n) {
-  char * destination = (char *)dst;
-  char * source = (char *)src;
+void * LIBA_MEMORY_FUNCTION memmove(void * dst, const void * src, size_t n) {
+  unsigned char * destination = (unsigned char *)dst;
+  const unsigned char * source = (const unsigned char *)src;
 
-  if (source < destination && destination < source + n) {
-    /* Copy backwards to avoid overwrites */
-    source += n;
-    destination += n;
-    while (n--) {
+  if (!(source < destination && destination < source + n)) {
+    // A forward copy never overwrites bytes before reading them
+    return memcpy(dst, src, n);
+  }
+
+  /* Copy backwards to avoid overwrites, mirroring memcpy */
+  source += n;
+  destination += n;
+  if (n >= LIBA_WORD_THRESHOLD) {
+    while (LIBA_WORD_OFFSET(destination) != 0) {
       *--destination = *--source;
+      n--;
     }
-  } else {
-    while (n--) {
-      *destination++ = *source++;
+    liba_word_t * destinationWords = (liba_word_t *)destination;
+    int offset = LIBA_WORD_OFFSET(source);
+    if (offset == 0) {
+      const liba_word_t * sourceWords = (const liba_word_t *)source;
+      while (n >= LIBA_BLOCK_SIZE) {
+        sourceWords -= 4;
+        destinationWords -= 4;
+        liba_word_t a = sourceWords[0];
+        liba_word_t b = sourceWords[1];
+        liba_word_t c = sourceWords[2];
+        liba_word_t d = sourceWords[3];
+        destinationWords[0] = a;
+        destinationWords[1] = b;
+        destinationWords[2] = c;
+        destinationWords[3] = d;
+        n -= LIBA_BLOCK_SIZE;
+      }
+      while (n >= LIBA_WORD_SIZE) {
+        *--destinationWords = *--sourceWords;
+        n -= LIBA_WORD_SIZE;
+      }
+      source = (const unsigned char *)sourceWords;
+    } else {
+      const liba_word_t * sourceWords = (const liba_word_t *)(source - offset);
+      liba_word_t current = *sourceWords;
+      while (n >= LIBA_WORD_SIZE) {
+        liba_word_t previous = *--sourceWords;
+        *--destinationWords = liba_merge_words(previous, current, offset);
+        current = previous;
+        n -= LIBA_WORD_SIZE;
+      }
+      source = (const unsigned char *)sourceWords + offset;
     }
+    destination = (unsigned char *)destinationWords;
+  }
+
+  while (n--) {
+    *--destination = *--source;
   }
 
   return dst;
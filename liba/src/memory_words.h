@@ -0,0 +1,44 @@
+#ifndef LIBA_MEMORY_WORDS_H
+#define LIBA_MEMORY_WORDS_H
+
+/* Helpers shared by memcpy, memmove and memset, which process memory one
+ * aligned word at a time. Copies of four words at once compile to LDM/STM
+ * pairs on ARM. */
+
+// Do not expand the calls to the memory functions into compiler builtins
+#define LIBA_BUILDING_MEMORY_FUNCTIONS
+#include <stdint.h>
+#include <string.h>
+
+#if __BYTE_ORDER__ != __ORDER_LITTLE_ENDIAN__
+#error Merging misaligned words assumes a little-endian target
+#endif
+
+/* The loops below must not be recognized as copies and turned back into calls
+ * to memcpy or memset. Calls should not be inlined either, see
+ * https://gcc.gnu.org/bugzilla/show_bug.cgi?id=51205 */
+#if defined(__GNUC__) && !defined(__clang__)
+#define LIBA_MEMORY_FUNCTION \
+  __attribute__((noinline, optimize("no-tree-loop-distribute-patterns")))
+#else
+#define LIBA_MEMORY_FUNCTION __attribute__((noinline))
+#endif
+
+typedef uint32_t __attribute__((__may_alias__)) liba_word_t;
+
+#define LIBA_WORD_SIZE sizeof(liba_word_t)
+#define LIBA_WORD_MASK (LIBA_WORD_SIZE - 1)
+#define LIBA_BLOCK_SIZE (4 * LIBA_WORD_SIZE)
+// Below this size, aligning the pointers costs more than it saves
+#define LIBA_WORD_THRESHOLD (4 * LIBA_WORD_SIZE)
+
+#define LIBA_WORD_OFFSET(p) ((uintptr_t)(p) & LIBA_WORD_MASK)
+
+/* Merge two consecutive aligned words to extract the word starting offset
+ * bytes into the first one. */
+static inline liba_word_t liba_merge_words(liba_word_t first,
+                                           liba_word_t second, int offset) {
+  return (first >> (8 * offset)) | (second << (8 * (LIBA_WORD_SIZE - offset)));
+}
+
+#endif
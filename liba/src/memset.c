@@ -1,12 +1,37 @@
-#include <string.h>
+#include "memory_words.h"
 
 // Work around https://gcc.gnu.org/bugzilla/show_bug.cgi?id=51205
 void * memset(void * b, int c, size_t len) __attribute__((externally_visible));
 
-void * __attribute__((noinline)) memset(void * b, int c, size_t len) {
-  char * destination = (char *)b;
+void * LIBA_MEMORY_FUNCTION memset(void * b, int c, size_t len) {
+  unsigned char * destination = (unsigned char *)b;
+  unsigned char value = (unsigned char)c;
+
+  if (len >= LIBA_WORD_THRESHOLD) {
+    while (LIBA_WORD_OFFSET(destination) != 0) {
+      *destination++ = value;
+      len--;
+    }
+    // Repeat the byte in each byte of the word
+    liba_word_t word = value * (liba_word_t)0x01010101;
+    liba_word_t * destinationWords = (liba_word_t *)destination;
+    while (len >= LIBA_BLOCK_SIZE) {
+      destinationWords[0] = word;
+      destinationWords[1] = word;
+      destinationWords[2] = word;
+      destinationWords[3] = word;
+      destinationWords += 4;
+      len -= LIBA_BLOCK_SIZE;
+    }
+    while (len >= LIBA_WORD_SIZE) {
+      *destinationWords++ = word;
+      len -= LIBA_WORD_SIZE;
+    }
+    destination = (unsigned char *)destinationWords;
+  }
+
   while (len--) {
-    *destination++ = (unsigned char)c;
+    *destination++ = value;
   }
   return b;
 }
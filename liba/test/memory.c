@@ -0,0 +1,92 @@
+#include <quiz.h>
+#include <stdint.h>
+#include <string.h>
+
+/* The word-wise implementations handle head and tail bytes and misaligned
+ * sources separately, so test every alignment of the pointers for sizes
+ * around several blocks of words. */
+
+#define k_maxAlignment 8
+#define k_maxSize 80
+#define k_bufferSize (k_maxSize + 2 * k_maxAlignment)
+#define k_canary 0xA5
+
+static void fill_pattern(unsigned char * buffer, size_t size, int seed) {
+  for (size_t i = 0; i < size; i++) {
+    buffer[i] = (unsigned char)(seed + 7 * i + 1);
+  }
+}
+
+static size_t size_to_test(size_t i) {
+  /* Prevent the compiler from specializing the calls for constant sizes */
+  volatile size_t size = i;
+  return size;
+}
+
+QUIZ_CASE(liba_memcpy) {
+  unsigned char source[k_bufferSize];
+  unsigned char destination[k_bufferSize];
+  fill_pattern(source, k_bufferSize, 0);
+  for (int srcAlign = 0; srcAlign < k_maxAlignment; srcAlign++) {
+    for (int dstAlign = 0; dstAlign < k_maxAlignment; dstAlign++) {
+      for (size_t n = 0; n <= k_maxSize; n++) {
+        memset(destination, k_canary, k_bufferSize);
+        void * result = memcpy(destination + dstAlign, source + srcAlign,
+                               size_to_test(n));
+        quiz_assert(result == destination + dstAlign);
+        for (int i = 0; i < k_bufferSize; i++) {
+          unsigned char expected = i >= dstAlign && i < dstAlign + (int)n
+                                       ? source[srcAlign + i - dstAlign]
+                                       : k_canary;
+          quiz_assert(destination[i] == expected);
+        }
+      }
+    }
+  }
+}
+
+QUIZ_CASE(liba_memmove) {
+  unsigned char buffer[k_bufferSize + k_maxSize];
+  unsigned char reference[k_bufferSize + k_maxSize];
+  const int bufferSize = k_bufferSize + k_maxSize;
+  // Overlapping copies, forward and backward, at every relative alignment
+  for (int srcAlign = 0; srcAlign < k_maxAlignment; srcAlign++) {
+    for (int shift = -2 * k_maxAlignment; shift <= 2 * k_maxAlignment;
+         shift++) {
+      for (size_t n = 0; n <= k_maxSize; n++) {
+        int src = k_maxAlignment * 2 + srcAlign;
+        int dst = src + shift;
+        fill_pattern(buffer, bufferSize, shift);
+        fill_pattern(reference, bufferSize, shift);
+        void * result = memmove(buffer + dst, buffer + src, size_to_test(n));
+        quiz_assert(result == buffer + dst);
+        unsigned char copy[k_maxSize];
+        for (size_t i = 0; i < n; i++) {
+          copy[i] = reference[src + i];
+        }
+        for (size_t i = 0; i < n; i++) {
+          reference[dst + i] = copy[i];
+        }
+        for (int i = 0; i < bufferSize; i++) {
+          quiz_assert(buffer[i] == reference[i]);
+        }
+      }
+    }
+  }
+}
+
+QUIZ_CASE(liba_memset) {
+  unsigned char buffer[k_bufferSize];
+  for (int align = 0; align < k_maxAlignment; align++) {
+    for (size_t n = 0; n <= k_maxSize; n++) {
+      memset(buffer, k_canary, k_bufferSize);
+      // Only the lowest byte of the value is used
+      void * result = memset(buffer + align, 0x1234, size_to_test(n));
+      quiz_assert(result == buffer + align);
+      for (int i = 0; i < k_bufferSize; i++) {
+        quiz_assert(buffer[i] ==
+                    (i >= align && i < align + (int)n ? 0x34 : k_canary));
+      }
+    }
+  }
+}
@@ -0,0 +1,127 @@
+/* Host benchmark of the liba memory functions
+ *
+ * Compare the throughput of the word-wise memcpy, memmove and memset of liba
+ * to the byte loops they replaced, for several sizes and alignments. It is
+ * built with the host compiler and run with:
+ *   make liba_memory_benchmark
+ * The liba functions are renamed liba_memcpy, liba_memmove and liba_memset to
+ * be linked along with the host libc. */
+
+// For clock_gettime
+#define _POSIX_C_SOURCE 199309L
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <time.h>
+
+void * liba_memcpy(void * dst, const void * src, size_t n);
+void * liba_memmove(void * dst, const void * src, size_t n);
+void * liba_memset(void * b, int c, size_t len);
+
+typedef void (*Operation)(unsigned char * dst, unsigned char * src, size_t n);
+
+/* Reference byte loops, as implemented before. noinline keeps the compiler
+ * from turning them into calls to the host libc. */
+
+static void __attribute__((noinline, optimize("no-tree-loop-distribute-patterns")))
+byte_memcpy(unsigned char * dst, unsigned char * src, size_t n) {
+  while (n--) {
+    *dst++ = *src++;
+  }
+}
+
+static void __attribute__((noinline, optimize("no-tree-loop-distribute-patterns")))
+byte_memmove(unsigned char * dst, unsigned char * src, size_t n) {
+  dst += n;
+  src += n;
+  while (n--) {
+    *--dst = *--src;
+  }
+}
+
+static void __attribute__((noinline, optimize("no-tree-loop-distribute-patterns")))
+byte_memset(unsigned char * dst, unsigned char * src, size_t n) {
+  while (n--) {
+    *dst++ = 0x5A;
+  }
+}
+
+static void word_memcpy(unsigned char * dst, unsigned char * src, size_t n) {
+  liba_memcpy(dst, src, n);
+}
+
+static void word_memmove(unsigned char * dst, unsigned char * src, size_t n) {
+  liba_memmove(dst, src, n);
+}
+
+static void word_memset(unsigned char * dst, unsigned char * src, size_t n) {
+  liba_memset(dst, 0x5A, n);
+}
+
+static double now(void) {
+  struct timespec t;
+  clock_gettime(CLOCK_MONOTONIC, &t);
+  return t.tv_sec + t.tv_nsec * 1e-9;
+}
+
+#define k_bufferSize (1 << 16)
+#define k_bytesPerMeasure (1 << 26)
+
+/* Return the throughput of the operation in MB/s. For memmove, the destination
+ * overlaps the end of the source to force a backward copy. */
+static double throughput(Operation operation, unsigned char * buffer,
+                         size_t size, int srcAlign, int dstAlign,
+                         int overlap) {
+  unsigned char * src = buffer + srcAlign;
+  unsigned char * dst = overlap ? src + size / 2 + dstAlign
+                                : buffer + k_bufferSize + 64 + dstAlign;
+  size_t iterations = k_bytesPerMeasure / size;
+  double start = now();
+  for (size_t i = 0; i < iterations; i++) {
+    operation(dst, src, size);
+  }
+  double duration = now() - start;
+  return iterations * size / duration / 1e6;
+}
+
+int main(void) {
+  static const struct {
+    const char * name;
+    Operation byteLoop;
+    Operation wordWise;
+    int overlap;
+  } operations[] = {
+      {"memcpy", byte_memcpy, word_memcpy, 0},
+      {"memmove", byte_memmove, word_memmove, 1},
+      {"memset", byte_memset, word_memset, 0},
+  };
+  static const size_t sizes[] = {8, 32, 256, 4096, k_bufferSize};
+  static const int alignments[][2] = {{0, 0}, {1, 1}, {1, 3}};
+  unsigned char * buffer = malloc(3 * k_bufferSize);
+  if (buffer == NULL) {
+    return 1;
+  }
+  for (int i = 0; i < 3 * k_bufferSize; i++) {
+    buffer[i] = (unsigned char)i;
+  }
+
+  printf("%-8s %6s %5s %5s %12s %12s %7s\n", "function", "size", "src", "dst",
+         "bytes MB/s", "words MB/s", "speedup");
+  for (size_t o = 0; o < sizeof(operations) / sizeof(operations[0]); o++) {
+    for (size_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+      for (size_t a = 0; a < sizeof(alignments) / sizeof(alignments[0]); a++) {
+        int srcAlign = alignments[a][0];
+        int dstAlign = alignments[a][1];
+        double bytes = throughput(operations[o].byteLoop, buffer, sizes[s],
+                                  srcAlign, dstAlign, operations[o].overlap);
+        double words = throughput(operations[o].wordWise, buffer, sizes[s],
+                                  srcAlign, dstAlign, operations[o].overlap);
+        printf("%-8s %6zu %5d %5d %12.0f %12.0f %6.1fx\n", operations[o].name,
+               sizes[s], srcAlign, dstAlign, bytes, words, words / bytes);
+      }
+    }
+  }
+  free(buffer);
+  return 0;
+}
@@ -0,0 +1,20 @@
+#ifndef OMG_INSTANCE_LOCAL_H
+#define OMG_INSTANCE_LOCAL_H
+
+/* OMG_INSTANCE_LOCAL qualifies the mutable globals, such as the GlobalBoxes,
+ * that make up the state of a calculator instance.
+ * The device only ever runs one instance, so they remain plain globals there.
+ * On host platforms, each thread of a process runs its own instance: the
+ * globals are thread local, and a thread resolves them to the instance it
+ * drives without any bookkeeping.
+ * This header is also included by C sources. */
+
+#if PLATFORM_DEVICE
+#define OMG_INSTANCE_LOCAL
+#elif defined(__cplusplus)
+#define OMG_INSTANCE_LOCAL thread_local
+#else
+#define OMG_INSTANCE_LOCAL _Thread_local
+#endif
+
+#endif
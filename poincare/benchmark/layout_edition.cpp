@@ -0,0 +1,60 @@
+#include <poincare/layout_cursor.h>
+#include <poincare_layouts.h>
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+
+/* Typing latency in a big layout
+ *
+ * Type a few digits in each cell of a 10×10 matrix, as in the edition field of
+ * the calculation app: after each keystroke, the size and baseline of the
+ * whole layout and the cursor position are computed again, as the layout field
+ * does before redrawing. On the simulator, run it with:
+ *   make benchmark.poincare.bin
+ *   output/release/simulator/<target>/benchmark.poincare.bin --headless */
+
+using namespace Poincare;
+
+constexpr static int k_matrixDimension = 10;
+constexpr static KDFont::Size k_font = KDFont::Size::Large;
+
+static MatrixLayout matrixLayout() {
+  MatrixLayout matrix = MatrixLayout::Builder();
+  for (int i = 0; i < k_matrixDimension * k_matrixDimension; i++) {
+    matrix.addChildAtIndexInPlace(HorizontalLayout::Builder(), i, i);
+  }
+  matrix.setDimensions(k_matrixDimension, k_matrixDimension);
+  return matrix;
+}
+
+static void typeInEachCell(const char* name, const char* const* keystrokes,
+                           int numberOfKeystrokes) {
+  MatrixLayout matrix = matrixLayout();
+  Layout l = HorizontalLayout::Builder(matrix);
+  LayoutCursor cursor(l);
+  int checksum = 0;
+  quiz_print(name);
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int row = 0; row < k_matrixDimension; row++) {
+    for (int column = 0; column < k_matrixDimension; column++) {
+      /* Once the cursor is in the matrix, it has an additional gray row and
+       * column. */
+      cursor.safeSetLayout(
+          matrix.childAtIndex(row * matrix.numberOfColumns() + column),
+          OMG::Direction::Right());
+      for (int i = 0; i < numberOfKeystrokes; i++) {
+        cursor.insertText(keystrokes[i], nullptr);
+        checksum += l.layoutSize(k_font).width() + l.baseline(k_font) +
+                    cursor.cursorAbsoluteOrigin(k_font).x();
+      }
+    }
+  }
+  quiz_stopwatch_print_lap(startTime);
+  quiz_assert(checksum > 0);
+}
+
+QUIZ_CASE(poincare_benchmark_layout_edition) {
+  const char* digits[] = {"1", "2", "3"};
+  typeInEachCell("10x10 matrix, 3 digits per cell", digits, 3);
+  const char* power[] = {"2", "^", "3"};
+  typeInEachCell("10x10 matrix, power in each cell", power, 3);
+}
@@ -0,0 +1,62 @@
+#include <poincare/evaluation.h>
+#include <poincare/expression.h>
+#include <poincare/print.h>
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+
+/* Throughput of the approximation of lists
+ *
+ * Approximate formulas on a list of a hundred real numbers, as in statistics
+ * computations. Only the evaluation is measured, not the conversion of the
+ * result back to an expression. On the
+ * simulator, run it with:
+ *   make benchmark.poincare.bin
+ *   output/release/simulator/<target>/benchmark.poincare.bin --headless */
+
+using namespace Poincare;
+
+constexpr static int k_listLength = 100;
+constexpr static int k_numberOfApproximations = 200;
+constexpr static int k_listTextSize = 8 * k_listLength;
+constexpr static int k_bufferSize = 4 * k_listTextSize;
+
+static void buildList(char* buffer) {
+  int length = Print::UnsafeCustomPrintf(buffer, k_listTextSize, "{");
+  for (int i = 0; i < k_listLength; i++) {
+    // Two thirds of positive values
+    length += Print::UnsafeCustomPrintf(
+        buffer + length, k_listTextSize - length, "%s%s%i.5",
+        i == 0 ? "" : ",", i % 3 == 0 ? "-" : "", (i * 7919) % 1000);
+  }
+  Print::UnsafeCustomPrintf(buffer + length, k_listTextSize - length, "}");
+}
+
+template <typename T>
+static void benchmark(const char* name, const char* format) {
+  char list[k_listTextSize];
+  buildList(list);
+  char text[k_bufferSize];
+  Print::UnsafeCustomPrintf(text, k_bufferSize, format, list, list, list);
+  Expression e = Expression::Parse(text, nullptr);
+  quiz_assert(!e.isUninitialized());
+  ApproximationContext approximationContext(nullptr,
+                                            Preferences::ComplexFormat::Real,
+                                            Preferences::AngleUnit::Radian);
+  quiz_print(name);
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int i = 0; i < k_numberOfApproximations; i++) {
+    Evaluation<T> result = static_cast<ExpressionNode*>(e.TreeHandle::node())
+                               ->approximate(T(), approximationContext);
+    quiz_assert(result.numberOfChildren() == k_listLength);
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(poincare_benchmark_list_approximation) {
+  benchmark<double>("200 times L", "%s");
+  benchmark<double>("200 times L×2+3", "%s×2+3");
+  benchmark<double>("200 times (L-mean(L))^2", "(%s-mean(%s))^2");
+  benchmark<double>("200 times L×L/(L+1)", "%s×%s/(%s+1)");
+  benchmark<double>("200 times sort(L)", "sort(%s)");
+  benchmark<float>("200 times L×2+3 in single precision", "%s×2+3");
+}
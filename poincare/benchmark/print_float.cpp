@@ -0,0 +1,81 @@
+#include <poincare/print_float.h>
+#include <quiz.h>
+#include <quiz/stopwatch.h>
+
+#include <cmath>
+
+/* Throughput of PrintFloat
+ *
+ * Print the kind of values found in values tables and statistics: a sweep of
+ * numbers spread over a few decades, in the three display modes, and with the
+ * shortest digits which are read back as the same float. On the
+ * simulator, run it with:
+ *   make benchmark.poincare.bin
+ *   output/release/simulator/<target>/benchmark.poincare.bin --headless */
+
+using namespace Poincare;
+
+constexpr static int k_numberOfValues = 200000;
+
+template <typename T>
+static T valueAtIndex(int i) {
+  // Abscissas of a values table, then scattered values over 12 decades
+  if (i % 2 == 0) {
+    return static_cast<T>(-10.0 + 0.1 * (i / 2 % 200));
+  }
+  double mantissa = (i % 7 == 0 ? -1e-6 : 1e-6) * (i * 2654435761u % 1000003);
+  return static_cast<T>(std::ldexp(mantissa, i % 40 - 10));
+}
+
+template <typename T>
+static void benchmark(const char* name, int numberOfSignificantDigits,
+                      Preferences::PrintFloatMode mode) {
+  char buffer[PrintFloat::k_maxFloatCharSize];
+  quiz_print(name);
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int i = 0; i < k_numberOfValues; i++) {
+    PrintFloat::ConvertFloatToText<T>(
+        valueAtIndex<T>(i), buffer, PrintFloat::k_maxFloatCharSize,
+        PrintFloat::k_maxFloatGlyphLength, numberOfSignificantDigits, mode);
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
+template <typename T>
+static void benchmarkShortest(const char* name) {
+  constexpr int k_numberOfSignificantDigits =
+      PrintFloat::RoundTripSignificantDigits<T>();
+  constexpr int k_bufferSize =
+      PrintFloat::charSizeForFloatsWithPrecision(k_numberOfSignificantDigits);
+  char buffer[k_bufferSize];
+  quiz_print(name);
+  uint64_t startTime = quiz_stopwatch_start();
+  for (int i = 0; i < k_numberOfValues; i++) {
+    PrintFloat::ConvertFloatToTextShortest<T>(
+        valueAtIndex<T>(i), buffer, k_bufferSize,
+        PrintFloat::glyphLengthForFloatWithPrecision(
+            k_numberOfSignificantDigits),
+        Preferences::PrintFloatMode::Scientific);
+  }
+  quiz_stopwatch_print_lap(startTime);
+}
+
+QUIZ_CASE(poincare_benchmark_print_float) {
+  benchmark<float>("200000 floats, 7 digits, decimal", 7,
+                   Preferences::PrintFloatMode::Decimal);
+  benchmark<float>("200000 floats, 7 digits, scientific", 7,
+                   Preferences::PrintFloatMode::Scientific);
+  benchmark<float>("200000 floats, 7 digits, engineering", 7,
+                   Preferences::PrintFloatMode::Engineering);
+  benchmarkShortest<float>("200000 floats, shortest, scientific");
+}
+
+QUIZ_CASE(poincare_benchmark_print_double) {
+  benchmark<double>("200000 doubles, 14 digits, decimal", 14,
+                    Preferences::PrintFloatMode::Decimal);
+  benchmark<double>("200000 doubles, 14 digits, scientific", 14,
+                    Preferences::PrintFloatMode::Scientific);
+  benchmark<double>("200000 doubles, 10 digits, decimal", 10,
+                    Preferences::PrintFloatMode::Decimal);
+  benchmarkShortest<double>("200000 doubles, shortest, scientific");
+}
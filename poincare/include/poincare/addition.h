@@ -38,6 +38,10 @@ class AdditionNode final : public NAryInfixExpressionNode {
     return Complex<T>::Builder(c + d);
   }
   template <typename T>
+  static T computeOnReals(T a, T b) {
+    return a + b;
+  }
+  template <typename T>
   static MatrixComplex<T> computeOnMatrices(
       const MatrixComplex<T> m, const MatrixComplex<T> n,
       Preferences::ComplexFormat complexFormat) {
@@ -51,7 +55,7 @@ class AdditionNode final : public NAryInfixExpressionNode {
         eval1, eval2, complexFormat, computeOnComplex<T>,
         ApproximationHelper::UndefinedOnComplexAndMatrix<T>,
         ApproximationHelper::UndefinedOnMatrixAndComplex<T>,
-        computeOnMatrices<T>);
+        computeOnMatrices<T>, true, computeOnReals<T>);
   }
 
   // Simplification
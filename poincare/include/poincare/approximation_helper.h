@@ -71,6 +71,11 @@ template <typename T>
 using ComplexAndComplexReduction =
     Complex<T> (*)(const std::complex<T> c1, const std::complex<T> c2,
                    Preferences::ComplexFormat complexFormat);
+/* Optional reduction on real numbers, used on the real elements of lists
+ * instead of the complex one. It returns NaN when the result has to be
+ * computed on complexes. */
+template <typename T>
+using RealAndRealReduction = T (*)(T a, T b);
 template <typename T>
 using ComplexAndMatrixReduction =
     MatrixComplex<T> (*)(const std::complex<T> c, const MatrixComplex<T> m,
@@ -111,7 +116,8 @@ Evaluation<T> Reduce(Evaluation<T> eval1, Evaluation<T> eval2,
                      ComplexAndMatrixReduction<T> computeOnComplexAndMatrix,
                      MatrixAndComplexReduction<T> computeOnMatrixAndComplex,
                      MatrixAndMatrixReduction<T> computeOnMatrices,
-                     bool mapOnList = true);
+                     bool mapOnList = true,
+                     RealAndRealReduction<T> computeOnReals = nullptr);
 
 // Lambda reduction function (by default you should use Reduce).
 template <typename T>
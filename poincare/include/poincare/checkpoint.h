@@ -1,6 +1,8 @@
 #ifndef POINCARE_CHECKPOINT_H
 #define POINCARE_CHECKPOINT_H
 
+#include <omg/instance_local.h>
+
 /* Usage:
  *
  * CAUTION : A scope MUST be created directly around the Checkpoint, to ensure
@@ -35,6 +37,9 @@ class Checkpoint {
   }
 
   Checkpoint();
+  /* Only the nodes after endOfPool are rolled back, and they must remain
+   * alterable while the checkpoint is set. */
+  explicit Checkpoint(TreeNode *endOfPool);
   Checkpoint(const Checkpoint &) = delete;
   virtual ~Checkpoint() { protectedDiscard(); }
   Checkpoint &operator=(const Checkpoint &) = delete;
@@ -44,7 +49,7 @@ class Checkpoint {
   virtual void discard() const { protectedDiscard(); }
 
  protected:
-  static Checkpoint *s_topmost;
+  static OMG_INSTANCE_LOCAL Checkpoint *s_topmost;
 
   void rollback() const;
   void protectedDiscard() const;
@@ -14,6 +14,9 @@ class CircuitBreakerCheckpoint final : public Checkpoint {
  public:
   CircuitBreakerCheckpoint(Ion::CircuitBreaker::CheckpointType type)
       : m_type(type) {}
+  CircuitBreakerCheckpoint(Ion::CircuitBreaker::CheckpointType type,
+                           TreeNode* endOfPool)
+      : Checkpoint(endOfPool), m_type(type) {}
   /* The desctructor will call ~Checkpoint, and thus Checkpoint::discard(), so
    * we call unset instead of discard. */
   virtual ~CircuitBreakerCheckpoint() { unset(); }
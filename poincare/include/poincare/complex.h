@@ -12,6 +12,15 @@ template <typename T>
 class ComplexNode final : public EvaluationNode<T>, public std::complex<T> {
  public:
   static T ToScalar(const std::complex<T> c);
+  /* ComplexNodes have no children and a constant size: when all the children
+   * of a node are ComplexNodes, the index-th one is reached without walking
+   * through its siblings. */
+  static ComplexNode<T> *ChildAtIndex(const TreeNode *parent, int index) {
+    char *firstChild = reinterpret_cast<char *>(parent->next());
+    return static_cast<ComplexNode<T> *>(reinterpret_cast<TreeNode *>(
+        firstChild +
+        index * Helpers::AlignedSize(sizeof(ComplexNode<T>), ByteAlignment)));
+  }
   ComplexNode(std::complex<T> c);
 
   std::complex<T> complexAtIndex(int index) const override {
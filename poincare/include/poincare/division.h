@@ -44,7 +44,8 @@ class DivisionNode final : public ExpressionNode {
         eval1, eval2, complexFormat, computeOnComplex<T>,
         ApproximationHelper::UndefinedOnComplexAndMatrix<T>,
         computeOnMatrixAndComplex<T>,
-        ApproximationHelper::UndefinedOnMatrixAndMatrix<T>);
+        ApproximationHelper::UndefinedOnMatrixAndMatrix<T>, true,
+        computeOnReals<T>);
   }
   Evaluation<float> approximate(
       SinglePrecision p,
@@ -82,6 +83,11 @@ class DivisionNode final : public ExpressionNode {
                                      const std::complex<T> d,
                                      Preferences::ComplexFormat complexFormat);
   template <typename T>
+  static T computeOnReals(T a, T b) {
+    // Division by zero is undefined on complexes
+    return b == static_cast<T>(0.0) ? NAN : a / b;
+  }
+  template <typename T>
   static MatrixComplex<T> computeOnMatrixAndComplex(
       const MatrixComplex<T> m, const std::complex<T> c,
       Preferences::ComplexFormat complexFormat) {
@@ -734,6 +734,14 @@ class Expression : public TreeHandle {
   Expression addMissingParentheses();
   void shallowAddMissingParenthesis();
 
+  /* Return true if the enclosure of the child of a floor, ceiling, fractional
+   * part, absolute value or sign proves that this node cannot jump on
+   * [x1, x2]. */
+  bool cannotJumpBetweenValuesForSymbol(
+      const char* symbol, float x1, float x2, Context* context,
+      Preferences::ComplexFormat complexFormat,
+      Preferences::AngleUnit angleUnit) const;
+
   /* Simplification */
   /* The largest integer such that all smaller integers can be stored without
    * any precision loss in IEEE754 double representation is 2E53 as the
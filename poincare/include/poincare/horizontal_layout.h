@@ -79,8 +79,12 @@ class HorizontalLayoutNode final : public LayoutNode {
       return false;
     }
     m_emptyVisibility = state;
-    return numberOfChildren() ==
-           0;  // Return true if empty rectangle is displayed
+    if (numberOfChildren() > 0) {
+      return false;
+    }
+    // The empty rectangle is displayed and changes the size
+    invalidSizesAndBaselinesUpToRoot();
+    return true;
   }
 
   KDCoordinate baselineBetweenIndexes(int leftIndex, int rightIndex,
@@ -4,6 +4,8 @@
 namespace Poincare {
 
 void Init();
+// Tear down the globals set up by Init, so that Init can be called again
+void Shutdown();
 
 }
 
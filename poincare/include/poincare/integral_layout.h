@@ -48,6 +48,7 @@ class IntegralLayoutNode final : public LayoutNode {
 
  protected:
   // LayoutNode
+  void invalidDependentSizesAndBaselines() override;
   KDSize computeSize(KDFont::Size font) override;
   KDCoordinate computeBaseline(KDFont::Size font) override;
   KDCoordinate centralArgumentHeight(KDFont::Size font);
@@ -0,0 +1,112 @@
+#ifndef POINCARE_INTERVAL_H
+#define POINCARE_INTERVAL_H
+
+#include <assert.h>
+#include <poincare/expression.h>
+
+#include <cmath>
+
+namespace Poincare {
+
+/* An Interval encloses all the values a function takes when its variable
+ * spans [xMin, xMax]. Bounds are rounded outward, so that the enclosure holds
+ * despite the approximation errors. Sums and products are only rounded when
+ * they are inexact, so that exact bounds are kept exact.
+ * The bounds of operations which are correctly rounded (+ − × ÷ √) are moved
+ * by one unit in the last place. The bounds of other libm functions and of
+ * approximated values are moved further, by k_libmErrorInUlps ulps.
+ * An interval is either known, in which case the function is proven to be
+ * defined and real everywhere on [xMin, xMax], or unknown, in which case the
+ * function may be undefined somewhere or take any value.
+ * Enclosures are conservative: they can be much wider than the actual range
+ * of the function, since x-x is enclosed in [xMin-xMax, xMax-xMin]. */
+
+template <typename T>
+class Interval {
+ public:
+  /* The libms do not document any bound on the errors of their
+   * transcendental functions. Usual implementations stay within one or two
+   * ulps, this leaves a wide margin. */
+  constexpr static int k_libmErrorInUlps = 16;
+
+  static Interval Unknown() { return Interval(); }
+  // Enclose a constant, with the error of its rounding to T
+  static Interval Point(T value) { return Widened(value, value); }
+  // Enclose the bounds of a correctly rounded operation
+  static Interval Widened(T lower, T upper);
+  // Enclose the bounds of a libm function or of an approximation
+  static Interval WidenedByLibmError(T lower, T upper);
+
+  Interval(T lower, T upper) : m_lower(lower), m_upper(upper) {
+    if (std::isnan(m_lower) || std::isnan(m_upper)) {
+      m_lower = m_upper = NAN;
+    }
+    assert(isUnknown() || m_lower <= m_upper);
+  }
+
+  bool isUnknown() const { return std::isnan(m_lower); }
+  T lower() const { return m_lower; }
+  T upper() const { return m_upper; }
+  bool contains(T value) const {
+    return isUnknown() || (m_lower <= value && value <= m_upper);
+  }
+  bool intersects(T lower, T upper) const {
+    return isUnknown() || (m_lower <= upper && lower <= m_upper);
+  }
+
+  static Interval Opposite(Interval a);
+  static Interval Sum(Interval a, Interval b);
+  static Interval Product(Interval a, Interval b);
+  static Interval Inverse(Interval a);
+  static Interval IntegerPower(Interval a, int n);
+  static Interval Power(Interval a, Interval b);
+  static Interval SquareRoot(Interval a);
+  static Interval Exponential(Interval a);
+  static Interval Logarithm(Interval a);
+  static Interval AbsoluteValue(Interval a);
+  static Interval Floor(Interval a);
+  static Interval Ceiling(Interval a);
+  static Interval Sign(Interval a);
+  // Trigonometric functions work in radians
+  static Interval Sine(Interval a);
+  static Interval Cosine(Interval a);
+  static Interval ArcTangent(Interval a);
+
+  /* Enclose the values of e when symbol spans [xMin, xMax]. Only elementary
+   * functions are enclosed: other nodes that depend on symbol yield an unknown
+   * interval. */
+  static Interval ForExpression(const Expression e, const char* symbol, T xMin,
+                                T xMax, Context* context,
+                                Preferences::ComplexFormat complexFormat,
+                                Preferences::AngleUnit angleUnit);
+
+ private:
+  struct Parameters {
+    const char* symbol;
+    T xMin;
+    T xMax;
+    Context* context;
+    Preferences::ComplexFormat complexFormat;
+    Preferences::AngleUnit angleUnit;
+  };
+
+  Interval() : m_lower(NAN), m_upper(NAN) {}
+
+  static Interval Enclose(const Expression e, const Parameters* parameters);
+  static Interval EncloseChild(const Expression e, int index,
+                               const Parameters* parameters) {
+    return Enclose(e.childAtIndex(index), parameters);
+  }
+  // Bounds of a rounded result whose exact value is result + error
+  static T RoundedDown(T result, T error);
+  static T RoundedUp(T result, T error);
+  static T SumError(T a, T b, T sum);
+  static bool ContainsPeriodicPoint(Interval a, T phase);
+
+  T m_lower;
+  T m_upper;
+};
+
+}  // namespace Poincare
+
+#endif
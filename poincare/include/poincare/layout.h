@@ -64,6 +64,9 @@ class Layout : public TreeHandle {
   void invalidAllSizesPositionsAndBaselines() {
     return node()->invalidAllSizesPositionsAndBaselines();
   }
+  void invalidEditedSizesAndAllPositions() {
+    return node()->invalidEditedSizesAndAllPositions();
+  }
 
   // Serialization
   int serializeForParsing(char *buffer, int bufferSize) const {
@@ -118,6 +121,14 @@ class Layout : public TreeHandle {
     assert(!isUninitialized());
     return Layout(node()->parent());
   }
+  /* Tree edits invalidate the sizes and baselines of the edited layouts and of
+   * their ancestors. This is done here rather than in a TreeNode hook so that
+   * expressions edits do not pay for it. */
+  void replaceWithInPlace(TreeHandle t);
+  void replaceChildInPlace(TreeHandle oldChild, TreeHandle newChild);
+  void replaceChildAtIndexInPlace(int oldChildIndex, TreeHandle newChild);
+  void mergeChildrenAtIndexInPlace(TreeHandle t, int i);
+  void swapChildrenInPlace(int i, int j);
 
   // Replace strings with codepoints
   Layout makeEditable() { return node()->makeEditable(); }
@@ -143,7 +154,15 @@ class Layout : public TreeHandle {
     return node()->deletionMethodForCursorLeftOfChild(childIndex);
   }
 
+ protected:
+  void addChildAtIndexInPlace(TreeHandle t, int index,
+                              int currentNumberOfChildren);
+  void removeChildAtIndexInPlace(int i);
+  void removeChildInPlace(TreeHandle t, int childNumberOfChildren);
+  void removeChildrenInPlace(int currentNumberOfChildren);
+
  private:
+  static void InvalidSizesAndBaselinesUpToRoot(TreeHandle l);
   bool privateHasTopLevelComparisonSymbol(bool includingNotEqualSymbol) const;
 };
 
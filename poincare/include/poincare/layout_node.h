@@ -82,15 +82,26 @@ class LayoutNode : public TreeNode {
   }
   KDSize layoutSize(KDFont::Size font);
   KDCoordinate baseline(KDFont::Size font);
-  void setMargin(bool hasMargin) { m_flags.m_margin = hasMargin; }
+  void setMargin(bool hasMargin) {
+    if (m_flags.m_margin != hasMargin) {
+      m_flags.m_margin = hasMargin;
+      invalidSizesAndBaselinesUpToRoot();
+    }
+  }
   void lockMargin(bool lock) { m_flags.m_lockMargin = lock; }
   int leftMargin() const {
     return m_flags.m_margin ? Escher::Metric::OperatorHorizontalMargin : 0;
   }
   bool marginIsLocked() const { return m_flags.m_lockMargin; }
 
-  // TODO: invalid cache when tempering with hierarchy
   virtual void invalidAllSizesPositionsAndBaselines();
+  /* Editing a layout only changes its size and baseline and the ones of its
+   * ancestors, which are invalidated as soon as it is edited. Once the edition
+   * is over, invalidEditedSizesAndAllPositions also invalidates the layouts
+   * depending on edited layouts, and all the positions since they are
+   * absolute. Other layouts keep their sizes and baselines. */
+  void invalidSizesAndBaselinesUpToRoot();
+  void invalidEditedSizesAndAllPositions();
   int serialize(char *buffer, int bufferSize,
                 Preferences::PrintFloatMode floatDisplayMode =
                     Preferences::PrintFloatMode::Decimal,
@@ -175,6 +186,18 @@ class LayoutNode : public TreeNode {
   }
 
   // Sizing and positioning
+  void invalidSizeAndBaseline() {
+    m_flags.m_sized = false;
+    m_flags.m_baselined = false;
+  }
+  bool sizeOrBaselineIsInvalid() const {
+    return !m_flags.m_sized || !m_flags.m_baselined;
+  }
+  /* Invalidate the sizes and baselines depending on this edited layout, apart
+   * from its ancestors' ones. By default, the ones of its children, since
+   * some layouts depend on their siblings or parent, like VerticalOffsetLayout
+   * on its base. */
+  virtual void invalidDependentSizesAndBaselines();
   virtual KDSize computeSize(KDFont::Size font) = 0;
   virtual KDCoordinate computeBaseline(KDFont::Size font) = 0;
   virtual KDPoint positionOfChild(LayoutNode *child, KDFont::Size font) = 0;
@@ -14,7 +14,12 @@ class ListComplex;
 template <typename T>
 class ListComplexNode final : public EvaluationNode<T> {
  public:
+  ListComplexNode() : m_numberOfChildren(0), m_hasOnlyComplexChildren(true) {}
+
   std::complex<T> complexAtIndex(int index) const override;
+  /* Lists of points or booleans aside, children are all ComplexNodes and can
+   * be accessed in constant time. */
+  bool hasOnlyComplexChildren() const { return m_hasOnlyComplexChildren; }
   int numberOfChildren() const override {
     return m_numberOfChildren < 0 ? 0 : m_numberOfChildren;
   }
@@ -22,6 +27,9 @@ class ListComplexNode final : public EvaluationNode<T> {
     m_numberOfChildren = numberOfChildren;
   }
   void setUndefined() { m_numberOfChildren = -1; }
+  void setHasOnlyComplexChildren(bool hasOnlyComplexChildren) {
+    m_hasOnlyComplexChildren = hasOnlyComplexChildren;
+  }
 
   // TreeNode
   size_t size() const override { return sizeof(ListComplexNode<T>); }
@@ -45,6 +53,7 @@ class ListComplexNode final : public EvaluationNode<T> {
 
  private:
   int16_t m_numberOfChildren;
+  bool m_hasOnlyComplexChildren;
 };
 
 template <typename T>
@@ -67,6 +76,18 @@ class ListComplex final : public Evaluation<T>, public DatasetColumn<T> {
                               int currentNumberOfChildren);
   using TreeHandle::removeChildInPlace;
 
+  /* A list of ComplexNodes is cloned at once, and its elements can then be
+   * overwritten in place instead of building a new list element by element. */
+  bool hasOnlyComplexChildren() const {
+    return node()->hasOnlyComplexChildren();
+  }
+  ListComplex<T> clone() const;
+  void setComplexAtIndex(int index, std::complex<T> c) {
+    assert(hasOnlyComplexChildren() && index < numberOfChildren());
+    static_cast<std::complex<T> &>(*ComplexNode<T>::ChildAtIndex(node(), index)) =
+        c;
+  }
+
   // Helper function
   ListComplex<T> sort();
 
@@ -36,6 +36,10 @@ class MultiplicationNode final : public NAryInfixExpressionNode {
                                      const std::complex<T> d,
                                      Preferences::ComplexFormat complexFormat);
   template <typename T>
+  static T computeOnReals(T a, T b) {
+    return a * b;
+  }
+  template <typename T>
   static MatrixComplex<T> computeOnComplexAndMatrix(
       const std::complex<T> c, const MatrixComplex<T> m,
       Preferences::ComplexFormat complexFormat) {
@@ -52,7 +56,7 @@ class MultiplicationNode final : public NAryInfixExpressionNode {
     return ApproximationHelper::Reduce<T>(
         eval1, eval2, complexFormat, computeOnComplex<T>,
         computeOnComplexAndMatrix<T>, computeOnMatrixAndComplex<T>,
-        computeOnMatrices<T>);
+        computeOnMatrices<T>, true, computeOnReals<T>);
   }
 
  private:
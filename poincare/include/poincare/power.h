@@ -42,13 +42,16 @@ class PowerNode final : public ExpressionNode {
                                      const std::complex<T> d,
                                      Preferences::ComplexFormat complexFormat);
   template <typename T>
+  static T computeOnReals(T a, T b);
+  template <typename T>
   static Evaluation<T> Compute(Evaluation<T> eval1, Evaluation<T> eval2,
                                Preferences::ComplexFormat complexFormat) {
     return ApproximationHelper::Reduce<T>(
         eval1, eval2, complexFormat, computeOnComplex<T>,
         ApproximationHelper::UndefinedOnComplexAndMatrix<T>,
         computeOnMatrixAndComplex<T>,
-        ApproximationHelper::UndefinedOnMatrixAndMatrix<T>);
+        ApproximationHelper::UndefinedOnMatrixAndMatrix<T>, true,
+        computeOnReals<T>);
   }
 
  private:
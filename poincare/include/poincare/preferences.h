@@ -4,6 +4,7 @@
 #include <assert.h>
 #include <omg/bit_helper.h>
 #include <omg/global_box.h>
+#include <omg/instance_local.h>
 #include <poincare/context.h>
 #include <poincare/exam_mode.h>
 #include <stdint.h>
@@ -53,7 +54,7 @@ class Preferences final {
   enum class ParabolaParameter : uint8_t { Default, FocalLength };
 
   Preferences();
-  static OMG::GlobalBox<Preferences> sharedPreferences;
+  static OMG_INSTANCE_LOCAL OMG::GlobalBox<Preferences> sharedPreferences;
 
   static Preferences ClonePreferencesWithNewComplexFormat(
       ComplexFormat complexFormat,
@@ -69,12 +69,25 @@ class PrintFloat {
                                         int availableGlyphLength,
                                         int numberOfSignificantDigits,
                                         Preferences::PrintFloatMode mode);
+  /* ConvertFloatToTextShortest writes the fewest significant digits that are
+   * read back as the exact same float. This never requires more than
+   * RoundTripSignificantDigits<T>() digits, so the available glyph length may
+   * exceed k_maxFloatGlyphLength, up to
+   * glyphLengthForFloatWithPrecision(RoundTripSignificantDigits<T>()). */
+  template <class T>
+  static TextLengths ConvertFloatToTextShortest(
+      T d, char* buffer, int bufferSize, int availableGlyphLength,
+      Preferences::PrintFloatMode mode);
   template <class T>
   constexpr static int SignificantDecimalDigits() {
     return sizeof(T) == sizeof(double) ? k_numberOfStoredSignificantDigits
                                        : k_floatNumberOfSignificantDigits;
   }
   template <class T>
+  constexpr static int RoundTripSignificantDigits() {
+    return sizeof(T) == sizeof(double) ? 17 : 9;
+  }
+  template <class T>
   constexpr static T DecimalModeMinimalValue() {
     return sizeof(T) == sizeof(double) ? 1e-3 : 1e-3f;
   }
@@ -94,47 +107,63 @@ class PrintFloat {
   }
 
  private:
-  template <class T>
-  static TextLengths ConvertFloatToTextPrivate(
-      T f, char* buffer, int bufferSize, int availableGlyphLength,
-      int numberOfSignificantDigits, Preferences::PrintFloatMode mode);
-
-  class Long final {
-   public:
-    Long(int64_t i = 0);
-    Long(uint32_t d1, uint32_t, bool negative);
-    bool isNegative() const { return m_negative; }
-    bool isZero() const { return (m_digits[0] == 0) && (m_digits[1] == 0); }
-    static void DivisionByTen(const Long& longToDivide, Long* quotient,
-                              Long* digit);
-    static void MultiplySmallLongByTen(Long& smallLong);
-
-    int serialize(char* buffer, int bufferSize) const;
-    uint32_t digit(uint8_t i) const {
-      assert(i >= 0 && i < k_numberOfDigits);
-      return m_digits[i];
-    }
+  /* The decimal digits of a float, as an integer mantissa of exactly
+   * numberOfDigits digits and the exponent of its first digit:
+   * |f| ~ mantissa * 10^(exponent - numberOfDigits + 1) */
+  struct SignificantDigits {
+    uint64_t mantissa;
+    int numberOfDigits;
+    int exponent;
+  };
+  /* 64-bit floating point numbers and big integers used to compute the
+   * digits. */
+  class DiyFp;
+  class BigNumber;
 
-   private:
-    constexpr static int64_t k_base = 1000000000;
-    constexpr static int k_numberOfDigits = 2;
-    constexpr static int k_maxNumberOfCharsForDigit = 9;
+  template <class T>
+  static bool ConvertSpecialFloatToText(T f, char* buffer, int bufferSize,
+                                        int availableGlyphLength,
+                                        TextLengths* lengths);
+  // Digits of |f|, rounded half away from zero
+  template <class T>
+  static SignificantDigits ComputeSignificantDigits(
+      T f, int numberOfSignificantDigits);
+  // Fewest digits of |f| which are read back as |f|
+  template <class T>
+  static SignificantDigits ComputeShortestSignificantDigits(T f);
+  static bool FastSignificantDigits(DiyFp w, int numberOfSignificantDigits,
+                                    SignificantDigits* digits);
+  static bool FastShortestSignificantDigits(DiyFp w, DiyFp lowerBoundary,
+                                            DiyFp upperBoundary,
+                                            SignificantDigits* digits);
+  static SignificantDigits ExactSignificantDigits(
+      uint64_t mantissa, int exponent, int numberOfSignificantDigits);
+  static SignificantDigits ExactShortestSignificantDigits(
+      uint64_t mantissa, int exponent, bool lowerBoundaryIsCloser);
 
-    bool m_negative;
-    uint32_t m_digits[k_numberOfDigits];
-  };
+  /* Print the digits in the buffer. In Decimal mode, the Scientific mode is
+   * used instead if the digits do not fit or if the float is tooSmallForDecimal
+   * (to avoid displaying things like 0.0000001). */
+  static TextLengths ConvertSignificantDigitsToText(
+      SignificantDigits digits, bool negative, bool tooSmallForDecimal,
+      char* buffer, int bufferSize, int availableGlyphLength,
+      Preferences::PrintFloatMode mode);
+  static TextLengths ConvertSignificantDigitsToTextInMode(
+      SignificantDigits digits, bool negative, char* buffer, int bufferSize,
+      int availableGlyphLength, Preferences::PrintFloatMode mode);
 
-  /* This function prints the long i in the buffer with a '.' at the position
-   * specified by the decimalMarkerPosition.
+  /* This function prints the integer i in the buffer with a '.' at the
+   * position specified by the decimalMarkerPosition, and a '-' first if
+   * negative.
    * It starts printing at the end of the buffer and prints from right to left.
-   * The given long should be of the right length to be written in bufferLength
-   * chars. If the long is too small, the buffer is padded on the left with '0'.
-   * If the long is too big, the printing stops when no more empty chars are
-   * available, without returning any warning.
+   * If the integer is too small, the buffer is padded on the left with '0'. If
+   * it is too big, the printing stops when no more empty chars are available,
+   * without returning any warning.
    * Warning: the buffer is not null terminated but is ensured to hold
    * bufferLength chars. */
-  static void PrintLongWithDecimalMarker(char* buffer, int bufferLength,
-                                         Long& i, int decimalMarkerPosition);
+  static void PrintIntegerWithDecimalMarker(char* buffer, int bufferLength,
+                                            uint64_t i, bool negative,
+                                            int decimalMarkerPosition);
 };
 
 }  // namespace Poincare
@@ -159,6 +159,8 @@ class Solver {
   static T MinimalStep(T x, T slope = static_cast<T>(1.));
   bool validSolution(T x) const;
   T nextX(T x, T direction, T slope) const;
+  // Bound of ]xStart,xEnd[ beyond which e provably has no roots
+  T endOfRootSearch(const Expression &e) const;
   Coordinate2D<T> nextPossibleRootInChild(const Expression &e,
                                           int childIndex) const;
   Coordinate2D<T> nextRootInChildren(const Expression &e,
@@ -36,6 +36,10 @@ class SubtractionNode final : public ExpressionNode {
                                      Preferences::ComplexFormat complexFormat) {
     return Complex<T>::Builder(c - d);
   }
+  template <typename T>
+  static T computeOnReals(T a, T b) {
+    return a - b;
+  }
 
   template <typename T>
   static Evaluation<T> Compute(Evaluation<T> eval1, Evaluation<T> eval2,
@@ -44,7 +48,7 @@ class SubtractionNode final : public ExpressionNode {
         eval1, eval2, complexFormat, computeOnComplex<T>,
         ApproximationHelper::UndefinedOnComplexAndMatrix<T>,
         ApproximationHelper::UndefinedOnMatrixAndComplex<T>,
-        computeOnMatrices<T>);
+        computeOnMatrices<T>, true, computeOnReals<T>);
   }
 
   Evaluation<float> approximate(
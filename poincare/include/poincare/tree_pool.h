@@ -1,6 +1,7 @@
 #ifndef POINCARE_TREE_POOL_H
 #define POINCARE_TREE_POOL_H
 
+#include <omg/instance_local.h>
 #include <poincare/ghost_node.h>
 #include <stddef.h>
 #include <string.h>
@@ -22,7 +23,7 @@ class TreePool final {
   friend class Checkpoint;
 
  public:
-  static OMG::GlobalBox<TreePool> sharedPool
+  static OMG_INSTANCE_LOCAL OMG::GlobalBox<TreePool> sharedPool
 #if PLATFORM_DEVICE
       __attribute__((section(".bss.$poincare_pool")))
 #endif
@@ -72,6 +73,7 @@ class TreePool final {
   __attribute__((__used__)) void verboseLog() { treeLog(std::cout, true); }
 #endif
   int numberOfNodes() const;
+  size_t freeSpace() const { return BufferSize - (m_cursor - constBuffer()); }
 
  private:
 #ifdef SMALL_POINCARE_POOL
@@ -84,11 +86,14 @@ class TreePool final {
   constexpr static int MaxNumberOfNodes = BufferSize / sizeof(TreeNode);
   constexpr static int k_maxNodeOffset = BufferSize / ByteAlignment;
 #if ASSERTIONS
-  static bool s_treePoolLocked;
+  static OMG_INSTANCE_LOCAL bool s_treePoolLocked;
 #endif
 
   // TreeNode
   void discardTreeNode(TreeNode *node);
+  bool descendantsAreOnlyRetainedByTheirParent(TreeNode *node,
+                                               size_t treeSize) const;
+  void discardTree(TreeNode *node, size_t treeSize);
   void registerNode(TreeNode *node);
   void unregisterNode(TreeNode *node) { freeIdentifier(node->identifier()); }
   void updateNodeForIdentifierFromNode(TreeNode *node);
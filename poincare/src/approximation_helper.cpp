@@ -102,15 +102,55 @@ std::complex<T> ApproximationHelper::MakeResultRealIfInputIsReal(
              : result;
 }
 
+/* Lists of real numbers go through the same operations over and over in
+ * statistics formulas such as sum((L1-mean(L1))^2). Instead of building a new
+ * list element by element, the list operand is cloned at once and overwritten
+ * in place, and real elements are computed without building any Complex. */
+template <typename T>
+ListComplex<T> ElementWiseInPlace(
+    const ListComplex<T> l, const ListComplex<T> otherList,
+    const std::complex<T> c, bool listFirst,
+    Preferences::ComplexFormat complexFormat,
+    ApproximationHelper::ComplexAndComplexReduction<T> computeOnComplexes,
+    ApproximationHelper::RealAndRealReduction<T> computeOnReals) {
+  assert(l.hasOnlyComplexChildren());
+  assert(otherList.isUninitialized() || otherList.hasOnlyComplexChildren());
+  ListComplex<T> result = l.clone();
+  int nChildren = l.numberOfChildren();
+  for (int i = 0; i < nChildren; i++) {
+    std::complex<T> a = result.complexAtIndex(i);
+    std::complex<T> b =
+        otherList.isUninitialized() ? c : otherList.complexAtIndex(i);
+    if (!listFirst) {
+      std::swap(a, b);
+    }
+    T realResult = a.imag() == static_cast<T>(0.0) &&
+                           b.imag() == static_cast<T>(0.0)
+                       ? computeOnReals(a.real(), b.real())
+                       : NAN;
+    result.setComplexAtIndex(
+        i, std::isnan(realResult)
+               ? computeOnComplexes(a, b, complexFormat).complexAtIndex(0)
+               : std::complex<T>(realResult));
+  }
+  return result;
+}
+
 template <typename T>
 ListComplex<T> ElementWiseOnListAndComplex(
     const ListComplex<T> l, const std::complex<T> c,
     Preferences::ComplexFormat complexFormat,
     ApproximationHelper::ComplexAndComplexReduction<T> computeOnComplexes,
+    ApproximationHelper::RealAndRealReduction<T> computeOnReals,
     bool complexFirst) {
   if (l.isUndefined()) {
     return ListComplex<T>::Undefined();
   }
+  if (computeOnReals && l.hasOnlyComplexChildren()) {
+    return ElementWiseInPlace<T>(l, ListComplex<T>(), c, !complexFirst,
+                                 complexFormat, computeOnComplexes,
+                                 computeOnReals);
+  }
   ListComplex<T> result = ListComplex<T>::Builder();
   int nChildren = l.numberOfChildren();
   for (int i = 0; i < nChildren; i++) {
@@ -130,11 +170,17 @@ template <typename T>
 ListComplex<T> ElementWiseOnLists(
     const ListComplex<T> l1, const ListComplex<T> l2,
     Preferences::ComplexFormat complexFormat,
-    ApproximationHelper::ComplexAndComplexReduction<T> computeOnComplexes) {
+    ApproximationHelper::ComplexAndComplexReduction<T> computeOnComplexes,
+    ApproximationHelper::RealAndRealReduction<T> computeOnReals) {
   if (l1.isUndefined() || l2.isUndefined() ||
       l1.numberOfChildren() != l2.numberOfChildren()) {
     return ListComplex<T>::Undefined();
   }
+  if (computeOnReals && l1.hasOnlyComplexChildren() &&
+      l2.hasOnlyComplexChildren()) {
+    return ElementWiseInPlace<T>(l1, l2, NAN, true, complexFormat,
+                                 computeOnComplexes, computeOnReals);
+  }
   ListComplex<T> result = ListComplex<T>::Builder();
   int nChildren = l1.numberOfChildren();
   for (int i = 0; i < nChildren; i++) {
@@ -292,7 +338,8 @@ Evaluation<T> ApproximationHelper::Reduce(
     ComplexAndComplexReduction<T> computeOnComplexes,
     ComplexAndMatrixReduction<T> computeOnComplexAndMatrix,
     MatrixAndComplexReduction<T> computeOnMatrixAndComplex,
-    MatrixAndMatrixReduction<T> computeOnMatrices, bool mapOnList) {
+    MatrixAndMatrixReduction<T> computeOnMatrices, bool mapOnList,
+    RealAndRealReduction<T> computeOnReals) {
   if (eval1.type() == EvaluationNode<T>::Type::BooleanEvaluation ||
       eval2.type() == EvaluationNode<T>::Type::BooleanEvaluation ||
       eval1.type() == EvaluationNode<T>::Type::PointEvaluation ||
@@ -310,7 +357,7 @@ Evaluation<T> ApproximationHelper::Reduce(
       }
       return ElementWiseOnListAndComplex<T>(
           static_cast<ListComplex<T> &>(eval2), eval1.complexAtIndex(0),
-          complexFormat, computeOnComplexes, true);
+          complexFormat, computeOnComplexes, computeOnReals, true);
     } else {
       assert(eval2.type() == EvaluationNode<T>::Type::MatrixComplex);
       return computeOnComplexAndMatrix(eval1.complexAtIndex(0),
@@ -325,11 +372,12 @@ Evaluation<T> ApproximationHelper::Reduce(
     if (eval2.type() == EvaluationNode<T>::Type::Complex) {
       return ElementWiseOnListAndComplex<T>(
           static_cast<ListComplex<T> &>(eval1), eval2.complexAtIndex(0),
-          complexFormat, computeOnComplexes, false);
+          complexFormat, computeOnComplexes, computeOnReals, false);
     } else if (eval2.type() == EvaluationNode<T>::Type::ListComplex) {
       return ElementWiseOnLists<T>(static_cast<ListComplex<T> &>(eval1),
                                    static_cast<ListComplex<T> &>(eval2),
-                                   complexFormat, computeOnComplexes);
+                                   complexFormat, computeOnComplexes,
+                                   computeOnReals);
     } else {
       // Matrices and lists are not compatible
       assert(eval2.type() == EvaluationNode<T>::Type::MatrixComplex);
@@ -509,7 +557,8 @@ template Poincare::Evaluation<float> Poincare::ApproximationHelper::Reduce(
         computeOnMatrixAndComplex,
     Poincare::ApproximationHelper::MatrixAndMatrixReduction<float>
         computeOnMatrices,
-    bool mapOnList);
+    bool mapOnList,
+    Poincare::ApproximationHelper::RealAndRealReduction<float> computeOnReals);
 template Poincare::Evaluation<double> Poincare::ApproximationHelper::Reduce(
     Poincare::Evaluation<double> eval1, Poincare::Evaluation<double> eval2,
     Poincare::Preferences::ComplexFormat complexFormat,
@@ -521,6 +570,7 @@ template Poincare::Evaluation<double> Poincare::ApproximationHelper::Reduce(
         computeOnMatrixAndComplex,
     Poincare::ApproximationHelper::MatrixAndMatrixReduction<double>
         computeOnMatrices,
-    bool mapOnList);
+    bool mapOnList,
+    Poincare::ApproximationHelper::RealAndRealReduction<double> computeOnReals);
 
 }  // namespace Poincare
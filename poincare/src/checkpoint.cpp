@@ -5,10 +5,12 @@
 
 namespace Poincare {
 
-Checkpoint* Checkpoint::s_topmost = nullptr;
+OMG_INSTANCE_LOCAL Checkpoint* Checkpoint::s_topmost = nullptr;
 
-Checkpoint::Checkpoint()
-    : m_parent(s_topmost), m_endOfPool(TreePool::sharedPool->last()) {
+Checkpoint::Checkpoint() : Checkpoint(TreePool::sharedPool->last()) {}
+
+Checkpoint::Checkpoint(TreeNode* endOfPool)
+    : m_parent(s_topmost), m_endOfPool(endOfPool) {
   assert(!m_parent || m_endOfPool >= m_parent->m_endOfPool);
 }
 
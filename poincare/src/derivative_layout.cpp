@@ -313,6 +313,7 @@ void DerivativeLayoutNode::setVariableSlot(VariableSlot variableSlot,
                                            bool* shouldRecomputeLayout) {
   if (m_variableSlot != variableSlot) {
     m_variableSlot = variableSlot;
+    invalidSizesAndBaselinesUpToRoot();
     *shouldRecomputeLayout = true;
   }
 }
@@ -321,6 +322,7 @@ void HigherOrderDerivativeLayoutNode::setOrderSlot(
     OrderSlot orderSlot, bool* shouldRecomputeLayout) {
   if (m_orderSlot != orderSlot) {
     m_orderSlot = orderSlot;
+    invalidSizesAndBaselinesUpToRoot();
     *shouldRecomputeLayout = true;
   }
 }
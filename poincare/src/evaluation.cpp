@@ -2,6 +2,7 @@
 #include <poincare/complex.h>
 #include <poincare/evaluation.h>
 #include <poincare/expression.h>
+#include <poincare/list_complex.h>
 #include <poincare/matrix_complex.h>
 #include <poincare/multiplication.h>
 
@@ -9,6 +10,12 @@ namespace Poincare {
 
 template <typename T>
 Evaluation<T> Evaluation<T>::childAtIndex(int i) const {
+  if (type() == EvaluationNode<T>::Type::MatrixComplex ||
+      (type() == EvaluationNode<T>::Type::ListComplex &&
+       static_cast<ListComplexNode<T> *>(node())->hasOnlyComplexChildren())) {
+    assert(0 <= i && i < numberOfChildren());
+    return Evaluation<T>(ComplexNode<T>::ChildAtIndex(node(), i));
+  }
   TreeHandle c = TreeHandle::childAtIndex(i);
   return static_cast<Evaluation<T> &>(c);
 }
@@ -1,11 +1,12 @@
 #include <assert.h>
+#include <omg/instance_local.h>
 #include <poincare/exception_checkpoint.h>
 
 namespace Poincare {
 
 #if __EMSCRIPTEN__
 
-bool sInterrupted = false;
+OMG_INSTANCE_LOCAL bool sInterrupted = false;
 
 bool ExceptionCheckpoint::HasBeenInterrupted() { return sInterrupted; }
 
@@ -1,6 +1,7 @@
 #include <float.h>
 #include <ion.h>
 #include <ion/unicode/utf8_helper.h>
+#include <omg/instance_local.h>
 #include <poincare/addition.h>
 #include <poincare/based_integer.h>
 #include <poincare/code_point_layout.h>
@@ -15,6 +16,7 @@
 #include <poincare/float.h>
 #include <poincare/ghost.h>
 #include <poincare/imaginary_part.h>
+#include <poincare/interval.h>
 #include <poincare/list.h>
 #include <poincare/matrix.h>
 #include <poincare/multiplication.h>
@@ -41,8 +43,8 @@
 
 namespace Poincare {
 
-static bool s_approximationEncounteredComplex = false;
-static bool s_reductionEncounteredUndistributedList = false;
+static OMG_INSTANCE_LOCAL bool s_approximationEncounteredComplex = false;
+static OMG_INSTANCE_LOCAL bool s_reductionEncounteredUndistributedList = false;
 
 /* Constructor & Destructor */
 
@@ -602,6 +604,38 @@ bool Expression::involvesDiscontinuousFunction(Context *context) const {
   return recursivelyMatches(IsDiscontinuous, context);
 }
 
+bool Expression::cannotJumpBetweenValuesForSymbol(
+    const char *symbol, float x1, float x2, Context *context,
+    Preferences::ComplexFormat complexFormat,
+    Preferences::AngleUnit angleUnit) const {
+  /* The jumps of floor, ceiling and fractional part happen on integers, while
+   * the absolute value and the sign are tested on zero. If the enclosure of
+   * the child does not reach such a point, there is no jump on [x1, x2]. Zero
+   * itself is excluded on both sides, since sign(0) differs from the sign of
+   * any other value. */
+  ExpressionNode::Type t = type();
+  if (t != ExpressionNode::Type::Ceiling && t != ExpressionNode::Type::Floor &&
+      t != ExpressionNode::Type::FracPart &&
+      t != ExpressionNode::Type::AbsoluteValue &&
+      t != ExpressionNode::Type::SignFunction) {
+    return false;
+  }
+  Interval<float> child = Interval<float>::ForExpression(
+      childAtIndex(0), symbol, std::min(x1, x2), std::max(x1, x2), context,
+      complexFormat, angleUnit);
+  if (child.isUnknown()) {
+    return false;
+  }
+  if (t == ExpressionNode::Type::AbsoluteValue ||
+      t == ExpressionNode::Type::SignFunction) {
+    return child.lower() > 0.f || child.upper() < 0.f;
+  }
+  if (t == ExpressionNode::Type::Ceiling) {
+    return std::ceil(child.lower()) == std::ceil(child.upper());
+  }
+  return std::floor(child.lower()) == std::floor(child.upper());
+}
+
 bool Expression::isDiscontinuousBetweenValuesForSymbol(
     const char *symbol, float x1, float x2, Context *context,
     Preferences::ComplexFormat complexFormat,
@@ -610,9 +644,13 @@ bool Expression::isDiscontinuousBetweenValuesForSymbol(
     return true;
   }
   bool isDiscontinuous = false;
-  if (type() == ExpressionNode::Type::Ceiling ||
-      type() == ExpressionNode::Type::Floor ||
-      type() == ExpressionNode::Type::Round) {
+  if (cannotJumpBetweenValuesForSymbol(
+          symbol, x1, x2, context, complexFormat, angleUnit)) {
+    // The enclosure of the child spares the evaluations
+  } else if (type() == ExpressionNode::Type::Ceiling ||
+             type() == ExpressionNode::Type::Floor ||
+             type() == ExpressionNode::Type::Round ||
+             type() == ExpressionNode::Type::SignFunction) {
     // is discontinuous if it changes value
     isDiscontinuous = approximateWithValueForSymbol<float>(
                           symbol, x1, context, complexFormat, angleUnit) !=
@@ -625,8 +663,7 @@ bool Expression::isDiscontinuousBetweenValuesForSymbol(
             symbol, x1, context, complexFormat, angleUnit)) !=
         std::floor(childAtIndex(0).approximateWithValueForSymbol<float>(
             symbol, x2, context, complexFormat, angleUnit));
-  } else if (type() == ExpressionNode::Type::AbsoluteValue ||
-             type() == ExpressionNode::Type::SignFunction) {
+  } else if (type() == ExpressionNode::Type::AbsoluteValue) {
     // is discontinuous if the child changes sign
     isDiscontinuous =
         (childAtIndex(0).approximateWithValueForSymbol<float>(
@@ -1,4 +1,5 @@
 #include <ion.h>
+#include <omg/instance_local.h>
 #include <poincare/addition.h>
 #include <poincare/code_point_layout.h>
 #include <poincare/comparison.h>
@@ -36,8 +37,10 @@ namespace Poincare {
  * TODO: we might want to go back to allocating the native_uint_t arrays on the
  * stack once we increase the stack size from 32k to? */
 
-static native_uint_t s_workingBuffer[Integer::k_maxNumberOfDigits + 1];
-static native_uint_t s_workingBufferDivision[Integer::k_maxNumberOfDigits + 1];
+static OMG_INSTANCE_LOCAL native_uint_t
+    s_workingBuffer[Integer::k_maxNumberOfDigits + 1];
+static OMG_INSTANCE_LOCAL native_uint_t
+    s_workingBufferDivision[Integer::k_maxNumberOfDigits + 1];
 
 static inline int8_t sign(bool negative) { return 1 - 2 * (int8_t)negative; }
 
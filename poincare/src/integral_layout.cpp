@@ -176,6 +176,16 @@ KDCoordinate IntegralLayoutNode::boundMaxHeight(BoundPosition position,
   return max;
 }
 
+void IntegralLayoutNode::invalidDependentSizesAndBaselines() {
+  LayoutNode::invalidDependentSizesAndBaselines();
+  /* Integrals in a row share their bounds heights and central argument
+   * height: the ones nested in this integral depend on it. */
+  for (IntegralLayoutNode *p = nextNestedIntegral(); p != nullptr;
+       p = p->nextNestedIntegral()) {
+    p->invalidSizeAndBaseline();
+  }
+}
+
 // clang-format off
 /*
  * Window configuration explained :
@@ -0,0 +1,392 @@
+#include <poincare/dependency.h>
+#include <poincare/float.h>
+#include <poincare/interval.h>
+#include <poincare/symbol.h>
+#include <poincare/trigonometry.h>
+#include <string.h>
+
+#include <algorithm>
+#include <limits>
+
+namespace Poincare {
+
+template <typename T>
+Interval<T> Interval<T>::Widened(T lower, T upper) {
+  /* A correctly rounded operation is off by less than one unit in the last
+   * place, hence bounds moved to their neighbouring floats enclose the exact
+   * result. */
+  return Interval(std::nextafter(lower, static_cast<T>(-INFINITY)),
+                  std::nextafter(upper, static_cast<T>(INFINITY)));
+}
+
+template <typename T>
+Interval<T> Interval<T>::WidenedByLibmError(T lower, T upper) {
+  /* The relative error is complemented by the smallest normal number, for
+   * results which are close to 0 or subnormal. The rounding of the new
+   * bounds only eats up one of the ulps. */
+  constexpr T relativeError = k_libmErrorInUlps * Float<T>::Epsilon();
+  constexpr T absoluteError = std::numeric_limits<T>::min();
+  return Interval(lower - (std::fabs(lower) * relativeError + absoluteError),
+                  upper + (std::fabs(upper) * relativeError + absoluteError));
+}
+
+template <typename T>
+T Interval<T>::RoundedDown(T result, T error) {
+  return error < static_cast<T>(0.)
+             ? std::nextafter(result, static_cast<T>(-INFINITY))
+             : result;
+}
+
+template <typename T>
+T Interval<T>::RoundedUp(T result, T error) {
+  return error > static_cast<T>(0.)
+             ? std::nextafter(result, static_cast<T>(INFINITY))
+             : result;
+}
+
+template <typename T>
+T Interval<T>::SumError(T a, T b, T sum) {
+  // Exact since a + b = sum + error (Knuth's TwoSum)
+  T bRounded = sum - a;
+  return (a - (sum - bRounded)) + (b - bRounded);
+}
+
+template <typename T>
+Interval<T> Interval<T>::Opposite(Interval a) {
+  return Interval(-a.m_upper, -a.m_lower);
+}
+
+template <typename T>
+Interval<T> Interval<T>::Sum(Interval a, Interval b) {
+  T lower = a.m_lower + b.m_lower;
+  T upper = a.m_upper + b.m_upper;
+  return Interval(RoundedDown(lower, SumError(a.m_lower, b.m_lower, lower)),
+                  RoundedUp(upper, SumError(a.m_upper, b.m_upper, upper)));
+}
+
+template <typename T>
+Interval<T> Interval<T>::Product(Interval a, Interval b) {
+  if (a.isUnknown() || b.isUnknown()) {
+    return Unknown();
+  }
+  T factorsA[] = {a.m_lower, a.m_upper};
+  T factorsB[] = {b.m_lower, b.m_upper};
+  T lower = static_cast<T>(INFINITY);
+  T upper = static_cast<T>(-INFINITY);
+  for (T factorA : factorsA) {
+    for (T factorB : factorsB) {
+      T product = factorA * factorB;
+      if (std::isnan(product)) {
+        // 0×∞ is undefined
+        return Unknown();
+      }
+      // Exact since factorA × factorB = product + error
+      T error = std::fma(factorA, factorB, -product);
+      lower = std::min(lower, RoundedDown(product, error));
+      upper = std::max(upper, RoundedUp(product, error));
+    }
+  }
+  return Interval(lower, upper);
+}
+
+template <typename T>
+Interval<T> Interval<T>::Inverse(Interval a) {
+  if (a.contains(static_cast<T>(0.))) {
+    return Unknown();
+  }
+  return Widened(static_cast<T>(1.) / a.m_upper,
+                 static_cast<T>(1.) / a.m_lower);
+}
+
+template <typename T>
+Interval<T> Interval<T>::IntegerPower(Interval a, int n) {
+  if (n < 0) {
+    return Inverse(IntegerPower(a, -n));
+  }
+  if (n == 0) {
+    // 0^0 is undefined
+    return a.contains(static_cast<T>(0.)) ? Unknown() : Interval(1., 1.);
+  }
+  T lowerPower = std::pow(a.m_lower, static_cast<T>(n));
+  T upperPower = std::pow(a.m_upper, static_cast<T>(n));
+  if (n % 2 == 1 || a.m_lower >= static_cast<T>(0.)) {
+    return WidenedByLibmError(lowerPower, upperPower);
+  }
+  if (a.m_upper <= static_cast<T>(0.)) {
+    return WidenedByLibmError(upperPower, lowerPower);
+  }
+  Interval result = WidenedByLibmError(static_cast<T>(0.),
+                                       std::max(lowerPower, upperPower));
+  result.m_lower = static_cast<T>(0.);
+  return result;
+}
+
+template <typename T>
+Interval<T> Interval<T>::Power(Interval a, Interval b) {
+  // Non integer powers of negative numbers are not real
+  if (a.isUnknown() || a.m_lower <= static_cast<T>(0.)) {
+    return Unknown();
+  }
+  return Exponential(Product(b, Logarithm(a)));
+}
+
+template <typename T>
+Interval<T> Interval<T>::SquareRoot(Interval a) {
+  if (a.isUnknown() || a.m_lower < static_cast<T>(0.)) {
+    return Unknown();
+  }
+  Interval result = Widened(std::sqrt(a.m_lower), std::sqrt(a.m_upper));
+  result.m_lower = std::max(result.m_lower, static_cast<T>(0.));
+  return result;
+}
+
+template <typename T>
+Interval<T> Interval<T>::Exponential(Interval a) {
+  Interval result =
+      WidenedByLibmError(std::exp(a.m_lower), std::exp(a.m_upper));
+  if (!result.isUnknown()) {
+    result.m_lower = std::max(result.m_lower, static_cast<T>(0.));
+  }
+  return result;
+}
+
+template <typename T>
+Interval<T> Interval<T>::Logarithm(Interval a) {
+  if (a.isUnknown() || a.m_lower <= static_cast<T>(0.)) {
+    return Unknown();
+  }
+  return WidenedByLibmError(std::log(a.m_lower), std::log(a.m_upper));
+}
+
+template <typename T>
+Interval<T> Interval<T>::AbsoluteValue(Interval a) {
+  if (a.isUnknown() || a.m_lower >= static_cast<T>(0.)) {
+    return a;
+  }
+  if (a.m_upper <= static_cast<T>(0.)) {
+    return Opposite(a);
+  }
+  return Interval(static_cast<T>(0.), std::max(-a.m_lower, a.m_upper));
+}
+
+template <typename T>
+Interval<T> Interval<T>::Floor(Interval a) {
+  return Interval(std::floor(a.m_lower), std::floor(a.m_upper));
+}
+
+template <typename T>
+Interval<T> Interval<T>::Ceiling(Interval a) {
+  return Interval(std::ceil(a.m_lower), std::ceil(a.m_upper));
+}
+
+template <typename T>
+Interval<T> Interval<T>::Sign(Interval a) {
+  if (a.isUnknown()) {
+    return Unknown();
+  }
+  constexpr T zero = static_cast<T>(0.);
+  constexpr T one = static_cast<T>(1.);
+  return Interval(a.m_lower < zero ? -one : a.m_lower > zero ? one : zero,
+                  a.m_upper < zero ? -one : a.m_upper > zero ? one : zero);
+}
+
+template <typename T>
+bool Interval<T>::ContainsPeriodicPoint(Interval a, T phase) {
+  // Return true if a contains phase + 2kπ for some integer k
+  constexpr T twoPi = static_cast<T>(2. * M_PI);
+  T k = std::ceil((a.m_lower - phase) / twoPi);
+  return phase + k * twoPi <= a.m_upper;
+}
+
+template <typename T>
+Interval<T> Interval<T>::Sine(Interval a) {
+  return Cosine(Sum(a, Point(static_cast<T>(-M_PI_2))));
+}
+
+template <typename T>
+Interval<T> Interval<T>::Cosine(Interval a) {
+  if (a.isUnknown()) {
+    return Unknown();
+  }
+  constexpr T one = static_cast<T>(1.);
+  /* Beyond this magnitude, the position of a within its period is too
+   * imprecise to locate the extrema. */
+  constexpr T maximalMagnitude = one / Float<T>::SqrtEpsilonLax();
+  if (!(a.m_upper - a.m_lower < static_cast<T>(2. * M_PI)) ||
+      std::max(std::fabs(a.m_lower), std::fabs(a.m_upper)) >
+          maximalMagnitude) {
+    return Interval(-one, one);
+  }
+  // a is widened to absorb the imprecision of the extrema localization
+  a = Widened(a.m_lower, a.m_upper);
+  T cosLower = std::cos(a.m_lower);
+  T cosUpper = std::cos(a.m_upper);
+  Interval result = WidenedByLibmError(std::min(cosLower, cosUpper),
+                                       std::max(cosLower, cosUpper));
+  if (ContainsPeriodicPoint(a, static_cast<T>(0.))) {
+    result.m_upper = one;
+  }
+  if (ContainsPeriodicPoint(a, static_cast<T>(M_PI))) {
+    result.m_lower = -one;
+  }
+  result.m_lower = std::max(result.m_lower, -one);
+  result.m_upper = std::min(result.m_upper, one);
+  return result;
+}
+
+template <typename T>
+Interval<T> Interval<T>::ArcTangent(Interval a) {
+  return WidenedByLibmError(std::atan(a.m_lower), std::atan(a.m_upper));
+}
+
+template <typename T>
+Interval<T> Interval<T>::ForExpression(const Expression e, const char* symbol,
+                                       T xMin, T xMax, Context* context,
+                                       Preferences::ComplexFormat complexFormat,
+                                       Preferences::AngleUnit angleUnit) {
+  // NAN bounds yield an unknown interval
+  assert(!(xMax < xMin));
+  Parameters parameters = {.symbol = symbol,
+                           .xMin = xMin,
+                           .xMax = xMax,
+                           .context = context,
+                           .complexFormat = complexFormat,
+                           .angleUnit = angleUnit};
+  return Enclose(e, &parameters);
+}
+
+template <typename T>
+Interval<T> Interval<T>::Enclose(const Expression e,
+                                 const Parameters* parameters) {
+  Interval<T> result;
+  int n = e.numberOfChildren();
+  switch (e.type()) {
+    case ExpressionNode::Type::Symbol:
+      if (strcmp(static_cast<const Symbol&>(e).name(), parameters->symbol) ==
+          0) {
+        return Interval(parameters->xMin, parameters->xMax);
+      }
+      break;
+    case ExpressionNode::Type::Parenthesis:
+      return EncloseChild(e, 0, parameters);
+    case ExpressionNode::Type::Dependency: {
+      Expression dependencies =
+          e.childAtIndex(Dependency::k_indexOfDependenciesList);
+      if (dependencies.type() != ExpressionNode::Type::List) {
+        return Unknown();
+      }
+      int numberOfDependencies = dependencies.numberOfChildren();
+      for (int i = 0; i < numberOfDependencies; i++) {
+        if (EncloseChild(dependencies, i, parameters).isUnknown()) {
+          return Unknown();
+        }
+      }
+      return EncloseChild(e, Dependency::k_indexOfMainExpression, parameters);
+    }
+    case ExpressionNode::Type::Addition:
+      result = EncloseChild(e, 0, parameters);
+      for (int i = 1; i < n; i++) {
+        result = Sum(result, EncloseChild(e, i, parameters));
+      }
+      return result;
+    case ExpressionNode::Type::Subtraction:
+      return Sum(EncloseChild(e, 0, parameters),
+                 Opposite(EncloseChild(e, 1, parameters)));
+    case ExpressionNode::Type::Opposite:
+      return Opposite(EncloseChild(e, 0, parameters));
+    case ExpressionNode::Type::Multiplication:
+      result = EncloseChild(e, 0, parameters);
+      for (int i = 1; i < n; i++) {
+        result = Product(result, EncloseChild(e, i, parameters));
+      }
+      return result;
+    case ExpressionNode::Type::Division:
+      return Product(EncloseChild(e, 0, parameters),
+                     Inverse(EncloseChild(e, 1, parameters)));
+    case ExpressionNode::Type::Power: {
+      Expression exponent = e.childAtIndex(1);
+      if (!exponent.recursivelyMatches(Expression::IsSymbolic,
+                                       parameters->context)) {
+        T value = exponent.approximateToScalar<T>(parameters->context,
+                                                  parameters->complexFormat,
+                                                  parameters->angleUnit);
+        constexpr T maximalExponent = static_cast<T>(INT8_MAX);
+        if (std::round(value) == value && std::fabs(value) <= maximalExponent) {
+          return IntegerPower(EncloseChild(e, 0, parameters),
+                              static_cast<int>(value));
+        }
+      }
+      return Power(EncloseChild(e, 0, parameters),
+                   EncloseChild(e, 1, parameters));
+    }
+    case ExpressionNode::Type::SquareRoot:
+      return SquareRoot(EncloseChild(e, 0, parameters));
+    case ExpressionNode::Type::NthRoot:
+      return Power(EncloseChild(e, 0, parameters),
+                   Inverse(EncloseChild(e, 1, parameters)));
+    case ExpressionNode::Type::NaperianLogarithm:
+      return Logarithm(EncloseChild(e, 0, parameters));
+    case ExpressionNode::Type::Logarithm: {
+      Interval base = n == 1 ? Point(static_cast<T>(10.))
+                             : EncloseChild(e, 1, parameters);
+      return Product(Logarithm(EncloseChild(e, 0, parameters)),
+                     Inverse(Logarithm(base)));
+    }
+    case ExpressionNode::Type::AbsoluteValue:
+      return AbsoluteValue(EncloseChild(e, 0, parameters));
+    case ExpressionNode::Type::Floor:
+      return Floor(EncloseChild(e, 0, parameters));
+    case ExpressionNode::Type::Ceiling:
+      return Ceiling(EncloseChild(e, 0, parameters));
+    case ExpressionNode::Type::SignFunction:
+      return Sign(EncloseChild(e, 0, parameters));
+    case ExpressionNode::Type::Sine:
+    case ExpressionNode::Type::Cosine: {
+      Interval radians = Product(
+          EncloseChild(e, 0, parameters),
+          Point(static_cast<T>(M_PI / Trigonometry::PiInAngleUnit(
+                                          parameters->angleUnit))));
+      return e.type() == ExpressionNode::Type::Sine ? Sine(radians)
+                                                    : Cosine(radians);
+    }
+    case ExpressionNode::Type::ArcTangent:
+      return Product(ArcTangent(EncloseChild(e, 0, parameters)),
+                     Point(static_cast<T>(Trigonometry::PiInAngleUnit(
+                                              parameters->angleUnit) /
+                                          M_PI)));
+    default:
+      break;
+  }
+  /* Other nodes are only enclosed when they do not depend on the symbol, as
+   * a single value. */
+  if (e.recursivelyMatches(
+          [](const Expression e, Context* context, void* symbol) {
+            return Expression::IsRandom(e, context) ||
+                   (e.type() == ExpressionNode::Type::Symbol &&
+                    strcmp(static_cast<const Symbol&>(e).name(),
+                           static_cast<const char*>(symbol)) == 0);
+          },
+          parameters->context,
+          SymbolicComputation::ReplaceAllDefinedSymbolsWithDefinition,
+          const_cast<char*>(parameters->symbol))) {
+    return Unknown();
+  }
+  T value = e.approximateToScalar<T>(parameters->context,
+                                     parameters->complexFormat,
+                                     parameters->angleUnit);
+  if (!std::isfinite(value)) {
+    return Unknown();
+  }
+  // Small integers are approximated exactly
+  if ((e.type() == ExpressionNode::Type::BasedInteger ||
+       e.type() == ExpressionNode::Type::Rational) &&
+      e.isInteger() && std::fabs(value) * Float<T>::Epsilon() < 1) {
+    return Interval(value, value);
+  }
+  return WidenedByLibmError(value, value);
+}
+
+template class Interval<float>;
+template class Interval<double>;
+
+}  // namespace Poincare
@@ -132,6 +132,66 @@ Layout Layout::childAtIndex(int i) const {
   return static_cast<Layout &>(c);
 }
 
+void Layout::replaceWithInPlace(TreeHandle t) {
+  Layout p = parent();
+  TreeHandle formerParent = t.parent();
+  TreeHandle::replaceWithInPlace(t);
+  InvalidSizesAndBaselinesUpToRoot(p);
+  InvalidSizesAndBaselinesUpToRoot(formerParent);
+}
+
+void Layout::replaceChildInPlace(TreeHandle oldChild, TreeHandle newChild) {
+  TreeHandle formerParent = newChild.parent();
+  TreeHandle::replaceChildInPlace(oldChild, newChild);
+  InvalidSizesAndBaselinesUpToRoot(*this);
+  InvalidSizesAndBaselinesUpToRoot(formerParent);
+}
+
+void Layout::replaceChildAtIndexInPlace(int oldChildIndex,
+                                        TreeHandle newChild) {
+  assert(oldChildIndex >= 0 && oldChildIndex < numberOfChildren());
+  replaceChildInPlace(TreeHandle::childAtIndex(oldChildIndex), newChild);
+}
+
+void Layout::mergeChildrenAtIndexInPlace(TreeHandle t, int i) {
+  TreeHandle::mergeChildrenAtIndexInPlace(t, i);
+  InvalidSizesAndBaselinesUpToRoot(*this);
+}
+
+void Layout::swapChildrenInPlace(int i, int j) {
+  TreeHandle::swapChildrenInPlace(i, j);
+  InvalidSizesAndBaselinesUpToRoot(*this);
+}
+
+void Layout::addChildAtIndexInPlace(TreeHandle t, int index,
+                                    int currentNumberOfChildren) {
+  TreeHandle formerParent = t.parent();
+  TreeHandle::addChildAtIndexInPlace(t, index, currentNumberOfChildren);
+  InvalidSizesAndBaselinesUpToRoot(*this);
+  InvalidSizesAndBaselinesUpToRoot(formerParent);
+}
+
+void Layout::removeChildAtIndexInPlace(int i) {
+  TreeHandle::removeChildAtIndexInPlace(i);
+  InvalidSizesAndBaselinesUpToRoot(*this);
+}
+
+void Layout::removeChildInPlace(TreeHandle t, int childNumberOfChildren) {
+  TreeHandle::removeChildInPlace(t, childNumberOfChildren);
+  InvalidSizesAndBaselinesUpToRoot(*this);
+}
+
+void Layout::removeChildrenInPlace(int currentNumberOfChildren) {
+  TreeHandle::removeChildrenInPlace(currentNumberOfChildren);
+  InvalidSizesAndBaselinesUpToRoot(*this);
+}
+
+void Layout::InvalidSizesAndBaselinesUpToRoot(TreeHandle l) {
+  if (!l.isUninitialized()) {
+    static_cast<LayoutNode *>(l.node())->invalidSizesAndBaselinesUpToRoot();
+  }
+}
+
 bool Layout::privateHasTopLevelComparisonSymbol(
     bool includingNotEqualSymbol) const {
   if (type() != Poincare::LayoutNode::Type::HorizontalLayout) {
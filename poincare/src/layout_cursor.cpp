@@ -1000,7 +1000,7 @@ void LayoutCursor::invalidateSizesAndPositions() {
   while (!layoutToInvalidate.parent().isUninitialized()) {
     layoutToInvalidate = layoutToInvalidate.parent();
   }
-  layoutToInvalidate.invalidAllSizesPositionsAndBaselines();
+  layoutToInvalidate.invalidEditedSizesAndAllPositions();
 }
 
 void LayoutCursor::privateDelete(LayoutNode::DeletionMethod deletionMethod,
@@ -130,14 +130,37 @@ KDCoordinate LayoutNode::baseline(KDFont::Size font) {
 }
 
 void LayoutNode::invalidAllSizesPositionsAndBaselines() {
-  m_flags.m_sized = false;
+  invalidSizeAndBaseline();
   m_flags.m_positioned = false;
-  m_flags.m_baselined = false;
   for (LayoutNode *l : children()) {
     l->invalidAllSizesPositionsAndBaselines();
   }
 }
 
+void LayoutNode::invalidSizesAndBaselinesUpToRoot() {
+  for (LayoutNode *l = this; l != nullptr; l = l->parent()) {
+    l->invalidSizeAndBaseline();
+  }
+}
+
+void LayoutNode::invalidEditedSizesAndAllPositions() {
+  /* Children are visited first: the ones invalidated by their edited parent
+   * do not invalidate their own children in turn. */
+  for (LayoutNode *l : children()) {
+    l->invalidEditedSizesAndAllPositions();
+  }
+  m_flags.m_positioned = false;
+  if (sizeOrBaselineIsInvalid()) {
+    invalidDependentSizesAndBaselines();
+  }
+}
+
+void LayoutNode::invalidDependentSizesAndBaselines() {
+  for (LayoutNode *l : children()) {
+    l->invalidSizeAndBaseline();
+  }
+}
+
 int LayoutNode::indexAfterHorizontalCursorMove(
     OMG::HorizontalDirection direction, int currentIndex,
     bool *shouldRedrawLayout) {
@@ -9,6 +9,11 @@ namespace Poincare {
 template <typename T>
 std::complex<T> ListComplexNode<T>::complexAtIndex(int index) const {
   assert(index < m_numberOfChildren);
+  if (m_hasOnlyComplexChildren) {
+    assert(EvaluationNode<T>::childAtIndex(index)->type() ==
+           EvaluationNode<T>::Type::Complex);
+    return *ComplexNode<T>::ChildAtIndex(this, index);
+  }
   EvaluationNode<T> *child = EvaluationNode<T>::childAtIndex(index);
   if (child->type() == EvaluationNode<T>::Type::Complex) {
     return *(static_cast<ComplexNode<T> *>(child));
@@ -49,9 +54,18 @@ void ListComplex<T>::addChildAtIndexInPlace(Evaluation<T> t, int index,
   if (!isScalarEvaluationType<T>(t.type())) {
     t = Complex<T>::Undefined();
   }
+  if (t.type() != EvaluationNode<T>::Type::Complex) {
+    node()->setHasOnlyComplexChildren(false);
+  }
   Evaluation<T>::addChildAtIndexInPlace(t, index, currentNumberOfChildren);
 }
 
+template <typename T>
+ListComplex<T> ListComplex<T>::clone() const {
+  TreeHandle c = TreeHandle::clone();
+  return ListComplex<T>(static_cast<ListComplexNode<T> *>(c.node()));
+}
+
 template <typename T>
 ListComplex<T> ListComplex<T>::Undefined() {
   ListComplex<T> undefList = ListComplex<T>::Builder();
@@ -68,11 +82,23 @@ ListComplex<T> ListComplex<T>::sort() {
         ListComplex<T> *list = reinterpret_cast<ListComplex<T> *>(context);
         assert(list->numberOfChildren() == n && 0 <= i && 0 <= j && i < n &&
                j < n);
+        if (list->hasOnlyComplexChildren()) {
+          // Swap the values instead of moving the nodes around the pool
+          std::complex<T> c = list->complexAtIndex(i);
+          list->setComplexAtIndex(i, list->complexAtIndex(j));
+          list->setComplexAtIndex(j, c);
+          return;
+        }
         list->swapChildrenInPlace(i, j);
       },
       // Compare
       [](int i, int j, void *context, int numberOfElements) {
         ListComplex<T> *list = reinterpret_cast<ListComplex<T> *>(context);
+        if (list->hasOnlyComplexChildren()) {
+          float xI = list->valueAtIndex(i);
+          float xJ = list->valueAtIndex(j);
+          return Helpers::FloatIsGreater(xI, xJ, ListSort::k_nanIsGreatest);
+        }
 
         Evaluation<T> eI = list->childAtIndex(i);
         Evaluation<T> eJ = list->childAtIndex(j);
@@ -13,11 +13,11 @@ namespace Poincare {
 
 template <typename T>
 std::complex<T> MatrixComplexNode<T>::complexAtIndex(int index) const {
-  EvaluationNode<T> *child = EvaluationNode<T>::childAtIndex(index);
-  if (child->type() == EvaluationNode<T>::Type::Complex) {
-    return *(static_cast<ComplexNode<T> *>(child));
-  }
-  return std::complex<T>(NAN, NAN);
+  // MatrixComplex::addChildAtIndexInPlace only adds ComplexNodes
+  assert(index < numberOfChildren());
+  assert(EvaluationNode<T>::childAtIndex(index)->type() ==
+         EvaluationNode<T>::Type::Complex);
+  return *ComplexNode<T>::ChildAtIndex(this, index);
 }
 
 template <typename T>
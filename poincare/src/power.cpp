@@ -275,6 +275,17 @@ Complex<T> PowerNode::computeOnComplex(
           result, precision, d, false));
 }
 
+template <typename T>
+T PowerNode::computeOnReals(T a, T b) {
+  /* Real results of computeOnComplex: a non-null base and either a positive
+   * base or an integer index. Infinite indexes are left to computeOnComplex. */
+  if (a == static_cast<T>(0.0) || std::isinf(b) ||
+      (a < static_cast<T>(0.0) && std::round(b) != b)) {
+    return NAN;
+  }
+  return std::pow(a, b);
+}
+
 // Layout
 
 Layout PowerNode::createLayout(Preferences::PrintFloatMode floatDisplayMode,
@@ -403,16 +414,15 @@ MatrixComplex<T> PowerNode::computeOnMatrixAndComplex(
 template <typename T>
 Evaluation<T> PowerNode::templatedApproximate(
     const ApproximationContext &approximationContext) const {
+  /* The base is approximated once for both the special case and the default
+   * approximation, since it can be a whole list. */
+  Evaluation<T> base = childAtIndex(0)->approximate(T(), approximationContext);
   /* Special case: c^(p/q) with p, q integers
    * In real mode, c^(p/q) might have a real root which is not the principal
    * root. We return this value in that case to avoid returning "nonreal". */
   if (approximationContext.complexFormat() ==
-      Preferences::ComplexFormat::Real) {
-    Evaluation<T> base =
-        childAtIndex(0)->approximate(T(), approximationContext);
-    if (base.type() != EvaluationNode<T>::Type::Complex) {
-      goto defaultApproximation;
-    }
+          Preferences::ComplexFormat::Real &&
+      base.type() == EvaluationNode<T>::Type::Complex) {
     std::complex<T> c = base.complexAtIndex(0);
     T p = NAN;
     T q = NAN;
@@ -434,26 +444,32 @@ Evaluation<T> PowerNode::templatedApproximate(
           static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(0));
       const RationalNode *qRat =
           static_cast<const RationalNode *>(childAtIndex(1)->childAtIndex(1));
-      if (!pRat->denominator().isOne() || !qRat->denominator().isOne()) {
-        goto defaultApproximation;
+      if (pRat->denominator().isOne() && qRat->denominator().isOne()) {
+        p = pRat->signedNumerator().approximate<T>();
+        q = qRat->signedNumerator().approximate<T>();
       }
-      p = pRat->signedNumerator().approximate<T>();
-      q = qRat->signedNumerator().approximate<T>();
     }
     /* We don't handle power that haven't been reduced or simplified as the
      * index can take to many forms and still be equivalent to p/q,
      * with p, q integers. */
-    if (std::isnan(p) || std::isnan(q)) {
-      goto defaultApproximation;
-    }
-    Complex<T> result = computeNotPrincipalRealRootOfRationalPow(c, p, q);
-    if (!result.isUndefined()) {
-      return std::move(result);
+    if (!std::isnan(p) && !std::isnan(q)) {
+      Complex<T> result = computeNotPrincipalRealRootOfRationalPow(c, p, q);
+      if (!result.isUndefined()) {
+        return std::move(result);
+      }
     }
   }
-defaultApproximation:
-  return ApproximationHelper::MapReduce<T>(this, approximationContext,
-                                           Compute<T>);
+  // Same as ApproximationHelper::MapReduce, with the base already approximated
+  if (base.isUndefined()) {
+    return Complex<T>::Undefined();
+  }
+  Evaluation<T> result =
+      Compute<T>(base, childAtIndex(1)->approximate(T(), approximationContext),
+                 approximationContext.complexFormat());
+  if (result.isUndefined()) {
+    return Complex<T>::Undefined();
+  }
+  return result;
 }
 
 // Power
@@ -1792,6 +1808,8 @@ template Complex<float> PowerNode::computeOnComplex<float>(
     std::complex<float>, std::complex<float>, Preferences::ComplexFormat);
 template Complex<double> PowerNode::computeOnComplex<double>(
     std::complex<double>, std::complex<double>, Preferences::ComplexFormat);
+template float PowerNode::computeOnReals<float>(float, float);
+template double PowerNode::computeOnReals<double>(double, double);
 
 template Complex<double> PowerNode::computeNotPrincipalRealRootOfRationalPow<
     double>(std::complex<double>, double, double);
@@ -12,7 +12,7 @@ constexpr int Preferences::MediumNumberOfSignificantDigits;
 constexpr int Preferences::ShortNumberOfSignificantDigits;
 constexpr int Preferences::VeryShortNumberOfSignificantDigits;
 
-OMG::GlobalBox<Preferences> Preferences::sharedPreferences;
+OMG_INSTANCE_LOCAL OMG::GlobalBox<Preferences> Preferences::sharedPreferences;
 
 Preferences::Preferences()
     : m_angleUnit(AngleUnit::Radian),
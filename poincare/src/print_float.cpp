@@ -1,18 +1,12 @@
 #include <ion/unicode/utf8_decoder.h>
-#include <ion/unicode/utf8_helper.h>
-#include <poincare/decimal.h>
 #include <poincare/ieee754.h>
 #include <poincare/infinity.h>
 #include <poincare/preferences.h>
 #include <poincare/print_float.h>
-#include <poincare/print_int.h>
-#include <poincare/serialization_helper.h>
 #include <poincare/undefined.h>
 extern "C" {
 #include <assert.h>
-#include <float.h>
-#include <limits.h>
-#include <stdlib.h>
+#include <stdint.h>
 #include <string.h>
 }
 #include <algorithm>
@@ -20,141 +14,811 @@ extern "C" {
 
 namespace Poincare {
 
-constexpr int PrintFloat::Long::k_maxNumberOfCharsForDigit;
+/* Digits of floats
+ *
+ * The digits are computed from the exact binary value m*2^e of the float, so
+ * that they are correctly rounded, and so that the shortest digits are read
+ * back as the same float.
+ * As in Grisu [Loitsch, "Printing floating-point numbers quickly and
+ * accurately with integers", 2010], the float is first multiplied by a cached
+ * power of ten with 64-bit integers. The scaled value is off by less than one
+ * unit in its last place, which is enough to decide the digits in almost all
+ * cases. Otherwise, the digits are computed again exactly with big integers,
+ * as in Dragon4 [Steele and White, "How to print floating-point numbers
+ * accurately", 1990]. */
 
-PrintFloat::Long::Long(int64_t i) : m_negative(i < 0) {
-  int64_t nonNegativeI = m_negative ? -i : i;
-  m_digits[1] = 0 + (nonNegativeI % k_base);
-  m_digits[0] = (nonNegativeI - m_digits[1]) / k_base;
+// DiyFp
+
+class PrintFloat::DiyFp {
+ public:
+  constexpr static int k_significandSize = 64;
+
+  DiyFp(uint64_t significand = 0, int exponent = 0)
+      : m_significand(significand), m_exponent(exponent) {}
+  uint64_t significand() const { return m_significand; }
+  int exponent() const { return m_exponent; }
+
+  DiyFp normalized() const {
+    assert(m_significand != 0);
+    uint64_t significand = m_significand;
+    int exponent = m_exponent;
+    constexpr uint64_t k_tenHighestBits = static_cast<uint64_t>(0x3FF) << 54;
+    while ((significand & k_tenHighestBits) == 0) {
+      significand <<= 10;
+      exponent -= 10;
+    }
+    while ((significand & k_highestBit) == 0) {
+      significand <<= 1;
+      exponent--;
+    }
+    return DiyFp(significand, exponent);
+  }
+
+  // Product rounded to 64 bits, with an error of at most half a unit
+  static DiyFp Multiply(DiyFp x, DiyFp y) {
+    constexpr uint64_t k_lowBits = 0xFFFFFFFF;
+    uint64_t a = x.m_significand >> 32;
+    uint64_t b = x.m_significand & k_lowBits;
+    uint64_t c = y.m_significand >> 32;
+    uint64_t d = y.m_significand & k_lowBits;
+    uint64_t ac = a * c;
+    uint64_t bc = b * c;
+    uint64_t ad = a * d;
+    uint64_t bd = b * d;
+    uint64_t middle = (bd >> 32) + (ad & k_lowBits) + (bc & k_lowBits) +
+                      (static_cast<uint64_t>(1) << 31);
+    return DiyFp(ac + (ad >> 32) + (bc >> 32) + (middle >> 32),
+                 x.m_exponent + y.m_exponent + k_significandSize);
+  }
+
+ private:
+  constexpr static uint64_t k_highestBit = static_cast<uint64_t>(1) << 63;
+
+  uint64_t m_significand;
+  int m_exponent;
+};
+
+// BigNumber
+
+class PrintFloat::BigNumber {
+ public:
+  BigNumber(uint64_t value = 0) : m_numberOfDigits(0) {
+    while (value != 0) {
+      m_digits[m_numberOfDigits++] = static_cast<uint32_t>(value);
+      value >>= 32;
+    }
+  }
+
+  void multiplyBy(uint32_t factor) {
+    uint64_t carry = 0;
+    for (int i = 0; i < m_numberOfDigits; i++) {
+      uint64_t product = static_cast<uint64_t>(m_digits[i]) * factor + carry;
+      m_digits[i] = static_cast<uint32_t>(product);
+      carry = product >> 32;
+    }
+    if (carry != 0) {
+      assert(m_numberOfDigits < k_maxNumberOfDigits);
+      m_digits[m_numberOfDigits++] = static_cast<uint32_t>(carry);
+    }
+  }
+
+  void multiplyByPowerOfTen(int exponent) {
+    assert(exponent >= 0);
+    constexpr uint32_t k_largestPowerOfTen = 1000000000;
+    for (; exponent >= 9; exponent -= 9) {
+      multiplyBy(k_largestPowerOfTen);
+    }
+    uint32_t factor = 1;
+    for (; exponent > 0; exponent--) {
+      factor *= 10;
+    }
+    multiplyBy(factor);
+  }
+
+  void shiftLeft(int shift) {
+    assert(shift >= 0);
+    if (m_numberOfDigits == 0) {
+      return;
+    }
+    int digitShift = shift / 32;
+    int bitShift = shift % 32;
+    assert(m_numberOfDigits + digitShift + 1 <= k_maxNumberOfDigits);
+    m_digits[m_numberOfDigits + digitShift] = 0;
+    for (int i = m_numberOfDigits - 1; i >= 0; i--) {
+      uint64_t shifted = static_cast<uint64_t>(m_digits[i]) << bitShift;
+      m_digits[i + digitShift + 1] |= static_cast<uint32_t>(shifted >> 32);
+      m_digits[i + digitShift] = static_cast<uint32_t>(shifted);
+    }
+    for (int i = 0; i < digitShift; i++) {
+      m_digits[i] = 0;
+    }
+    m_numberOfDigits += digitShift + 1;
+    trim();
+  }
+
+  void add(const BigNumber& other) {
+    int numberOfDigits = std::max(m_numberOfDigits, other.m_numberOfDigits);
+    uint64_t carry = 0;
+    for (int i = 0; i < numberOfDigits; i++) {
+      uint64_t sum = carry + digit(i) + other.digit(i);
+      m_digits[i] = static_cast<uint32_t>(sum);
+      carry = sum >> 32;
+    }
+    m_numberOfDigits = numberOfDigits;
+    if (carry != 0) {
+      assert(m_numberOfDigits < k_maxNumberOfDigits);
+      m_digits[m_numberOfDigits++] = static_cast<uint32_t>(carry);
+    }
+  }
+
+  // this must be greater than other
+  void subtract(const BigNumber& other) {
+    assert(Compare(*this, other) >= 0);
+    uint32_t borrow = 0;
+    for (int i = 0; i < m_numberOfDigits; i++) {
+      uint64_t subtrahend = static_cast<uint64_t>(other.digit(i)) + borrow;
+      borrow = m_digits[i] < subtrahend;
+      m_digits[i] = static_cast<uint32_t>(m_digits[i] - subtrahend);
+    }
+    assert(borrow == 0);
+    trim();
+  }
+
+  /* Divide by a divisor at most 10 times smaller, keep the remainder and
+   * return the quotient. */
+  int divideModulo(const BigNumber& divisor) {
+    int quotient = 0;
+    while (Compare(*this, divisor) >= 0) {
+      subtract(divisor);
+      quotient++;
+    }
+    assert(quotient < 10);
+    return quotient;
+  }
+
+  static int Compare(const BigNumber& a, const BigNumber& b) {
+    if (a.m_numberOfDigits != b.m_numberOfDigits) {
+      return a.m_numberOfDigits < b.m_numberOfDigits ? -1 : 1;
+    }
+    for (int i = a.m_numberOfDigits - 1; i >= 0; i--) {
+      if (a.m_digits[i] != b.m_digits[i]) {
+        return a.m_digits[i] < b.m_digits[i] ? -1 : 1;
+      }
+    }
+    return 0;
+  }
+
+  // Compare a + b with c
+  static int PlusCompare(const BigNumber& a, const BigNumber& b,
+                         const BigNumber& c) {
+    BigNumber sum = a;
+    sum.add(b);
+    return Compare(sum, c);
+  }
+
+ private:
+  /* Doubles are scaled up to about 2^1090 to compute their digits: the
+   * smallest denormal 2^-1074 is multiplied by 10^324 for instance, with
+   * room for the margins and the shifts. */
+  constexpr static int k_maxNumberOfDigits = 40;
+
+  uint32_t digit(int i) const { return i < m_numberOfDigits ? m_digits[i] : 0; }
+  void trim() {
+    while (m_numberOfDigits > 0 && m_digits[m_numberOfDigits - 1] == 0) {
+      m_numberOfDigits--;
+    }
+  }
+
+  uint32_t m_digits[k_maxNumberOfDigits];
+  int m_numberOfDigits;
+};
+
+// Cached powers of ten
+
+struct CachedPowerOfTen {
+  uint64_t significand;
+  int16_t binaryExponent;
+  int16_t decimalExponent;
+};
+
+/* Powers of ten from 10^-348 to 10^340, every 8 decimal exponents. Their
+ * significands are rounded to the nearest 64-bit integer. */
+constexpr static CachedPowerOfTen k_cachedPowersOfTen[] = {
+    {0xFA8FD5A0081C0288, -1220, -348},
+    {0xBAAEE17FA23EBF76, -1193, -340},
+    {0x8B16FB203055AC76, -1166, -332},
+    {0xCF42894A5DCE35EA, -1140, -324},
+    {0x9A6BB0AA55653B2D, -1113, -316},
+    {0xE61ACF033D1A45DF, -1087, -308},
+    {0xAB70FE17C79AC6CA, -1060, -300},
+    {0xFF77B1FCBEBCDC4F, -1034, -292},
+    {0xBE5691EF416BD60C, -1007, -284},
+    {0x8DD01FAD907FFC3C, -980, -276},
+    {0xD3515C2831559A83, -954, -268},
+    {0x9D71AC8FADA6C9B5, -927, -260},
+    {0xEA9C227723EE8BCB, -901, -252},
+    {0xAECC49914078536D, -874, -244},
+    {0x823C12795DB6CE57, -847, -236},
+    {0xC21094364DFB5637, -821, -228},
+    {0x9096EA6F3848984F, -794, -220},
+    {0xD77485CB25823AC7, -768, -212},
+    {0xA086CFCD97BF97F4, -741, -204},
+    {0xEF340A98172AACE5, -715, -196},
+    {0xB23867FB2A35B28E, -688, -188},
+    {0x84C8D4DFD2C63F3B, -661, -180},
+    {0xC5DD44271AD3CDBA, -635, -172},
+    {0x936B9FCEBB25C996, -608, -164},
+    {0xDBAC6C247D62A584, -582, -156},
+    {0xA3AB66580D5FDAF6, -555, -148},
+    {0xF3E2F893DEC3F126, -529, -140},
+    {0xB5B5ADA8AAFF80B8, -502, -132},
+    {0x87625F056C7C4A8B, -475, -124},
+    {0xC9BCFF6034C13053, -449, -116},
+    {0x964E858C91BA2655, -422, -108},
+    {0xDFF9772470297EBD, -396, -100},
+    {0xA6DFBD9FB8E5B88F, -369, -92},
+    {0xF8A95FCF88747D94, -343, -84},
+    {0xB94470938FA89BCF, -316, -76},
+    {0x8A08F0F8BF0F156B, -289, -68},
+    {0xCDB02555653131B6, -263, -60},
+    {0x993FE2C6D07B7FAC, -236, -52},
+    {0xE45C10C42A2B3B06, -210, -44},
+    {0xAA242499697392D3, -183, -36},
+    {0xFD87B5F28300CA0E, -157, -28},
+    {0xBCE5086492111AEB, -130, -20},
+    {0x8CBCCC096F5088CC, -103, -12},
+    {0xD1B71758E219652C, -77, -4},
+    {0x9C40000000000000, -50, 4},
+    {0xE8D4A51000000000, -24, 12},
+    {0xAD78EBC5AC620000, 3, 20},
+    {0x813F3978F8940984, 30, 28},
+    {0xC097CE7BC90715B3, 56, 36},
+    {0x8F7E32CE7BEA5C70, 83, 44},
+    {0xD5D238A4ABE98068, 109, 52},
+    {0x9F4F2726179A2245, 136, 60},
+    {0xED63A231D4C4FB27, 162, 68},
+    {0xB0DE65388CC8ADA8, 189, 76},
+    {0x83C7088E1AAB65DB, 216, 84},
+    {0xC45D1DF942711D9A, 242, 92},
+    {0x924D692CA61BE758, 269, 100},
+    {0xDA01EE641A708DEA, 295, 108},
+    {0xA26DA3999AEF774A, 322, 116},
+    {0xF209787BB47D6B85, 348, 124},
+    {0xB454E4A179DD1877, 375, 132},
+    {0x865B86925B9BC5C2, 402, 140},
+    {0xC83553C5C8965D3D, 428, 148},
+    {0x952AB45CFA97A0B3, 455, 156},
+    {0xDE469FBD99A05FE3, 481, 164},
+    {0xA59BC234DB398C25, 508, 172},
+    {0xF6C69A72A3989F5C, 534, 180},
+    {0xB7DCBF5354E9BECE, 561, 188},
+    {0x88FCF317F22241E2, 588, 196},
+    {0xCC20CE9BD35C78A5, 614, 204},
+    {0x98165AF37B2153DF, 641, 212},
+    {0xE2A0B5DC971F303A, 667, 220},
+    {0xA8D9D1535CE3B396, 694, 228},
+    {0xFB9B7CD9A4A7443C, 720, 236},
+    {0xBB764C4CA7A44410, 747, 244},
+    {0x8BAB8EEFB6409C1A, 774, 252},
+    {0xD01FEF10A657842C, 800, 260},
+    {0x9B10A4E5E9913129, 827, 268},
+    {0xE7109BFBA19C0C9D, 853, 276},
+    {0xAC2820D9623BF429, 880, 284},
+    {0x80444B5E7AA7CF85, 907, 292},
+    {0xBF21E44003ACDD2D, 933, 300},
+    {0x8E679C2F5E44FF8F, 960, 308},
+    {0xD433179D9C8CB841, 986, 316},
+    {0x9E19DB92B4E31BA9, 1013, 324},
+    {0xEB96BF6EBADF77D9, 1039, 332},
+    {0xAF87023B9BF0EE6B, 1066, 340},
+};
+constexpr static int k_numberOfCachedPowersOfTen =
+    sizeof(k_cachedPowersOfTen) / sizeof(CachedPowerOfTen);
+constexpr static int k_firstCachedDecimalExponent = -348;
+constexpr static int k_cachedDecimalExponentStep = 8;
+
+/* The float is scaled so that its integral part fits in 32 bits and that its
+ * fractional part can be multiplied by 10 without overflowing. */
+constexpr static int k_minimalScaledExponent = -60;
+constexpr static int k_maximalScaledExponent = -32;
+
+constexpr static double k_log10Of2 = 0.30102999566398114;
+
+static const uint32_t k_powersOfTen[] = {
+    1,      10,      100,      1000,      10000,
+    100000, 1000000, 10000000, 100000000, 1000000000};
+
+// Number of digits of i, and the power of ten of its first digit
+static int NumberOfDigits(uint32_t i, uint32_t* firstDigitPower) {
+  int numberOfDigits = 10;
+  while (numberOfDigits > 1 && i < k_powersOfTen[numberOfDigits - 1]) {
+    numberOfDigits--;
+  }
+  *firstDigitPower = k_powersOfTen[numberOfDigits - 1];
+  return numberOfDigits;
 }
 
-PrintFloat::Long::Long(uint32_t d1, uint32_t d2, bool negative) {
-  m_digits[1] = d2;
-  m_digits[0] = d1;
-  m_negative = negative && !isZero();
+static int NumberOfDigits(uint64_t i) {
+  int numberOfDigits = 1;
+  while (i >= 10) {
+    i /= 10;
+    numberOfDigits++;
+  }
+  return numberOfDigits;
 }
 
-void PrintFloat::Long::DivisionByTen(const Long& longToDivide, Long* quotient,
-                                     Long* digit) {
-  assert(quotient != nullptr && digit != nullptr);
-  if (longToDivide.isZero()) {
-    *quotient = Long(0);
-    *digit = Long(0);
-    return;
+static uint64_t PowerOfTen(int exponent) {
+  uint64_t result = 1;
+  for (int i = 0; i < exponent; i++) {
+    result *= 10;
   }
+  return result;
+}
+
+// Decompose f > 0 into mantissa * 2^exponent
+template <class T>
+static uint64_t Decompose(T f, int* exponent, bool* lowerBoundaryIsCloser) {
+  constexpr int k_mantissaNbBits = IEEE754<T>::k_mantissaNbBits;
+  constexpr int k_exponentBias =
+      IEEE754<T>::exponentOffset() + k_mantissaNbBits;
+  constexpr uint64_t k_hiddenBit = static_cast<uint64_t>(1)
+                                   << k_mantissaNbBits;
+  uint64_t bits;
+  if constexpr (sizeof(T) == sizeof(float)) {
+    uint32_t floatBits;
+    memcpy(&floatBits, &f, sizeof(floatBits));
+    bits = floatBits;
+  } else {
+    static_assert(sizeof(T) == sizeof(bits), "Unsupported float type");
+    memcpy(&bits, &f, sizeof(bits));
+  }
+  uint64_t fraction = bits & (k_hiddenBit - 1);
+  int biasedExponent = (bits >> k_mantissaNbBits) & IEEE754<T>::maxExponent();
+  if (biasedExponent == 0) {
+    // Denormal
+    *exponent = 1 - k_exponentBias;
+    *lowerBoundaryIsCloser = false;
+    return fraction;
+  }
+  *exponent = biasedExponent - k_exponentBias;
+  /* The float below a power of two is closer than the one above, unless it
+   * is denormal. */
+  *lowerBoundaryIsCloser = fraction == 0 && biasedExponent > 1;
+  return fraction | k_hiddenBit;
+}
+
+/* Find the cached power of ten c such that, for any normalized w of binary
+ * exponent e, w*c has an exponent in
+ * [k_minimalScaledExponent, k_maximalScaledExponent]. */
+static const CachedPowerOfTen& CachedPowerOfTenForExponent(int e) {
+  constexpr int k_significandSize = 64;
+  int minimalExponent = k_minimalScaledExponent - (e + k_significandSize);
+  int k = static_cast<int>(
+      std::ceil((minimalExponent + k_significandSize - 1) * k_log10Of2));
+  int index = (k - k_firstCachedDecimalExponent + k_cachedDecimalExponentStep -
+               1) /
+              k_cachedDecimalExponentStep;
+  assert(index >= 0 && index < k_numberOfCachedPowersOfTen);
+  return k_cachedPowersOfTen[index];
+}
+
+static int NumberOfBits(uint64_t i) {
+  int numberOfBits = 0;
+  while (i != 0) {
+    i >>= 1;
+    numberOfBits++;
+  }
+  return numberOfBits;
+}
 
-  uint32_t digit0 = longToDivide.digit(0);
-  uint32_t digit1 = longToDivide.digit(1);
+/* Estimate the decimal exponent of mantissa*2^exponent, which is either the
+ * estimate or the estimate + 1. */
+static int EstimateDecimalExponent(uint64_t mantissa, int exponent) {
+  return static_cast<int>(std::ceil(
+             (exponent + NumberOfBits(mantissa) - 1) * k_log10Of2 - 1e-10)) -
+         1;
+}
+
+static bool IncrementDigits(uint64_t* mantissa, int numberOfDigits) {
+  (*mantissa)++;
+  if (*mantissa == PowerOfTen(numberOfDigits)) {
+    *mantissa /= 10;
+    return true;
+  }
+  return false;
+}
 
-  uint32_t d = digit1 % 10;
-  uint32_t digit1DividedByTen = (digit1 - d) / 10;
-  *digit = Long(d);
+/* The digits are followed by rest, in units of tenKappa, with an error of at
+ * most unit. Round them if the error cannot change the rounding. */
+static bool RoundWeedCounted(uint64_t* mantissa, int numberOfDigits,
+                             uint64_t rest, uint64_t tenKappa, uint64_t unit,
+                             int* kappa) {
+  assert(rest < tenKappa);
+  if (unit >= tenKappa || tenKappa - unit <= unit) {
+    return false;
+  }
+  // rest + unit < tenKappa / 2: round down
+  if (tenKappa - rest > rest && tenKappa - 2 * rest > 2 * unit) {
+    return true;
+  }
+  // rest - unit >= tenKappa / 2: round up
+  if (rest > unit && tenKappa - (rest - unit) <= rest - unit) {
+    if (IncrementDigits(mantissa, numberOfDigits)) {
+      (*kappa)++;
+    }
+    return true;
+  }
+  return false;
+}
 
-  if (digit0 == 0) {
-    *quotient = Long(0, digit1DividedByTen, longToDivide.isNegative());
+bool PrintFloat::FastSignificantDigits(DiyFp w, int numberOfSignificantDigits,
+                                       SignificantDigits* digits) {
+  const CachedPowerOfTen& powerOfTen =
+      CachedPowerOfTenForExponent(w.exponent());
+  int decimalExponent = powerOfTen.decimalExponent;
+  DiyFp scaled = DiyFp::Multiply(
+      w, DiyFp(powerOfTen.significand, powerOfTen.binaryExponent));
+  assert(scaled.exponent() >= k_minimalScaledExponent &&
+         scaled.exponent() <= k_maximalScaledExponent);
+  // w is exact, the cached power and the product are off by half a unit each
+  uint64_t error = 1;
+  int shift = -scaled.exponent();
+  uint64_t one = static_cast<uint64_t>(1) << shift;
+  uint32_t integrals = static_cast<uint32_t>(scaled.significand() >> shift);
+  uint64_t fractionals = scaled.significand() & (one - 1);
+  uint32_t divisor;
+  int kappa = NumberOfDigits(integrals, &divisor);
+  uint64_t mantissa = 0;
+  int numberOfDigits = 0;
+  int requestedDigits = numberOfSignificantDigits;
+  bool rounded;
+  while (kappa > 0) {
+    mantissa = 10 * mantissa + integrals / divisor;
+    numberOfDigits++;
+    requestedDigits--;
+    integrals %= divisor;
+    kappa--;
+    if (requestedDigits == 0) {
+      break;
+    }
+    divisor /= 10;
+  }
+  if (requestedDigits == 0) {
+    uint64_t rest = (static_cast<uint64_t>(integrals) << shift) + fractionals;
+    rounded = RoundWeedCounted(&mantissa, numberOfDigits, rest,
+                               static_cast<uint64_t>(divisor) << shift, error,
+                               &kappa);
   } else {
-    *quotient =
-        Long(digit0 / 10, digit1DividedByTen + (k_base / 10) * (digit0 % 10),
-             longToDivide.isNegative());
+    while (requestedDigits > 0 && fractionals > error) {
+      fractionals *= 10;
+      error *= 10;
+      mantissa = 10 * mantissa + (fractionals >> shift);
+      numberOfDigits++;
+      requestedDigits--;
+      fractionals &= one - 1;
+      kappa--;
+    }
+    rounded = requestedDigits == 0 &&
+              RoundWeedCounted(&mantissa, numberOfDigits, fractionals, one,
+                               error, &kappa);
   }
+  if (!rounded) {
+    return false;
+  }
+  *digits = {mantissa, numberOfDigits,
+             kappa + numberOfDigits - 1 - decimalExponent};
+  return true;
 }
 
-void PrintFloat::Long::MultiplySmallLongByTen(Long& smallLong) {
-  assert(smallLong.digit(0) == 0 && smallLong.digit(1) < (k_base / 1000) &&
-         !smallLong.isZero());
-  uint32_t newDigit1 = smallLong.digit(1) * 10;
-  smallLong = Long(0, newDigit1, smallLong.isNegative());
+/* The digits are followed by rest, in units of tenKappa. Decrement them while
+ * they get closer to w and stay in the unsafe interval, and check that the
+ * result is certainly in the rounding interval of w. */
+static bool RoundWeed(uint64_t* mantissa, uint64_t distanceTooHighW,
+                      uint64_t unsafeInterval, uint64_t rest,
+                      uint64_t tenKappa, uint64_t unit) {
+  uint64_t smallDistance = distanceTooHighW - unit;
+  uint64_t bigDistance = distanceTooHighW + unit;
+  while (rest < smallDistance && unsafeInterval - rest >= tenKappa &&
+         (rest + tenKappa < smallDistance ||
+          smallDistance - rest >= rest + tenKappa - smallDistance)) {
+    (*mantissa)--;
+    rest += tenKappa;
+  }
+  if (rest < bigDistance && unsafeInterval - rest >= tenKappa &&
+      (rest + tenKappa < bigDistance ||
+       bigDistance - rest > rest + tenKappa - bigDistance)) {
+    return false;
+  }
+  return 2 * unit <= rest && rest <= unsafeInterval - 4 * unit;
 }
 
-int PrintFloat::Long::serialize(char* buffer, int bufferSize) const {
-  if (bufferSize == 0) {
-    return bufferSize - 1;
+bool PrintFloat::FastShortestSignificantDigits(DiyFp w, DiyFp lowerBoundary,
+                                               DiyFp upperBoundary,
+                                               SignificantDigits* digits) {
+  assert(lowerBoundary.exponent() == w.exponent() &&
+         upperBoundary.exponent() == w.exponent());
+  const CachedPowerOfTen& cachedPower =
+      CachedPowerOfTenForExponent(w.exponent());
+  int decimalExponent = cachedPower.decimalExponent;
+  DiyFp powerOfTen(cachedPower.significand, cachedPower.binaryExponent);
+  DiyFp scaledW = DiyFp::Multiply(w, powerOfTen);
+  DiyFp scaledLow = DiyFp::Multiply(lowerBoundary, powerOfTen);
+  DiyFp scaledHigh = DiyFp::Multiply(upperBoundary, powerOfTen);
+  /* The scaled boundaries are off by at most one unit: widen them to get an
+   * interval which certainly contains the rounding interval. */
+  uint64_t unit = 1;
+  uint64_t tooLow = scaledLow.significand() - unit;
+  uint64_t tooHigh = scaledHigh.significand() + unit;
+  uint64_t unsafeInterval = tooHigh - tooLow;
+  int shift = -scaledW.exponent();
+  uint64_t one = static_cast<uint64_t>(1) << shift;
+  uint32_t integrals = static_cast<uint32_t>(tooHigh >> shift);
+  uint64_t fractionals = tooHigh & (one - 1);
+  uint32_t divisor;
+  int kappa = NumberOfDigits(integrals, &divisor);
+  uint64_t mantissa = 0;
+  int numberOfDigits = 0;
+  bool rounded;
+  while (true) {
+    if (kappa > 0) {
+      mantissa = 10 * mantissa + integrals / divisor;
+      integrals %= divisor;
+    } else {
+      fractionals *= 10;
+      unit *= 10;
+      unsafeInterval *= 10;
+      mantissa = 10 * mantissa + (fractionals >> shift);
+      fractionals &= one - 1;
+    }
+    numberOfDigits++;
+    kappa--;
+    if (kappa >= 0) {
+      // Still in the integral part
+      uint64_t rest = (static_cast<uint64_t>(integrals) << shift) + fractionals;
+      if (rest < unsafeInterval) {
+        rounded = RoundWeed(&mantissa, tooHigh - scaledW.significand(),
+                            unsafeInterval, rest,
+                            static_cast<uint64_t>(divisor) << shift, unit);
+        break;
+      }
+      divisor /= 10;
+    } else if (fractionals < unsafeInterval) {
+      rounded = RoundWeed(&mantissa,
+                          (tooHigh - scaledW.significand()) * unit,
+                          unsafeInterval, fractionals, one, unit);
+      break;
+    }
   }
-  if (bufferSize == 1) {
-    buffer[0] = 0;
-    return bufferSize - 1;
-  }
-  int numberOfChars = m_negative ? 1 : 0;  // 1 for the minus sign char
-  if (m_digits[0] != 0) {
-    numberOfChars += PrintInt::Left(m_digits[0], buffer + numberOfChars,
-                                    bufferSize - numberOfChars - 1);
-    int wantedNumberOfChars = numberOfChars + k_maxNumberOfCharsForDigit + 1;
-    if (wantedNumberOfChars > bufferSize) {
-      /* There is not enough space for serializing the second digit and the null
-       * terminating char. */
-      return wantedNumberOfChars;
+  if (!rounded) {
+    return false;
+  }
+  *digits = {mantissa, numberOfDigits,
+             kappa + numberOfDigits - 1 - decimalExponent};
+  return true;
+}
+
+PrintFloat::SignificantDigits PrintFloat::ExactSignificantDigits(
+    uint64_t mantissa, int exponent, int numberOfSignificantDigits) {
+  assert(mantissa != 0);
+  int decimalExponent = EstimateDecimalExponent(mantissa, exponent);
+  // mantissa*2^exponent = r/s*10^decimalExponent
+  BigNumber r(mantissa);
+  BigNumber s(1);
+  if (exponent >= 0) {
+    r.shiftLeft(exponent);
+  } else {
+    s.shiftLeft(-exponent);
+  }
+  if (decimalExponent >= 0) {
+    s.multiplyByPowerOfTen(decimalExponent);
+  } else {
+    r.multiplyByPowerOfTen(-decimalExponent);
+  }
+  // r/s is in [1, 100), fix the estimate if it is above 10
+  BigNumber tenS = s;
+  tenS.multiplyBy(10);
+  if (BigNumber::Compare(r, tenS) >= 0) {
+    s = tenS;
+    decimalExponent++;
+  }
+  uint64_t digits = 0;
+  for (int i = 0; i < numberOfSignificantDigits; i++) {
+    if (i > 0) {
+      r.multiplyBy(10);
     }
-    numberOfChars += PrintInt::Right(
-        m_digits[1], buffer + numberOfChars,
-        std::min(k_maxNumberOfCharsForDigit, bufferSize - numberOfChars - 1));
+    digits = 10 * digits + r.divideModulo(s);
+  }
+  // Round half away from zero
+  r.shiftLeft(1);
+  if (BigNumber::Compare(r, s) >= 0 &&
+      IncrementDigits(&digits, numberOfSignificantDigits)) {
+    decimalExponent++;
+  }
+  return {digits, numberOfSignificantDigits, decimalExponent};
+}
+
+PrintFloat::SignificantDigits PrintFloat::ExactShortestSignificantDigits(
+    uint64_t mantissa, int exponent, bool lowerBoundaryIsCloser) {
+  assert(mantissa != 0);
+  int decimalExponent = EstimateDecimalExponent(mantissa, exponent);
+  /* mantissa*2^exponent = r/s*10^decimalExponent, and the floats around are
+   * (r + mPlus)/s and (r - mMinus)/s. The rounding interval is between the
+   * middles of these floats, which are excluded. */
+  BigNumber r(mantissa);
+  BigNumber s(1);
+  BigNumber mPlus(1);
+  BigNumber mMinus(1);
+  if (lowerBoundaryIsCloser) {
+    r.shiftLeft(2);
+    s.shiftLeft(2);
+    mPlus.shiftLeft(1);
+  } else {
+    r.shiftLeft(1);
+    s.shiftLeft(1);
+  }
+  if (exponent >= 0) {
+    r.shiftLeft(exponent);
+    mPlus.shiftLeft(exponent);
+    mMinus.shiftLeft(exponent);
+  } else {
+    s.shiftLeft(-exponent);
+  }
+  if (decimalExponent >= 0) {
+    s.multiplyByPowerOfTen(decimalExponent);
   } else {
-    numberOfChars += PrintInt::Left(m_digits[1], buffer + numberOfChars,
-                                    bufferSize - numberOfChars - 1);
+    r.multiplyByPowerOfTen(-decimalExponent);
+    mPlus.multiplyByPowerOfTen(-decimalExponent);
+    mMinus.multiplyByPowerOfTen(-decimalExponent);
   }
-  if (m_negative) {
-    assert(UTF8Decoder::CharSizeOfCodePoint('-') == 1);
-    if (bufferSize > 0) {
-      buffer[0] = '-';
+  BigNumber tenS = s;
+  tenS.multiplyBy(10);
+  if (BigNumber::PlusCompare(r, mPlus, tenS) > 0) {
+    s = tenS;
+    decimalExponent++;
+  }
+  uint64_t digits = 0;
+  int numberOfDigits = 0;
+  while (true) {
+    int digit = r.divideModulo(s);
+    numberOfDigits++;
+    // Can the digits be truncated or rounded up and stay in the interval?
+    bool roundDown = BigNumber::Compare(r, mMinus) < 0;
+    bool roundUp = BigNumber::PlusCompare(r, mPlus, s) > 0;
+    if (roundDown && roundUp) {
+      BigNumber twoR = r;
+      twoR.shiftLeft(1);
+      roundDown = BigNumber::Compare(twoR, s) < 0;
+    }
+    if (roundDown || roundUp) {
+      digits = 10 * digits + digit + !roundDown;
+      if (digits == PowerOfTen(numberOfDigits)) {
+        digits /= 10;
+        decimalExponent++;
+      }
+      break;
     }
+    digits = 10 * digits + digit;
+    r.multiplyBy(10);
+    mPlus.multiplyBy(10);
+    mMinus.multiplyBy(10);
+  }
+  return {digits, numberOfDigits, decimalExponent};
+}
+
+template <class T>
+PrintFloat::SignificantDigits PrintFloat::ComputeSignificantDigits(
+    T f, int numberOfSignificantDigits) {
+  // The digits are stored in a uint64_t
+  assert(numberOfSignificantDigits > 0 && numberOfSignificantDigits < 19);
+  if (f == static_cast<T>(0.0)) {
+    return {0, numberOfSignificantDigits, 0};
+  }
+  int exponent;
+  bool lowerBoundaryIsCloser;
+  uint64_t mantissa = Decompose(f, &exponent, &lowerBoundaryIsCloser);
+  SignificantDigits digits;
+  if (FastSignificantDigits(DiyFp(mantissa, exponent).normalized(),
+                            numberOfSignificantDigits, &digits)) {
+    return digits;
+  }
+  return ExactSignificantDigits(mantissa, exponent, numberOfSignificantDigits);
+}
+
+template <class T>
+PrintFloat::SignificantDigits PrintFloat::ComputeShortestSignificantDigits(
+    T f) {
+  if (f == static_cast<T>(0.0)) {
+    return {0, 1, 0};
+  }
+  int exponent;
+  bool lowerBoundaryIsCloser;
+  uint64_t mantissa = Decompose(f, &exponent, &lowerBoundaryIsCloser);
+  DiyFp w = DiyFp(mantissa, exponent).normalized();
+  DiyFp upperBoundary = DiyFp((mantissa << 1) + 1, exponent - 1).normalized();
+  DiyFp lowerBoundary = lowerBoundaryIsCloser
+                            ? DiyFp((mantissa << 2) - 1, exponent - 2)
+                            : DiyFp((mantissa << 1) - 1, exponent - 1);
+  lowerBoundary = DiyFp(lowerBoundary.significand()
+                            << (lowerBoundary.exponent() -
+                                upperBoundary.exponent()),
+                        upperBoundary.exponent());
+  SignificantDigits digits;
+  if (!FastShortestSignificantDigits(w, lowerBoundary, upperBoundary,
+                                     &digits)) {
+    digits =
+        ExactShortestSignificantDigits(mantissa, exponent,
+                                       lowerBoundaryIsCloser);
   }
-  if (numberOfChars <= bufferSize - 1) {
-    buffer[numberOfChars] = 0;
+  while (digits.numberOfDigits > 1 && digits.mantissa % 10 == 0) {
+    digits.mantissa /= 10;
+    digits.numberOfDigits--;
   }
-  return numberOfChars;
+  return digits;
 }
 
-void PrintFloat::PrintLongWithDecimalMarker(char* buffer, int bufferLength,
-                                            Long& i,
-                                            int decimalMarkerPosition) {
+// Text
+
+void PrintFloat::PrintIntegerWithDecimalMarker(char* buffer, int bufferLength,
+                                               uint64_t i, bool negative,
+                                               int decimalMarkerPosition) {
   /* The decimal marker position is always preceded by a char, thus, it is never
    * in first position. When called by ConvertFloatToText, the buffer length is
    * always > 0 as we asserted a minimal number of available chars. */
   assert(bufferLength > 0 && decimalMarkerPosition != 0);
-  constexpr int tempBufferSize = PrintFloat::k_maxFloatCharSize;
-  char tempBuffer[tempBufferSize];
-  int intLength = i.serialize(tempBuffer, tempBufferSize);
-  int firstDigitChar = UTF8Helper::CodePointIs(tempBuffer, '-') ? 1 : 0;
+  int firstDigitChar = negative ? 1 : 0;
   /* We should use the UTF8Decoder to write code points in buffers, but it is
    * much clearer to manipulate chars directly as we know that the code point we
    * use ('.', '0, '1', '2', ...) are only one char long. */
+  assert(UTF8Decoder::CharSizeOfCodePoint('.') == 1 &&
+         UTF8Decoder::CharSizeOfCodePoint('0') == 1 &&
+         UTF8Decoder::CharSizeOfCodePoint('-') == 1);
   for (int k = bufferLength - 1; k >= firstDigitChar; k--) {
     if (k == decimalMarkerPosition) {
-      assert(UTF8Decoder::CharSizeOfCodePoint('.') == 1);
       buffer[k] = '.';
       continue;
     }
-    if (intLength > firstDigitChar) {
-      assert(UTF8Decoder::CharSizeOfCodePoint(tempBuffer[intLength - 1]) == 1);
-      buffer[k] = tempBuffer[--intLength];
-      continue;
-    }
-    assert(UTF8Decoder::CharSizeOfCodePoint('0') == 1);
-    buffer[k] = '0';
+    buffer[k] = '0' + i % 10;
+    i /= 10;
   }
-  if (firstDigitChar == 1) {
-    assert(UTF8Decoder::CharSizeOfCodePoint(tempBuffer[0]) == 1);
-    buffer[0] = tempBuffer[0];
+  if (negative) {
+    buffer[0] = '-';
   }
 }
 
 template <class T>
-PrintFloat::TextLengths PrintFloat::ConvertFloatToText(
-    T f, char* buffer, int bufferSize, int glyphLength,
-    int numberOfSignificantDigits, Preferences::PrintFloatMode mode) {
-  assert(numberOfSignificantDigits > 0);
-  assert(bufferSize > 0);
-
-  /* Assert that the glyphLength is capped.
-   * Example: 1+1.234E-30+... in decimal mode, because we do not want the fill
-   * the buffer with the decimal version of 1.234E-30. */
-  assert(glyphLength <= k_maxFloatGlyphLength);
+bool PrintFloat::ConvertSpecialFloatToText(T f, char* buffer, int bufferSize,
+                                           int glyphLength,
+                                           TextLengths* lengths) {
+  const char* name;
+  if (std::isinf(f)) {
+    name = Infinity::Name(f < 0);
+  } else if (std::isnan(f)) {
+    name = Undefined::Name();
+  } else {
+    return false;
+  }
+  int requiredCharLength = strlen(name);
+  *lengths = {.CharLength = requiredCharLength,
+              .GlyphLength = requiredCharLength};
+  if (requiredCharLength > std::min(bufferSize - 1, glyphLength)) {
+    // We will not be able to print
+    buffer[0] = 0;
+  } else {
+    strlcpy(buffer, name, bufferSize);
+  }
+  return true;
+}
 
-  bool forceScientific = mode == Preferences::PrintFloatMode::Decimal &&
-                         std::fabs(f) < DecimalModeMinimalValue<T>();
+PrintFloat::TextLengths PrintFloat::ConvertSignificantDigitsToText(
+    SignificantDigits digits, bool negative, bool tooSmallForDecimal,
+    char* buffer, int bufferSize, int glyphLength,
+    Preferences::PrintFloatMode mode) {
+  bool forceScientific =
+      mode == Preferences::PrintFloatMode::Decimal && tooSmallForDecimal;
   TextLengths requiredLengths;
   if (!forceScientific) {
-    requiredLengths = ConvertFloatToTextPrivate(
-        f, buffer, bufferSize, glyphLength, numberOfSignificantDigits, mode);
+    requiredLengths = ConvertSignificantDigitsToTextInMode(
+        digits, negative, buffer, bufferSize, glyphLength, mode);
     forceScientific = (mode == Preferences::PrintFloatMode::Decimal &&
                        (requiredLengths.CharLength > bufferSize - 1 ||
                         requiredLengths.GlyphLength > glyphLength));
@@ -163,8 +827,8 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToText(
     /* If the required buffer size overflows the buffer size, we force the
      * display mode to scientific. We also force it if the number is too small,
      * to avoid displaying things like 0.0000001. */
-    requiredLengths = ConvertFloatToTextPrivate(
-        f, buffer, bufferSize, glyphLength, numberOfSignificantDigits,
+    requiredLengths = ConvertSignificantDigitsToTextInMode(
+        digits, negative, buffer, bufferSize, glyphLength,
         Preferences::PrintFloatMode::Scientific);
   }
 
@@ -177,6 +841,55 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToText(
   return requiredLengths;
 }
 
+template <class T>
+PrintFloat::TextLengths PrintFloat::ConvertFloatToText(
+    T f, char* buffer, int bufferSize, int glyphLength,
+    int numberOfSignificantDigits, Preferences::PrintFloatMode mode) {
+  assert(numberOfSignificantDigits > 0);
+  assert(bufferSize > 0);
+
+  /* Assert that the glyphLength is capped.
+   * Example: 1+1.234E-30+... in decimal mode, because we do not want the fill
+   * the buffer with the decimal version of 1.234E-30. */
+  assert(glyphLength <= k_maxFloatGlyphLength);
+
+  TextLengths requiredLengths;
+  if (ConvertSpecialFloatToText(f, buffer, bufferSize, glyphLength,
+                                &requiredLengths)) {
+    return requiredLengths;
+  }
+  return ConvertSignificantDigitsToText(
+      ComputeSignificantDigits(f, numberOfSignificantDigits), f < 0,
+      std::fabs(f) < DecimalModeMinimalValue<T>(), buffer, bufferSize,
+      glyphLength, mode);
+}
+
+template <class T>
+PrintFloat::TextLengths PrintFloat::ConvertFloatToTextShortest(
+    T f, char* buffer, int bufferSize, int glyphLength,
+    Preferences::PrintFloatMode mode) {
+  assert(bufferSize > 0);
+  assert(glyphLength <= glyphLengthForFloatWithPrecision(
+                            RoundTripSignificantDigits<T>()));
+
+  TextLengths requiredLengths;
+  if (ConvertSpecialFloatToText(f, buffer, bufferSize, glyphLength,
+                                &requiredLengths)) {
+    return requiredLengths;
+  }
+  SignificantDigits digits = ComputeShortestSignificantDigits(f);
+  if (mode == Preferences::PrintFloatMode::Decimal &&
+      digits.exponent >= digits.numberOfDigits && digits.exponent < 18) {
+    /* The zeroes of the integral part are not invented digits here: 1ᴇ10 is
+     * exactly 10000000000. */
+    digits.mantissa *= PowerOfTen(digits.exponent + 1 - digits.numberOfDigits);
+    digits.numberOfDigits = digits.exponent + 1;
+  }
+  return ConvertSignificantDigitsToText(
+      digits, f < 0, std::fabs(f) < DecimalModeMinimalValue<T>(), buffer,
+      bufferSize, glyphLength, mode);
+}
+
 int PrintFloat::EngineeringExponentFromBase10Exponent(int exponent) {
   int exponentMod3 = exponent % 3;
   int exponentInEngineeringNotation =
@@ -187,118 +900,38 @@ int PrintFloat::EngineeringExponentFromBase10Exponent(int exponent) {
   return exponentInEngineeringNotation;
 }
 
-template <class T>
-PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(
-    T f, char* buffer, int bufferSize, int glyphLength,
-    int numberOfSignificantDigits, Preferences::PrintFloatMode mode) {
-  assert(numberOfSignificantDigits > 0);
+PrintFloat::TextLengths PrintFloat::ConvertSignificantDigitsToTextInMode(
+    SignificantDigits digits, bool negative, char* buffer, int bufferSize,
+    int glyphLength, Preferences::PrintFloatMode mode) {
   assert(bufferSize > 0);
-  assert(glyphLength > 0 && glyphLength <= k_maxFloatGlyphLength);
+  assert(glyphLength > 0 &&
+         glyphLength <= glyphLengthForFloatWithPrecision(
+                            RoundTripSignificantDigits<double>()));
   int availableCharLength = std::min(bufferSize - 1, glyphLength);
   TextLengths exceptionResult = {.CharLength = bufferSize,
                                  .GlyphLength = glyphLength + 1};
-  // TODO: accelerate for f between 0 and 10 ?
-  if (std::isinf(f)) {
-    // Infinity
-    int requiredCharLength = Infinity::NameSize(f < 0) - 1;
-    TextLengths requiredTextLengths = {.CharLength = requiredCharLength,
-                                       .GlyphLength = requiredCharLength};
-    if (requiredCharLength > availableCharLength) {
-      // We will not be able to print
-      return requiredTextLengths;
-    }
-    // Write inf or -inf
-    strlcpy(buffer, Infinity::Name(f < 0), bufferSize);
-    return requiredTextLengths;
-  }
-
-  if (std::isnan(f)) {
-    // Nan
-    constexpr int requiredCharLength = Undefined::NameSize() - 1;
-    constexpr TextLengths requiredTextLengths = {
-        .CharLength = requiredCharLength, .GlyphLength = requiredCharLength};
-    if (requiredCharLength > availableCharLength) {
-      // We will not be able to print
-      return requiredTextLengths;
-    }
-    strlcpy(buffer, Undefined::Name(), bufferSize);
-    return requiredTextLengths;
-  }
-
-  int exponentInBase10 = IEEE754<T>::exponentBase10(f);
+  int exponentInBase10 = digits.exponent;
+  uint64_t mantissa = digits.mantissa;
 
   /* Part I: Mantissa */
 
-  /* Compute mantissa
-   * We compute the unroundedMantissa using doubles to limit approximation
-   * errors. Previously when computing with floats : 0.000600000028 * 10^10 =
-   * 6000000.28 was rounded into 6000000.5 because of the conversion error
-   * Mantissa was the 6000001 instead of 6000000.
-   * As a result, 0.0006 was displayed as 0.0006000001
-   * With doubles, 0.000600000028 * 10^10 = 6000000.2849...
-   * This value is then rounded into mantissa = 6000000 which yields a proper
-   * display of 0.0006 */
-  double unroundedMantissa = static_cast<double>(f) *
-                             std::pow(10.0, (double)(numberOfSignificantDigits -
-                                                     1 - exponentInBase10));
-  // Round mantissa to get the right number of significant digits
-  double mantissa = std::round(unroundedMantissa);
-
-  /* Since no problem of approximation was detected from using potential float
-   * (instead of double) in the rest of the code, we decided to leave it like
-   * this */
-
-  /* If (numberOfSignificantDigits - 1 - exponentInBase10) is too big (or too
-   * small), mantissa is now inf. We handle this case by using logarithm
-   * function. */
-  if (std::isnan(mantissa) || std::isinf(mantissa)) {
-    mantissa =
-        std::round(std::pow(10, std::log10(std::fabs(f)) +
-                                    static_cast<T>(numberOfSignificantDigits -
-                                                   1 - exponentInBase10)));
-    mantissa = std::copysign(mantissa, static_cast<double>(f));
-  }
-  /* We update the exponent in base 10 (if 0.99999999 was rounded to 1 for
-   * instance)
-   * NB: the following if-condition should rather be:
-   * "exponentBase10(unroundedMantissa) != exponentBase10(mantissa)",
-   * However, unroundedMantissa can have a different exponent than expected
-   * (ex: f = 1E13, unroundedMantissa = 99999999.99 and mantissa = 1000000000)
-   */
-  if (f != 0 && IEEE754<double>::exponentBase10(mantissa) - exponentInBase10 !=
-                    numberOfSignificantDigits - 1 - exponentInBase10) {
-    exponentInBase10++;
-  }
-
   if (mode == Preferences::PrintFloatMode::Decimal &&
-      exponentInBase10 >= numberOfSignificantDigits) {
+      exponentInBase10 >= digits.numberOfDigits) {
     /* Exception 1: avoid inventing digits to fill the printed float: when
      * displaying 12345 with 2 significant digis in Decimal mode for instance.
-     * This exception is caught by ConvertFloatToText and forces the mode to
-     * Scientific */
+     * This exception is caught by ConvertSignificantDigitsToText and forces
+     * the mode to Scientific */
     return exceptionResult;
   }
 
-  // Correct the number of digits in mantissa after rounding
-  if (IEEE754<T>::exponentBase10(mantissa) >= numberOfSignificantDigits) {
-    mantissa = mantissa / static_cast<T>(10.0);
-  }
-
   // Number of chars for the mantissa
-  int numberOfCharsForMantissaWithoutSign = numberOfSignificantDigits;
+  int numberOfCharsForMantissaWithoutSign = digits.numberOfDigits;
   if (mode == Preferences::PrintFloatMode::Decimal && exponentInBase10 < 0) {
     // Add |exponentInBase10| to count 0 added before significant digits
     numberOfCharsForMantissaWithoutSign -= exponentInBase10;
   }
 
-  /* The number of digits in a mantissa is capped because the maximal int64_t is
-   * 2^63 - 1. As our mantissa is an integer built from an int64_t, we assert
-   * that we stay beyond this threshold during computation. */
-  assert(numberOfSignificantDigits < 63.0f * std::log10(2.0f));
-
   // Remove/Add the zeroes on the right side of the mantissa
-  Long dividend = Long((int64_t)mantissa);
-
   int exponentForEngineeringNotation = 0;
   int minimalNumberOfMantissaDigits = 1;
   bool removeZeroes = true;
@@ -312,32 +945,24 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(
         minimalNumberOfMantissaDigits, numberOfCharsForMantissaWithoutSign);
     if (numberOfZeroesToAdd > 0) {
       removeZeroes = false;
-      assert(numberOfCharsForMantissaWithoutSign - numberOfSignificantDigits <
-             3);
-      for (int i = 0; i < numberOfZeroesToAdd; i++) {
-        assert(mantissa < 1000);
-        Long::MultiplySmallLongByTen(dividend);
-      }
+      assert(numberOfZeroesToAdd < 3);
+      mantissa *= PowerOfTen(numberOfZeroesToAdd);
+      numberOfCharsForMantissaWithoutSign += numberOfZeroesToAdd;
     }
   }
   if (removeZeroes) {
-    Long digit;
-    Long quotient;
-    Long::DivisionByTen(dividend, &quotient, &digit);
     int minimumNumberOfCharsInMantissa =
         mode == Preferences::PrintFloatMode::Engineering
             ? minimalNumberOfMantissaDigits
             : 1;
-    while (digit.isZero() &&
+    while (mantissa % 10 == 0 &&
            numberOfCharsForMantissaWithoutSign >
                minimumNumberOfCharsInMantissa &&
            (numberOfCharsForMantissaWithoutSign > exponentInBase10 + 1 ||
             mode == Preferences::PrintFloatMode::Scientific ||
             mode == Preferences::PrintFloatMode::Engineering)) {
-      assert(UTF8Decoder::CharSizeOfCodePoint('0') == 1);
       numberOfCharsForMantissaWithoutSign--;
-      dividend = quotient;
-      Long::DivisionByTen(dividend, &quotient, &digit);
+      mantissa /= 10;
     }
     if (numberOfCharsForMantissaWithoutSign > availableCharLength) {
       // Escape now if the true number of needed digits is not required
@@ -374,15 +999,15 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(
     assert(mode == Preferences::PrintFloatMode::Engineering);
     decimalMarkerPosition = minimalNumberOfMantissaDigits;
   }
-  if (f < 0) {
+  if (negative) {
     decimalMarkerPosition++;
   }
-  assert(UTF8Decoder::CharSizeOfCodePoint('-') == 1);
 
   /* Part III: Sign */
 
+  assert(UTF8Decoder::CharSizeOfCodePoint('-') == 1);
   int numberOfCharsForMantissaWithSign =
-      numberOfCharsForMantissaWithoutSign + (f >= 0 ? 0 : 1);
+      numberOfCharsForMantissaWithoutSign + (negative ? 1 : 0);
   if (numberOfCharsForMantissaWithSign > availableCharLength) {
     // Exception 2: we will overflow the buffer
     return exceptionResult;
@@ -393,19 +1018,16 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(
   int exponent = mode == Preferences::PrintFloatMode::Engineering
                      ? exponentForEngineeringNotation
                      : exponentInBase10;
+  uint64_t absoluteExponent = exponent < 0 ? -exponent : exponent;
   int numberOfCharExponent =
-      exponent != 0 ? IEEE754<T>::exponentBase10(static_cast<T>(exponent)) + 1
-                    : 0;
+      exponent != 0 ? NumberOfDigits(absoluteExponent) : 0;
   if (exponent < 0) {
     // If the exponent is < 0, we need a additional char for the sign
     numberOfCharExponent++;
-    assert(UTF8Decoder::CharSizeOfCodePoint('-') == 1);
   }
 
   /* Part V: print mantissa*10^exponent */
 
-  assert(UTF8Decoder::CharSizeOfCodePoint('-') == 1);
-  // Print mantissa
   bool doNotWriteExponent =
       (mode == Preferences::PrintFloatMode::Decimal) || (exponent == 0);
   int neededNumberOfChars = numberOfCharsForMantissaWithSign;
@@ -421,8 +1043,9 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(
     // Exception 3: We are about to overflow the buffer.
     return exceptionResult;
   }
-  PrintLongWithDecimalMarker(buffer, numberOfCharsForMantissaWithSign, dividend,
-                             decimalMarkerPosition);
+  // Print mantissa
+  PrintIntegerWithDecimalMarker(buffer, numberOfCharsForMantissaWithSign,
+                                mantissa, negative, decimalMarkerPosition);
   if (doNotWriteExponent) {
     buffer[numberOfCharsForMantissaWithSign] = 0;
     return {.CharLength = numberOfCharsForMantissaWithSign,
@@ -434,9 +1057,9 @@ PrintFloat::TextLengths PrintFloat::ConvertFloatToTextPrivate(
   currentNumberOfChar += UTF8Decoder::CodePointToChars(
       UCodePointLatinLetterSmallCapitalE, buffer + currentNumberOfChar,
       bufferSize - currentNumberOfChar - 1);
-  dividend = Long(exponent);  // reuse dividend as it is not needed anymore
-  PrintLongWithDecimalMarker(buffer + currentNumberOfChar, numberOfCharExponent,
-                             dividend, -1);
+  PrintIntegerWithDecimalMarker(buffer + currentNumberOfChar,
+                                numberOfCharExponent, absoluteExponent,
+                                exponent < 0, -1);
   buffer[currentNumberOfChar + numberOfCharExponent] = 0;
   assert(neededNumberOfChars == currentNumberOfChar + numberOfCharExponent);
   return {.CharLength = currentNumberOfChar + numberOfCharExponent,
@@ -448,6 +1071,11 @@ template PrintFloat::TextLengths PrintFloat::ConvertFloatToText<float>(
     float, char*, int, int, int, Preferences::Preferences::PrintFloatMode);
 template PrintFloat::TextLengths PrintFloat::ConvertFloatToText<double>(
     double, char*, int, int, int, Preferences::Preferences::PrintFloatMode);
+template PrintFloat::TextLengths PrintFloat::ConvertFloatToTextShortest<float>(
+    float, char*, int, int, Preferences::Preferences::PrintFloatMode);
+template PrintFloat::TextLengths
+PrintFloat::ConvertFloatToTextShortest<double>(
+    double, char*, int, int, Preferences::Preferences::PrintFloatMode);
 template int PrintFloat::SignificantDecimalDigits<float>();
 template int PrintFloat::SignificantDecimalDigits<double>();
 
@@ -1,3 +1,4 @@
+#include <poincare/interval.h>
 #include <poincare/piecewise_operator.h>
 #include <poincare/rational.h>
 #include <poincare/solver.h>
@@ -142,8 +143,18 @@ Coordinate2D<T> Solver<T>::nextRoot(const Expression &e) {
         return Coordinate2D<T>();
       }
 
+      /* Stop the search where the enclosure of e proves there are no roots
+       * left before xEnd. */
+      T xEnd = m_xEnd;
+      m_xEnd = endOfRootSearch(e);
+      if (m_xEnd == m_xStart) {
+        m_xEnd = xEnd;
+        registerSolution(Coordinate2D<T>(), Interest::None);
+        return Coordinate2D<T>();
+      }
       Coordinate2D<T> res =
           next(e, EvenOrOddRootInBracket, CompositeBrentForRoot);
+      m_xEnd = xEnd;
       if (lastInterest() != Interest::None) {
         m_lastInterest = Interest::Root;
       }
@@ -526,6 +537,32 @@ T Solver<T>::nextX(T x, T direction, T slope) const {
   return x2;
 }
 
+template <typename T>
+T Solver<T>::endOfRootSearch(const Expression &e) const {
+  if (!std::isfinite(m_xStart) || !std::isfinite(m_xEnd)) {
+    return m_xEnd;
+  }
+  /* Look for the farthest piece of the interval that may contain a root, i.e.
+   * whose enclosure meets the tolerance around zero. Enclosures are much
+   * cheaper than the sampling of the pieces they rule out. */
+  constexpr int k_numberOfPieces = 16;
+  T pieceLength = (m_xEnd - m_xStart) / k_numberOfPieces;
+  for (int i = k_numberOfPieces; i > 0; i--) {
+    T pieceStart = m_xStart + (i - 1) * pieceLength;
+    T pieceEnd = i == k_numberOfPieces ? m_xEnd : m_xStart + i * pieceLength;
+    T tolerance = NullTolerance(
+        std::max(std::fabs(pieceStart), std::fabs(pieceEnd)));
+    Interval<T> enclosure = Interval<T>::ForExpression(
+        e, m_unknown, std::min(pieceStart, pieceEnd),
+        std::max(pieceStart, pieceEnd), m_context, m_complexFormat,
+        m_angleUnit);
+    if (enclosure.intersects(-tolerance, tolerance)) {
+      return pieceEnd;
+    }
+  }
+  return m_xStart;
+}
+
 template <typename T>
 Coordinate2D<T> Solver<T>::nextPossibleRootInChild(const Expression &e,
                                                    int childIndex) const {
@@ -618,7 +655,11 @@ Coordinate2D<T> Solver<T>::nextRootInAddition(const Expression &e) const {
   T xChildrenRoot =
       nextRootInChildren(e, test, const_cast<Solver<T> *>(this)).x();
   Solver<T> solver = *this;
-  T xRoot = solver.next(e, EvenOrOddRootInBracket, CompositeBrentForRoot).x();
+  solver.m_xEnd = endOfRootSearch(e);
+  T xRoot =
+      solver.m_xEnd == m_xStart
+          ? k_NAN
+          : solver.next(e, EvenOrOddRootInBracket, CompositeBrentForRoot).x();
   if (!std::isfinite(xRoot) ||
       std::fabs(xChildrenRoot - m_xStart) < std::fabs(xRoot - m_xStart)) {
     xRoot = xChildrenRoot;
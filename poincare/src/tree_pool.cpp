@@ -9,10 +9,10 @@
 namespace Poincare {
 
 #if ASSERTIONS
-bool TreePool::s_treePoolLocked = false;
+OMG_INSTANCE_LOCAL bool TreePool::s_treePoolLocked = false;
 #endif
 
-OMG::GlobalBox<TreePool> TreePool::sharedPool;
+OMG_INSTANCE_LOCAL OMG::GlobalBox<TreePool> TreePool::sharedPool;
 
 void TreePool::freeIdentifier(uint16_t identifier) {
   if (TreeNode::IsValidIdentifier(identifier) &&
@@ -68,6 +68,14 @@ TreeNode *TreePool::copyTreeFromAddress(const void *address, size_t size) {
 
 void TreePool::removeChildrenAndDestroy(TreeNode *nodeToDestroy,
                                         int nodeNumberOfChildren) {
+  /* Most of the time, the descendants are only retained by their parent and
+   * are destroyed along with the node: the whole tree is then discarded at
+   * once instead of moving each child at the end of the pool first. */
+  size_t treeSize = nodeToDestroy->deepSize(nodeNumberOfChildren);
+  if (descendantsAreOnlyRetainedByTheirParent(nodeToDestroy, treeSize)) {
+    discardTree(nodeToDestroy, treeSize);
+    return;
+  }
   removeChildren(nodeToDestroy, nodeNumberOfChildren);
   discardTreeNode(nodeToDestroy);
 }
@@ -169,6 +177,31 @@ void TreePool::discardTreeNode(TreeNode *node) {
   freeIdentifier(nodeIdentifier);
 }
 
+bool TreePool::descendantsAreOnlyRetainedByTheirParent(TreeNode *node,
+                                                       size_t treeSize) const {
+  const char *end = reinterpret_cast<char *>(node) + treeSize;
+  for (TreeNode *n = node->next(); reinterpret_cast<char *>(n) < end;
+       n = n->next()) {
+    if (n->retainCount() != 1) {
+      return false;
+    }
+  }
+  return true;
+}
+
+void TreePool::discardTree(TreeNode *node, size_t treeSize) {
+  const char *end = reinterpret_cast<char *>(node) + treeSize;
+  TreeNode *n = node;
+  while (reinterpret_cast<char *>(n) < end) {
+    TreeNode *next = n->next();
+    uint16_t nodeIdentifier = n->identifier();
+    n->~TreeNode();
+    freeIdentifier(nodeIdentifier);
+    n = next;
+  }
+  dealloc(node, treeSize);
+}
+
 void TreePool::registerNode(TreeNode *node) {
   uint16_t nodeID = node->identifier();
   assert(nodeID < MaxNumberOfNodes);
@@ -124,7 +124,12 @@ bool VerticalOffsetLayoutNode::setEmptyVisibility(EmptyRectangle::State state) {
     return false;
   }
   m_emptyBaseVisibility = state;
-  return baseLayout() == nullptr;  // Return true if empty is displayed
+  if (baseLayout() != nullptr) {
+    return false;
+  }
+  // The empty base is displayed and changes the size
+  invalidSizesAndBaselinesUpToRoot();
+  return true;
 }
 
 KDSize VerticalOffsetLayoutNode::computeSize(KDFont::Size font) {
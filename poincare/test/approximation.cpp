@@ -1,7 +1,10 @@
 #include <apps/shared/global_context.h>
 #include <poincare/constant.h>
 #include <poincare/infinity.h>
+#include <poincare/list_complex.h>
 #include <poincare/list_sort.h>
+#include <poincare/matrix_complex.h>
+#include <poincare/point_evaluation.h>
 #include <poincare/undefined.h>
 
 #include "helper.h"
@@ -1615,6 +1618,74 @@ QUIZ_CASE(poincare_approximation_list) {
   assert_expression_approximates_to<double>("{1,2,3,4,5,6}", "{1,2,3,4,5,6}");
 }
 
+template <typename T>
+void assert_evaluation_children_are_reached(Evaluation<T> e) {
+  // Compare constant time accesses with a walk through the siblings
+  int i = 0;
+  for (TreeNode *child : e.node()->directChildren()) {
+    quiz_assert(e.childAtIndex(i).node() == child);
+    if (static_cast<EvaluationNode<T> *>(child)->type() ==
+        EvaluationNode<T>::Type::Complex) {
+      quiz_assert(e.complexAtIndex(i) ==
+                  *static_cast<ComplexNode<T> *>(child));
+    }
+    i++;
+  }
+  quiz_assert(i == e.numberOfChildren());
+}
+
+template <typename T>
+void assert_complex_containers_are_reached() {
+  ListComplex<T> list = ListComplex<T>::Builder();
+  for (int i = 0; i < 10; i++) {
+    list.addChildAtIndexInPlace(Complex<T>::Builder(9 - i, i % 2), i, i);
+  }
+  assert_evaluation_children_are_reached(list);
+  list.addChildAtIndexInPlace(Complex<T>::Builder(-1), 0, 10);
+  list.removeChildInPlace(list.childAtIndex(3), 0);
+  assert_evaluation_children_are_reached(list);
+  list = ListComplex<T>::Builder();
+  for (int i = 0; i < 5; i++) {
+    list.addChildAtIndexInPlace(Complex<T>::Builder(5 - i), i, i);
+  }
+  list.sort();
+  for (int i = 0; i < 5; i++) {
+    quiz_assert(list.valueAtIndex(i) == i + 1);
+  }
+  // Points have another size, children have to be walked through
+  list.addChildAtIndexInPlace(PointEvaluation<T>::Builder(1, 2), 2, 5);
+  assert_evaluation_children_are_reached(list);
+
+  MatrixComplex<T> matrix = MatrixComplex<T>::CreateIdentity(4);
+  assert_evaluation_children_are_reached(matrix);
+  quiz_assert(matrix.determinant() == std::complex<T>(1));
+  quiz_assert(matrix.transpose().complexAtIndex(5) == std::complex<T>(1));
+}
+
+QUIZ_CASE(poincare_approximation_complex_containers) {
+  assert_complex_containers_are_reached<float>();
+  assert_complex_containers_are_reached<double>();
+}
+
+template <typename T>
+void assert_list_arithmetic_is_approximated() {
+  // Real elements are computed on reals, the other ones on complexes
+  assert_expression_approximates_to<T>("{1,i,-1}×2+3", "{5,3+2×i,1}");
+  assert_expression_approximates_to<T>("{1,i}×{i,1}", "{i,i}");
+  assert_expression_approximates_to<T>("{1,2}/{0,4}", "{undef,0.5}");
+  assert_expression_approximates_to<T>("{2,-2}^{0.5,3}", "{1.414214,-8}",
+                                       Radian, MetricUnitFormat, Real, 7);
+  assert_expression_approximates_to<T>("{-4,4}^0.5", "nonreal", Radian,
+                                       MetricUnitFormat, Real);
+  assert_expression_approximates_to<T>("{0,1}^0", "{undef,1}");
+  assert_expression_approximates_to<T>("sort({3,-1,2}×2)", "{-2,4,6}");
+}
+
+QUIZ_CASE(poincare_approximation_list_arithmetic) {
+  assert_list_arithmetic_is_approximated<float>();
+  assert_list_arithmetic_is_approximated<double>();
+}
+
 QUIZ_CASE(poincare_approximation_list_sequence) {
   assert_expression_approximates_to<float>("sequence(k^2,k,4)", "{1,4,9,16}");
   assert_expression_approximates_to<double>("sequence(k/2,k,7)",
@@ -1010,6 +1010,11 @@ QUIZ_CASE(poincare_expression_continuous) {
   assert_is_continuous_between_values("x+ceil(x^2)", 2.45f, 2.47f, true);
   assert_is_continuous_between_values("x+round(x^2, 0)", 2.34f, 2.36f, false);
   assert_is_continuous_between_values("x+round(x^2, 0)", 2.36f, 2.38f, true);
+  assert_is_continuous_between_values("sign(x)", -1.f, -0.5f, true);
+  assert_is_continuous_between_values("sign(x)", -1.f, 0.f, false);
+  assert_is_continuous_between_values("sign(x)", 0.f, 1.f, false);
+  assert_is_continuous_between_values("abs(x)", -1.f, -0.5f, true);
+  assert_is_continuous_between_values("abs(x)", -1.f, 1.f, false);
   assert_is_continuous_between_values("x+random()", 2.43f, 2.45f, false);
   assert_is_continuous_between_values("x+randint(1,10)", 2.43f, 2.45f, false);
 }
@@ -124,6 +124,11 @@ QUIZ_CASE(poincare_solver_roots) {
   // R(100.01) });
   // TODO assert_roots_are("0", -1., 100., { ... });
 
+  // Enclosures rule out the pieces without roots
+  assert_roots_are("(x-50)^2-1", 0., 1000., {R(49.), R(51.)});
+  assert_roots_are("x^2+1", -1000., 1000., {});
+  assert_roots_are("sin(x)+2", -1000., 1000., {});
+
   assert_roots_are("1", -10., 10., {});
   assert_roots_are("3", -1., 100., {});
   assert_roots_are("1/x", -10., 10., {});
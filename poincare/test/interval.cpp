@@ -0,0 +1,105 @@
+#include <apps/shared/global_context.h>
+#include <poincare/interval.h>
+
+#include "helper.h"
+
+using namespace Poincare;
+
+template <typename T>
+void assert_enclosure_holds(const char* expression, T xMin, T xMax,
+                            bool isKnown = true,
+                            Preferences::AngleUnit angleUnit = Radian) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(expression, &context, false);
+  Interval<T> enclosure = Interval<T>::ForExpression(e, "x", xMin, xMax,
+                                                     &context, Real, angleUnit);
+  quiz_assert_print_if_failure(enclosure.isUnknown() != isKnown, expression);
+  if (!isKnown) {
+    return;
+  }
+  constexpr int k_numberOfSamples = 101;
+  for (int i = 0; i < k_numberOfSamples; i++) {
+    T x = xMin + (xMax - xMin) * i / (k_numberOfSamples - 1);
+    T y = e.approximateWithValueForSymbol<T>("x", x, &context, Real, angleUnit);
+    /* The approximation may not be correctly rounded, unlike the bounds of the
+     * enclosure. */
+    T tolerance = 4 * Float<T>::Epsilon() * std::fabs(y);
+    quiz_assert_print_if_failure(enclosure.lower() <= y + tolerance &&
+                                     y - tolerance <= enclosure.upper(),
+                                 expression);
+  }
+}
+
+template <typename T>
+void assert_enclosure_is_within(const char* expression, T xMin, T xMax,
+                                T lower, T upper,
+                                Preferences::AngleUnit angleUnit = Radian) {
+  Shared::GlobalContext context;
+  Expression e = parse_expression(expression, &context, false);
+  Interval<T> enclosure = Interval<T>::ForExpression(e, "x", xMin, xMax,
+                                                     &context, Real, angleUnit);
+  quiz_assert_print_if_failure(!enclosure.isUnknown() &&
+                                   lower <= enclosure.lower() &&
+                                   enclosure.upper() <= upper,
+                               expression);
+}
+
+QUIZ_CASE(poincare_interval_enclosure) {
+  assert_enclosure_holds<double>("x^2-2x+1", -3., 5.);
+  assert_enclosure_holds<double>("x^3/(x^2+1)", -10., 10.);
+  assert_enclosure_holds<double>("2^x+3^(-x)", -5., 5.);
+  assert_enclosure_holds<double>("e^(-x^2/2)", -3., 3.);
+  assert_enclosure_holds<double>("√(x+1)×ln(x+2)", -1., 9.);
+  assert_enclosure_holds<double>("log(x)+log(x,2)", 0.5, 8.);
+  assert_enclosure_holds<double>("sin(x)+cos(3x)", -4., 7.);
+  assert_enclosure_holds<double>("sin(x)", 30., 100., true, Degree);
+  assert_enclosure_holds<double>("cos(x)", -50., 150., true, Gradian);
+  assert_enclosure_holds<double>("arctan(x)", -100., 100., true, Degree);
+  assert_enclosure_holds<double>("abs(x-1)-floor(x)+ceil(x/2)", -4., 4.);
+  assert_enclosure_holds<double>("sign(x)", -4., 4.);
+  assert_enclosure_holds<double>("root(x,3)", 1., 27.);
+  assert_enclosure_holds<double>("x+tan(1)", -1., 1.);
+  assert_enclosure_holds<float>("x^4-x^2", -2.f, 2.f);
+  assert_enclosure_holds<float>("1/(1+e^(-x))", -20.f, 20.f);
+  assert_enclosure_holds<float>("sin(x)/x", 0.5f, 1000.f);
+
+  // The function is undefined somewhere, or not enclosed
+  assert_enclosure_holds<double>("1/x", -1., 1., false);
+  assert_enclosure_holds<double>("ln(x)", -1., 1., false);
+  assert_enclosure_holds<double>("√(x)", -1., 1., false);
+  assert_enclosure_holds<double>("x^(1/2)", -1., 1., false);
+  assert_enclosure_holds<double>("x^0", -1., 1., false);
+  assert_enclosure_holds<double>("tan(x)", -1., 1., false);
+  assert_enclosure_holds<double>("random()+x", -1., 1., false);
+
+  // Enclosures are tight enough on monotonous pieces
+  assert_enclosure_is_within<double>("x^2", -1., 2., 0., 4.0001);
+  assert_enclosure_is_within<double>("sin(x)", 0., 3.14, -1e-12, 1.);
+  assert_enclosure_is_within<double>("cos(x)", 0., 180., -1., 1., Degree);
+  assert_enclosure_is_within<double>("cos(x)", 1., 2., -0.4162, 0.5404);
+  assert_enclosure_is_within<double>("abs(x)", -3., 2., 0., 3.0001);
+  assert_enclosure_is_within<double>("e^x", 0., 1., 0.9999, 2.7183);
+  assert_enclosure_is_within<float>("floor(x)", 0.5f, 2.5f, 0.f, 2.f);
+}
+
+QUIZ_CASE(poincare_interval_rounding) {
+  // Correctly rounded operations are widened by one ulp
+  Interval<double> root =
+      Interval<double>::SquareRoot(Interval<double>(2., 2.));
+  quiz_assert(root.lower() == std::nextafter(std::sqrt(2.), 0.) &&
+              root.upper() == std::nextafter(std::sqrt(2.), 3.));
+  // libm functions are widened by several ulps
+  constexpr double epsilon = 8. * Float<double>::Epsilon();
+  Interval<double> exponential =
+      Interval<double>::Exponential(Interval<double>(1., 1.));
+  quiz_assert(exponential.lower() < M_E * (1. - epsilon) &&
+              M_E * (1. + epsilon) < exponential.upper());
+  constexpr float epsilonf = 8.f * Float<float>::Epsilon();
+  float cos1 = std::cos(1.f);
+  Interval<float> cosine = Interval<float>::Cosine(Interval<float>(1.f, 1.f));
+  quiz_assert(cosine.lower() < cos1 * (1.f - epsilonf) &&
+              cos1 * (1.f + epsilonf) < cosine.upper());
+  // Results close to 0 are widened too
+  Interval<double> sine = Interval<double>::Sine(Interval<double>(M_PI, M_PI));
+  quiz_assert(sine.lower() < 0. && 0. < sine.upper());
+}
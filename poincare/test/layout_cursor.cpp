@@ -387,3 +387,56 @@ QUIZ_CASE(poincare_layout_parentheses) {
     assert_cursor_is_at(c, l, 1);
   }
 }
+
+static void assert_sizes_are_up_to_date(Layout l, LayoutCursor *cursor) {
+  /* Sizes and positions invalidated after each edition match the ones
+   * computed from scratch. */
+  constexpr KDFont::Size font = KDFont::Size::Large;
+  KDSize size = l.layoutSize(font);
+  KDCoordinate baseline = l.baseline(font);
+  KDPoint cursorOrigin = cursor->cursorAbsoluteOrigin(font);
+  l.invalidAllSizesPositionsAndBaselines();
+  quiz_assert(l.layoutSize(font) == size);
+  quiz_assert(l.baseline(font) == baseline);
+  quiz_assert(cursor->cursorAbsoluteOrigin(font) == cursorOrigin);
+}
+
+QUIZ_CASE(poincare_layout_cursor_invalidation) {
+  // 2|∫(∫(x,x,0,1),x,0,1), with bounds shared by the nested integrals
+  Layout innerIntegral = IntegralLayout::Builder(
+      CodePointLayout::Builder('x'), CodePointLayout::Builder('x'),
+      CodePointLayout::Builder('0'), CodePointLayout::Builder('1'));
+  HorizontalLayout l = HorizontalLayout::Builder(
+      CodePointLayout::Builder('2'),
+      IntegralLayout::Builder(innerIntegral, CodePointLayout::Builder('x'),
+                              CodePointLayout::Builder('0'),
+                              CodePointLayout::Builder('1')));
+  LayoutCursor c(l.childAtIndex(0));
+  assert_sizes_are_up_to_date(l, &c);
+  // Exponent of the base of the outer integral
+  c.addEmptyPowerLayout(nullptr);
+  assert_sizes_are_up_to_date(l, &c);
+  c.insertText("3", nullptr);
+  assert_sizes_are_up_to_date(l, &c);
+  // Upper bound of the outer integral, shared with the inner one
+  bool dummy;
+  c.move(OMG::Direction::Right(), false, &dummy);
+  c.move(OMG::Direction::Right(), false, &dummy);
+  assert_sizes_are_up_to_date(l, &c);
+  c.addFractionLayoutAndCollapseSiblings(nullptr);
+  assert_sizes_are_up_to_date(l, &c);
+  c.insertText("4", nullptr);
+  assert_sizes_are_up_to_date(l, &c);
+  c.performBackspace();
+  assert_sizes_are_up_to_date(l, &c);
+  // Matrix in the integrand, with gray rows and columns around the cursor
+  c.move(OMG::Direction::Down(), false, &dummy);
+  c.addEmptyMatrixLayout(nullptr);
+  assert_sizes_are_up_to_date(l, &c);
+  c.insertText("56", nullptr);
+  assert_sizes_are_up_to_date(l, &c);
+  c.move(OMG::Direction::Right(), false, &dummy);
+  c.move(OMG::Direction::Right(), false, &dummy);
+  c.insertText("7", nullptr);
+  assert_sizes_are_up_to_date(l, &c);
+}
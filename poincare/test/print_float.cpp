@@ -1,3 +1,7 @@
+#include <float.h>
+#include <poincare/infinity.h>
+#include <poincare/integer.h>
+#include <poincare/undefined.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -248,3 +252,176 @@ QUIZ_CASE(assert_print_floats) {
   assert_float_prints_to(-0.01, "-10ᴇ-3", EngineeringMode, 7);
   assert_float_prints_to(-0.001, "-1ᴇ-3", EngineeringMode, 7);
 }
+
+QUIZ_CASE(poincare_print_float_rounding) {
+  // Digits are rounded from the exact value of the float
+  assert_float_prints_to(0.15, "0.1", DecimalMode, 1);
+  assert_float_prints_to(2.675, "2.67", DecimalMode, 3);
+  assert_float_prints_to(1.005f, "1", DecimalMode, 3);
+  assert_float_prints_to(5e-324, "4.94065645841ᴇ-324", ScientificMode, 12);
+  assert_float_prints_to(1.7976931348623157e308, "1.797693134862ᴇ308",
+                         ScientificMode, 13);
+  // Ties are rounded away from zero
+  assert_float_prints_to(2.5, "3", DecimalMode, 1);
+  assert_float_prints_to(-2.5, "-3", DecimalMode, 1);
+  assert_float_prints_to(0.125f, "0.13", DecimalMode, 2);
+  assert_float_prints_to(9.5f, "1ᴇ1", ScientificMode, 1);
+
+  // Engineering notation with less digits than the exponent requires
+  assert_float_prints_to(100.0, "100", EngineeringMode, 1);
+  assert_float_prints_to(120.0, "120", EngineeringMode, 2);
+  assert_float_prints_to(0.05, "50ᴇ-3", EngineeringMode, 1);
+  assert_float_prints_to(0.125, "130ᴇ-3", EngineeringMode, 2);
+  assert_float_prints_to(3e10, "30ᴇ9", EngineeringMode, 1);
+}
+
+template <typename T>
+void assert_float_prints_shortest_to(
+    T a, const char* result, Preferences::PrintFloatMode mode = DecimalMode) {
+  constexpr int bufferSize = PrintFloat::charSizeForFloatsWithPrecision(
+      PrintFloat::RoundTripSignificantDigits<T>());
+  char buffer[bufferSize];
+  PrintFloat::ConvertFloatToTextShortest<T>(
+      a, buffer, bufferSize,
+      PrintFloat::glyphLengthForFloatWithPrecision(
+          PrintFloat::RoundTripSignificantDigits<T>()),
+      mode);
+  quiz_assert_print_if_failure(strcmp(buffer, result) == 0, result);
+}
+
+QUIZ_CASE(poincare_print_float_shortest) {
+  assert_float_prints_shortest_to(0.0f, "0");
+  assert_float_prints_shortest_to(-0.0, "0");
+  assert_float_prints_shortest_to(0.1f, "0.1");
+  assert_float_prints_shortest_to(0.1, "0.1");
+  assert_float_prints_shortest_to(0.1 + 0.2, "0.30000000000000004");
+  assert_float_prints_shortest_to(1.0f / 3.0f, "0.33333334");
+  assert_float_prints_shortest_to(1.0 / 3.0, "0.3333333333333333");
+  assert_float_prints_shortest_to(-123.456, "-123.456");
+  assert_float_prints_shortest_to(16777216.0f, "16777216");
+  assert_float_prints_shortest_to(1e10f, "10000000000");
+  assert_float_prints_shortest_to(1e10f, "1ᴇ10", ScientificMode);
+  assert_float_prints_shortest_to(1e10f, "10ᴇ9", EngineeringMode);
+  assert_float_prints_shortest_to(1234.5f, "1.2345ᴇ3", EngineeringMode);
+  assert_float_prints_shortest_to(0.0001f, "1ᴇ-4");
+  assert_float_prints_shortest_to(FLT_MAX, "3.4028235ᴇ38");
+  assert_float_prints_shortest_to(FLT_MIN, "1.1754944ᴇ-38");
+  assert_float_prints_shortest_to(1.4e-45f, "1ᴇ-45");
+  assert_float_prints_shortest_to(DBL_MAX, "1.7976931348623157ᴇ308");
+  assert_float_prints_shortest_to(DBL_MIN, "2.2250738585072014ᴇ-308");
+  assert_float_prints_shortest_to(5e-324, "5ᴇ-324");
+  assert_float_prints_shortest_to(9007199254740993.0, "9007199254740992");
+  assert_float_prints_shortest_to(INFINITY, Infinity::Name());
+  assert_float_prints_shortest_to(-static_cast<float>(INFINITY),
+                                  Infinity::Name(true));
+  assert_float_prints_shortest_to(NAN, Undefined::Name());
+}
+
+static Integer integer_times_powers(Integer i, int powerOfTwo,
+                                    int powerOfTen) {
+  assert(powerOfTwo >= 0 && powerOfTen >= 0);
+  i = Integer::Multiplication(i,
+                              Integer::Power(Integer(2), Integer(powerOfTwo)));
+  return Integer::Multiplication(
+      i, Integer::Power(Integer(10), Integer(powerOfTen)));
+}
+
+// f * 2^149, which is an integer for any float
+static Integer float_as_integer(float f) {
+  assert(f >= 0.0f && std::isfinite(f));
+  int exponent;
+  float fraction = std::frexp(f, &exponent);
+  uint32_t mantissa = static_cast<uint32_t>(std::ldexp(fraction, 24));
+  int shift = exponent - 24 + 149;
+  if (shift < 0) {
+    return Integer(static_cast<native_int_t>(mantissa >> -shift));
+  }
+  return integer_times_powers(
+      Integer(static_cast<double_native_int_t>(mantissa)), shift, 0);
+}
+
+/* Check that the text is read back as the float: the decimal it represents
+ * must lie strictly between the middles of f and its neighbours. */
+static void assert_text_is_read_back_as(const char* text, float f) {
+  assert(f > 0.0f);
+  char digits[PrintFloat::k_maxFloatCharSize];
+  int numberOfDigits = 0;
+  int exponent = 0;
+  bool fractionalPart = false;
+  const char* c = text;
+  for (; *c != 0 && *c != '\xE1'; c++) {
+    if (*c == '.') {
+      fractionalPart = true;
+    } else {
+      quiz_assert_print_if_failure(*c >= '0' && *c <= '9', text);
+      digits[numberOfDigits++] = *c;
+      exponent -= fractionalPart;
+    }
+  }
+  if (*c != 0) {
+    // Skip ᴇ
+    c += PrintFloat::k_specialECodePointByteLength;
+    exponent += atoi(c);
+  }
+  Integer decimal = integer_times_powers(
+      Integer(digits, numberOfDigits, false),
+      149 + 1, exponent > 0 ? exponent : 0);
+  Integer twiceF = integer_times_powers(float_as_integer(f), 1, 0);
+  Integer previous = float_as_integer(std::nextafter(f, 0.0f));
+  float nextFloat = std::nextafter(f, INFINITY);
+  Integer next = std::isfinite(nextFloat)
+                     ? float_as_integer(nextFloat)
+                     : Integer::Subtraction(twiceF, previous);
+  int scale = exponent < 0 ? -exponent : 0;
+  Integer lowerBound = integer_times_powers(
+      Integer::Addition(float_as_integer(f), previous), 0, scale);
+  Integer upperBound = integer_times_powers(
+      Integer::Addition(float_as_integer(f), next), 0, scale);
+  quiz_assert_print_if_failure(
+      Integer::NaturalOrder(lowerBound, decimal) < 0 &&
+          Integer::NaturalOrder(decimal, upperBound) < 0,
+      text);
+}
+
+static void assert_float_round_trips(float f) {
+  constexpr int bufferSize = PrintFloat::charSizeForFloatsWithPrecision(
+      PrintFloat::RoundTripSignificantDigits<float>());
+  char buffer[bufferSize];
+  PrintFloat::ConvertFloatToTextShortest<float>(
+      f, buffer, bufferSize,
+      PrintFloat::glyphLengthForFloatWithPrecision(
+          PrintFloat::RoundTripSignificantDigits<float>()),
+      ScientificMode);
+  assert_text_is_read_back_as(buffer, f);
+}
+
+QUIZ_CASE(poincare_print_float_round_trip) {
+  /* Checking the 2^31 positive floats takes too long, so the floats are
+   * sampled across all exponents, with every float of a few ranges where the
+   * rounding interval is unusual: denormals and powers of two. */
+  constexpr uint32_t k_step = 49999;
+  constexpr uint32_t k_infinityBits = 0x7F800000;
+  for (uint32_t bits = 1; bits < k_infinityBits; bits += k_step) {
+    float f;
+    memcpy(&f, &bits, sizeof(f));
+    assert_float_round_trips(f);
+  }
+  for (int exponent = -149; exponent < 128; exponent++) {
+    float powerOfTwo = std::ldexp(1.0f, exponent);
+    assert_float_round_trips(powerOfTwo);
+    if (exponent > -149) {
+      assert_float_round_trips(std::nextafter(powerOfTwo, 0.0f));
+    }
+    assert_float_round_trips(std::nextafter(powerOfTwo, INFINITY));
+  }
+  constexpr uint32_t k_denseRangeLength = 2000;
+  constexpr uint32_t k_denseRangesStart[] = {
+      1, 0x3F800000, 0x7F7FFFFF - k_denseRangeLength};
+  for (uint32_t start : k_denseRangesStart) {
+    for (uint32_t bits = start; bits < start + k_denseRangeLength; bits++) {
+      float f;
+      memcpy(&f, &bits, sizeof(f));
+      assert_float_round_trips(f);
+    }
+  }
+}
@@ -373,11 +373,16 @@ Q(KEY_EXE)
 
 // Kandinsky QSTRs
 Q(kandinsky)
+Q(blit)
 Q(color)
+Q(display)
+Q(draw_line)
 Q(draw_string)
 Q(fill_rect)
 Q(get_pixel)
 Q(set_pixel)
+Q(set_pixels)
+Q(use_buffer)
 
 // Matplotlib QSTRs
 Q(arrow)
@@ -460,6 +465,15 @@ Q(transpose)
 Q(flatten)
 Q(tolist)
 Q(flatiter)
+Q(linalg)
+Q(cholesky)
+Q(det)
+Q(eig)
+Q(inv)
+Q(norm)
+Q(qr)
+Q(fft)
+Q(ifft)
 Q(ulab)
 Q(__version__)
 
@@ -501,6 +515,8 @@ Q(hideturtle)
 Q(ht)
 Q(isvisible)
 Q(colormode)
+Q(tracer)
+Q(update)
 
 // utime QSTRs
 Q(time)
@@ -1,6 +1,7 @@
 #include "helpers.h"
 
 #include <ion.h>
+#include <omg/instance_local.h>
 
 #include "port.h"
 extern "C" {
@@ -15,7 +16,7 @@ bool micropython_port_vm_hook_loop() {
   /* Doing too many things here slows down Python execution quite a lot. So we
    * only do things once in a while and return as soon as possible otherwise. */
 
-  static uint64_t t = Ion::Timing::millis();
+  static OMG_INSTANCE_LOCAL uint64_t t = Ion::Timing::millis();
   constexpr static uint64_t delay = 100;
 
   uint64_t t2 = Ion::Timing::millis();
@@ -37,7 +38,7 @@ void micropython_port_vm_hook_refresh_print() {
 }
 
 bool micropython_port_interruptible_msleep(int32_t delay) {
-  static uint64_t lastRun = 0;
+  static OMG_INSTANCE_LOCAL uint64_t lastRun = 0;
   assert(delay >= 0);
   constexpr int32_t miniumDelayBetweenInterruptions = 25;
   constexpr int32_t interruptionCheckDelay = 100;
@@ -14,6 +14,17 @@ void micropython_port_vm_hook_refresh_print();
 bool micropython_port_interruptible_msleep(int32_t delay);
 bool micropython_port_interrupt_if_needed();
 int micropython_port_random();
+/* Return the compiled raw code of an imported script, from the script cache
+ * when possible. */
+struct _mp_raw_code_t;
+struct _mp_raw_code_t *micropython_port_raw_code_for_script(
+    const char *filename);
+#if MICROPY_PORT_PROFILER
+// Called by the VM hook, see profiler.h
+struct _mp_code_state_t;
+void micropython_port_profiler_sample(
+    const struct _mp_code_state_t *code_state, const uint8_t *ip);
+#endif
 
 #ifdef __cplusplus
 }
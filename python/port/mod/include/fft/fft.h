@@ -1 +0,0 @@
-// Ulab requires this file to be present
@@ -3,10 +3,50 @@ extern "C" {
 
 #include <py/runtime.h>
 }
+#include <kandinsky/framebuffer.h>
 #include <kandinsky/ion_context.h>
+#include <omg/instance_local.h>
+#include <stdint.h>
+#include <string.h>
+
+#include <algorithm>
 
 #include "port.h"
 
+/* The back buffer covers a rect of the sandbox, and is drawn on with the
+ * coordinates of the sandbox. Its pixels are allocated on the Python heap. */
+class BackBufferContext : public KDContext {
+ public:
+  BackBufferContext() : KDContext(KDPointZero, KDRectZero) {}
+  bool isActive() const { return m_pixels != nullptr; }
+  KDRect rect() const { return m_rect; }
+  KDColor *pixels() const { return m_pixels; }
+  KDColor **pixelsAddress() { return &m_pixels; }
+  void setBuffer(KDColor *pixels, KDRect rect) {
+    m_pixels = pixels;
+    m_rect = rect;
+    setOrigin(KDPoint(-rect.x(), -rect.y()));
+    setClippingRect(KDRect(KDPointZero, rect.size()));
+  }
+
+ private:
+  KDFrameBuffer frameBuffer() { return KDFrameBuffer(m_pixels, m_rect.size()); }
+  void pushRect(KDRect rect, const KDColor *pixels) override {
+    frameBuffer().pushRect(rect, pixels);
+  }
+  void pushRectUniform(KDRect rect, KDColor color) override {
+    frameBuffer().pushRectUniform(rect, color);
+  }
+  void pullRect(KDRect rect, KDColor *pixels) override {
+    frameBuffer().pullRect(rect, pixels);
+  }
+
+  KDColor *m_pixels = nullptr;
+  KDRect m_rect = KDRectZero;
+};
+
+static OMG_INSTANCE_LOCAL BackBufferContext sBackBuffer;
+
 static mp_obj_t TupleForKDColor(KDColor c) {
   mp_obj_tuple_t *t =
       static_cast<mp_obj_tuple_t *>(MP_OBJ_TO_PTR(mp_obj_new_tuple(3, NULL)));
@@ -20,7 +60,29 @@ static mp_obj_t TupleForKDColor(KDColor c) {
  * calling kandinsky_get_pixel, kandinsky_set_pixel and kandinsky_draw_string.
  * We do this here with displaySandbox(), which pushes the SandboxController on
  * the stackViewController and forces the window to redraw itself.
- * KDIonContext::sharedContext is set to the frame of the last object drawn. */
+ * KDIonContext::sharedContext is set to the frame of the last object drawn.
+ * Drawing on the back buffer does not need the sandbox to be displayed until
+ * the back buffer is flushed. */
+
+static KDContext *DrawingContext() {
+  if (sBackBuffer.isActive()) {
+    return &sBackBuffer;
+  }
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()
+      ->displaySandbox();
+  return KDIonContext::SharedContext;
+}
+
+mp_obj_t modkandinsky___init__() {
+  sBackBuffer.setBuffer(nullptr, KDRectZero);
+  return mp_const_none;
+}
+
+void modkandinsky_gc_collect() {
+  // Mark the pixels of the back buffer as a GC root
+  MicroPython::collectRootsAtAddress(
+      reinterpret_cast<char *>(sBackBuffer.pixelsAddress()), sizeof(KDColor *));
+}
 
 mp_obj_t modkandinsky_color(size_t n_args, const mp_obj_t *args) {
   mp_obj_t color;
@@ -44,16 +106,43 @@ mp_obj_t modkandinsky_color(size_t n_args, const mp_obj_t *args) {
 mp_obj_t modkandinsky_get_pixel(mp_obj_t x, mp_obj_t y) {
   KDPoint point(mp_obj_get_int(x), mp_obj_get_int(y));
   KDColor c;
-  KDIonContext::SharedContext->getPixel(point, &c);
+  KDContext *context = sBackBuffer.isActive()
+                           ? static_cast<KDContext *>(&sBackBuffer)
+                           : KDIonContext::SharedContext;
+  context->getPixel(point, &c);
   return TupleForKDColor(c);
 }
 
 mp_obj_t modkandinsky_set_pixel(mp_obj_t x, mp_obj_t y, mp_obj_t input) {
   KDPoint point(mp_obj_get_int(x), mp_obj_get_int(y));
   KDColor kdColor = MicroPython::Color::Parse(input);
-  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()
-      ->displaySandbox();
-  KDIonContext::SharedContext->setPixel(point, kdColor);
+  DrawingContext()->setPixel(point, kdColor);
+  return mp_const_none;
+}
+
+mp_obj_t modkandinsky_set_pixels(mp_obj_t xs, mp_obj_t ys, mp_obj_t input) {
+  KDColor kdColor = MicroPython::Color::Parse(input);
+  mp_obj_t xIterable = mp_getiter(xs, nullptr);
+  mp_obj_t yIterable = mp_getiter(ys, nullptr);
+  KDContext *context = DrawingContext();
+  while (true) {
+    mp_obj_t x = mp_iternext(xIterable);
+    mp_obj_t y = mp_iternext(yIterable);
+    if (x == MP_OBJ_STOP_ITERATION || y == MP_OBJ_STOP_ITERATION) {
+      if (x != y) {
+        mp_raise_ValueError("x and y must be the same size");
+      }
+      return mp_const_none;
+    }
+    context->setPixel(KDPoint(mp_obj_get_int(x), mp_obj_get_int(y)), kdColor);
+  }
+}
+
+mp_obj_t modkandinsky_draw_line(size_t n_args, const mp_obj_t *args) {
+  KDPoint p1(mp_obj_get_int(args[0]), mp_obj_get_int(args[1]));
+  KDPoint p2(mp_obj_get_int(args[2]), mp_obj_get_int(args[3]));
+  KDColor color = MicroPython::Color::Parse(args[4]);
+  DrawingContext()->drawLine(p1, p2, color);
   return mp_const_none;
 }
 
@@ -65,9 +154,7 @@ mp_obj_t modkandinsky_draw_string(size_t n_args, const mp_obj_t *args) {
       (n_args >= 4) ? MicroPython::Color::Parse(args[3]) : KDColorBlack;
   KDColor backgroundColor =
       (n_args >= 5) ? MicroPython::Color::Parse(args[4]) : KDColorWhite;
-  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()
-      ->displaySandbox();
-  KDIonContext::SharedContext->drawString(
+  DrawingContext()->drawString(
       text, point,
       KDGlyph::Style{.glyphColor = textColor,
                      .backgroundColor = backgroundColor,
@@ -75,7 +162,7 @@ mp_obj_t modkandinsky_draw_string(size_t n_args, const mp_obj_t *args) {
   return mp_const_none;
 }
 
-mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t *args) {
+static KDRect RectFromArguments(const mp_obj_t *args) {
   mp_int_t x = mp_obj_get_int(args[0]);
   mp_int_t y = mp_obj_get_int(args[1]);
   mp_int_t width = mp_obj_get_int(args[2]);
@@ -88,10 +175,85 @@ mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t *args) {
     height = -height;
     y = y - height;
   }
-  KDRect rect(x, y, width, height);
+  return KDRect(x, y, width, height);
+}
+
+mp_obj_t modkandinsky_fill_rect(size_t n_args, const mp_obj_t *args) {
+  KDRect rect = RectFromArguments(args);
   KDColor color = MicroPython::Color::Parse(args[4]);
+  DrawingContext()->fillRect(rect, color);
+  return mp_const_none;
+}
+
+mp_obj_t modkandinsky_blit(size_t n_args, const mp_obj_t *args) {
+  KDRect rect = RectFromArguments(args);
+  mp_buffer_info_t bufferInfo;
+  mp_get_buffer_raise(args[4], &bufferInfo, MP_BUFFER_READ);
+  size_t numberOfPixels = static_cast<size_t>(rect.width()) * rect.height();
+  if (bufferInfo.len != numberOfPixels * sizeof(KDColor)) {
+    mp_raise_ValueError("data must hold 2 bytes per pixel");
+  }
+  KDContext *context = DrawingContext();
+  if (reinterpret_cast<uintptr_t>(bufferInfo.buf) % alignof(KDColor) == 0) {
+    context->fillRectWithPixels(
+        rect, static_cast<const KDColor *>(bufferInfo.buf), nullptr);
+    return mp_const_none;
+  }
+  /* Data such as interned bytes may not be aligned on pixels, in which case it
+   * is copied chunk by chunk. */
+  constexpr KDCoordinate k_chunkLength = 64;
+  KDColor chunk[k_chunkLength];
+  const uint8_t *data = static_cast<const uint8_t *>(bufferInfo.buf);
+  for (KDCoordinate j = 0; j < rect.height(); j++) {
+    for (KDCoordinate i = 0; i < rect.width(); i += k_chunkLength) {
+      KDCoordinate length = std::min<KDCoordinate>(k_chunkLength,
+                                                   rect.width() - i);
+      memcpy(chunk, data, length * sizeof(KDColor));
+      data += length * sizeof(KDColor);
+      context->fillRectWithPixels(
+          KDRect(rect.x() + i, rect.y() + j, length, 1), chunk, nullptr);
+    }
+  }
+  return mp_const_none;
+}
+
+mp_obj_t modkandinsky_use_buffer(size_t n_args, const mp_obj_t *args) {
+  if (n_args != 0 && n_args != 4) {
+    mp_raise_TypeError("use_buffer takes 0 or 4 arguments");
+  }
+  KDColor *previousPixels = sBackBuffer.pixels();
+  size_t previousNumberOfPixels =
+      static_cast<size_t>(sBackBuffer.rect().width()) *
+      sBackBuffer.rect().height();
+  sBackBuffer.setBuffer(nullptr, KDRectZero);
+  m_del(KDColor, previousPixels, previousNumberOfPixels);
+  if (n_args == 0) {
+    return mp_const_none;
+  }
+  KDRect rect = RectFromArguments(args);
+  if (rect.isEmpty()) {
+    return mp_const_none;
+  }
+  size_t numberOfPixels = static_cast<size_t>(rect.width()) * rect.height();
+  KDColor *pixels = m_new(KDColor, numberOfPixels);
+  /* The back buffer starts with what is displayed, so that drawings can be
+   * flushed on top of the sandbox. Pixels out of the sandbox read as black, as
+   * with get_pixel. */
+  std::fill(pixels, pixels + numberOfPixels, KDColorBlack);
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()
+      ->displaySandbox();
+  KDIonContext::SharedContext->getPixels(rect, pixels);
+  sBackBuffer.setBuffer(pixels, rect);
+  return mp_const_none;
+}
+
+mp_obj_t modkandinsky_display() {
+  if (!sBackBuffer.isActive()) {
+    return mp_const_none;
+  }
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()
       ->displaySandbox();
-  KDIonContext::SharedContext->fillRect(rect, color);
+  KDIonContext::SharedContext->fillRectWithPixels(
+      sBackBuffer.rect(), sBackBuffer.pixels(), nullptr);
   return mp_const_none;
 }
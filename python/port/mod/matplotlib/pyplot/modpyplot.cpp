@@ -8,13 +8,19 @@ extern "C" {
 }
 #include <assert.h>
 #include <escher/palette.h>
+#include <omg/global_box.h>
+#include <omg/instance_local.h>
 
 #include "plot_controller.h"
 #include "port.h"
 
-Matplotlib::PlotStore *sPlotStore = nullptr;
-Matplotlib::PlotController *sPlotController = nullptr;
-static int paletteIndex = 0;
+static OMG_INSTANCE_LOCAL OMG::TrackedGlobalBox<Matplotlib::PlotStore>
+    sPlotStoreBox;
+static OMG_INSTANCE_LOCAL OMG::TrackedGlobalBox<Matplotlib::PlotController>
+    sPlotControllerBox;
+OMG_INSTANCE_LOCAL Matplotlib::PlotStore *sPlotStore = nullptr;
+OMG_INSTANCE_LOCAL Matplotlib::PlotController *sPlotController = nullptr;
+static OMG_INSTANCE_LOCAL int paletteIndex = 0;
 
 // Private helper
 
@@ -83,11 +89,15 @@ bool colorFromKeywordArgument(mp_map_elem_t *elemColor, KDColor *color) {
 // Internal functions
 
 mp_obj_t modpyplot___init__() {
-  static Matplotlib::PlotStore plotStore;
-  static Matplotlib::PlotController plotController(&plotStore);
-  sPlotStore = &plotStore;
-  sPlotController = &plotController;
-  sPlotStore->flush();
+  /* The module is initialized once per MicroPython session. The store, its
+   * controller and the color cycle are rebuilt, so that nothing is left from
+   * the previous sessions, such as the range of their last plot. */
+  sPlotControllerBox.deinit();
+  sPlotStoreBox.deinit();
+  sPlotStoreBox.init();
+  sPlotControllerBox.init(sPlotStoreBox.get());
+  sPlotStore = sPlotStoreBox;
+  sPlotController = sPlotControllerBox;
   paletteIndex = 0;
   return mp_const_none;
 }
@@ -465,12 +475,8 @@ mp_obj_t modpyplot_plot(size_t n_args, const mp_obj_t *args,
   size_t length;
   if (n_args == 1) {
     length = extractArgument(args[0], &yItems);
-
-    // Create the default xItems: [0, 1, 2,...]
-    xItems = m_new(mp_obj_t, length);
-    for (size_t i = 0; i < length; i++) {
-      xItems[i] = mp_obj_new_float((float)i);
-    }
+    // The default xItems are [0, 1, 2,...]
+    xItems = nullptr;
   } else {
     assert(n_args >= 2);
     length =
@@ -492,10 +498,7 @@ mp_obj_t modpyplot_plot(size_t n_args, const mp_obj_t *args,
     color = MicroPython::Color::Parse(args[2]);
   }
 
-  for (int i = 0; i < (int)length - 1; i++) {
-    sPlotStore->addSegment(xItems[i], yItems[i], xItems[i + 1], yItems[i + 1],
-                           color);
-  }
+  sPlotStore->addPolyline(length, xItems, yItems, color);
 
   return mp_const_none;
 }
@@ -1,6 +1,7 @@
 #include "plot_store.h"
 
 #include <algorithm>
+#include <new>
 
 namespace Matplotlib {
 
@@ -9,136 +10,84 @@ PlotStore::PlotStore() : Shared::InteractiveCurveViewRange(), m_show(false) {
 }
 
 void PlotStore::flush() {
-  m_dots = mp_obj_new_list(0, nullptr);
-  m_segments = mp_obj_new_list(0, nullptr);
-  m_rects = mp_obj_new_list(0, nullptr);
-  m_labels = mp_obj_new_list(0, nullptr);
+  m_dots.reset();
+  m_segments.reset();
+  m_polylines.reset();
+  m_points.reset();
+  m_rects.reset();
+  m_labels.reset();
   m_axesRequested = true;
   m_axesAuto = true;
   m_gridRequested = false;
 }
 
-// Iterators
+// PackedList
 
 template <class T>
-PlotStore::ListIterator<T> PlotStore::ListIterator<T>::Begin(mp_obj_t list) {
-  ListIterator<T> it;
-  mp_obj_list_get(list, &(it.m_numberOfTuples), &(it.m_tuples));
-  return it;
-}
-
-template <class T>
-PlotStore::ListIterator<T> PlotStore::ListIterator<T>::End(mp_obj_t list) {
-  ListIterator<T> it;
-  mp_obj_list_get(list, &(it.m_numberOfTuples), &(it.m_tuples));
-  if (it.m_numberOfTuples > 0) {
-    it.m_tupleIndex = it.m_numberOfTuples;
+void PlotStore::PackedList<T>::reserve(size_t capacity) {
+  if (capacity <= m_capacity) {
+    return;
   }
-  return it;
+  m_items = m_renew(T, m_items, m_capacity, capacity);
+  m_capacity = capacity;
 }
 
 template <class T>
-PlotStore::ListIterator<T>& PlotStore::ListIterator<T>::operator++() {
-  if (m_tupleIndex < m_numberOfTuples) {
-    m_tupleIndex++;
+void PlotStore::PackedList<T>::append(const T& item) {
+  if (m_length == m_capacity) {
+    // Grow by half to spare the heap
+    reserve(m_capacity + std::max<size_t>(m_capacity / 2, 4));
   }
-  return *this;
+  new (m_items + m_length) T(item);
+  m_length++;
 }
 
-template <class T>
-bool PlotStore::ListIterator<T>::operator!=(
-    const PlotStore::ListIterator<T>& it) const {
-  return m_tupleIndex != it.m_tupleIndex;
-};
-
-template <class T>
-T PlotStore::ListIterator<T>::operator*() {
-  return T(m_tuples[m_tupleIndex]);
-};
-
 // Dot
 
-template class PlotStore::ListIterator<PlotStore::Dot>;
-
-PlotStore::Dot::Dot(mp_obj_t tuple) {
-  mp_obj_t* elements;
-  mp_obj_get_array_fixed_n(tuple, 3, &elements);
-  m_x = mp_obj_get_float(elements[0]);
-  m_y = mp_obj_get_float(elements[1]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[2]));
-}
-
 void PlotStore::addDot(mp_obj_t x, mp_obj_t y, KDColor c) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[3] = {x, y, color};
-  mp_obj_t tuple = mp_obj_new_tuple(3, items);
-  mp_obj_list_append(m_dots, tuple);
+  m_dots.append(Dot(mp_obj_get_float(x), mp_obj_get_float(y), c));
 }
 
 // Segment
 
-template class PlotStore::ListIterator<PlotStore::Segment>;
-
-PlotStore::Segment::Segment(mp_obj_t tuple) {
-  mp_obj_t* elements;
-  mp_obj_get_array_fixed_n(tuple, 6, &elements);
-  m_xStart = mp_obj_get_float(elements[0]);
-  m_yStart = mp_obj_get_float(elements[1]);
-  m_xEnd = mp_obj_get_float(elements[2]);
-  m_yEnd = mp_obj_get_float(elements[3]);
-  m_arrowWidth = mp_obj_get_float(elements[4]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[5]));
-}
-
 void PlotStore::addSegment(mp_obj_t xStart, mp_obj_t yStart, mp_obj_t xEnd,
                            mp_obj_t yEnd, KDColor c, mp_obj_t arrowWidth) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[6] = {xStart, yStart, xEnd, yEnd, arrowWidth, color};
-  mp_obj_t tuple = mp_obj_new_tuple(6, items);
-  mp_obj_list_append(m_segments, tuple);
+  m_segments.append(Segment(mp_obj_get_float(xStart), mp_obj_get_float(yStart),
+                            mp_obj_get_float(xEnd), mp_obj_get_float(yEnd),
+                            mp_obj_get_float(arrowWidth), c));
 }
 
-// Rect
-
-template class PlotStore::ListIterator<PlotStore::Rect>;
+// Polyline
 
-PlotStore::Rect::Rect(mp_obj_t tuple) {
-  mp_obj_t* elements;
-  mp_obj_get_array_fixed_n(tuple, 5, &elements);
-  m_left = mp_obj_get_float(elements[0]);
-  m_right = mp_obj_get_float(elements[1]);
-  m_top = mp_obj_get_float(elements[2]);
-  m_bottom = mp_obj_get_float(elements[3]);
-  m_color = KDColor::RGB16(mp_obj_get_int(elements[4]));
+void PlotStore::addPolyline(size_t numberOfPoints, const mp_obj_t* xs,
+                            const mp_obj_t* ys, KDColor c) {
+  if (numberOfPoints < 2) {
+    return;
+  }
+  size_t firstPointIndex = m_points.length();
+  m_points.reserve(firstPointIndex + numberOfPoints);
+  for (size_t i = 0; i < numberOfPoints; i++) {
+    float x = xs ? mp_obj_get_float(xs[i]) : static_cast<float>(i);
+    m_points.append(Poincare::Coordinate2D<float>(x, mp_obj_get_float(ys[i])));
+  }
+  m_polylines.append(Polyline(firstPointIndex, numberOfPoints, c));
 }
 
+// Rect
+
 void PlotStore::addRect(mp_obj_t left, mp_obj_t right, mp_obj_t top,
                         mp_obj_t bottom, KDColor c) {
-  mp_obj_t color = mp_obj_new_int(c);
-  mp_obj_t items[5] = {left, right, top, bottom, color};
-  mp_obj_t tuple = mp_obj_new_tuple(5, items);
-  mp_obj_list_append(m_rects, tuple);
+  m_rects.append(Rect(mp_obj_get_float(left), mp_obj_get_float(right),
+                      mp_obj_get_float(top), mp_obj_get_float(bottom), c));
 }
 
 // Label
 
-template class PlotStore::ListIterator<PlotStore::Label>;
-
-PlotStore::Label::Label(mp_obj_t tuple) {
-  mp_obj_t* elements;
-  mp_obj_get_array_fixed_n(tuple, 3, &elements);
-  m_x = mp_obj_get_float(elements[0]);
-  m_y = mp_obj_get_float(elements[1]);
-  m_string = mp_obj_str_get_str(elements[2]);
-}
-
 void PlotStore::addLabel(mp_obj_t x, mp_obj_t y, mp_obj_t string) {
-  mp_obj_t items[3] = {x, y, string};
   if (!mp_obj_is_str(string)) {
     mp_raise_TypeError("argument should be a string");
   }
-  mp_obj_t tuple = mp_obj_new_tuple(3, items);
-  mp_obj_list_append(m_labels, tuple);
+  m_labels.append(Label(mp_obj_get_float(x), mp_obj_get_float(y), string));
 }
 
 // Axes
@@ -185,6 +134,12 @@ void PlotStore::initRange() {
                   segment.yStart());
       updateRange(&xMin, &xMax, &yMin, &yMax, segment.xEnd(), segment.yEnd());
     }
+    for (PlotStore::Polyline polyline : polylines()) {
+      const Poincare::Coordinate2D<float>* points = pointsOfPolyline(polyline);
+      for (size_t i = 0; i < polyline.numberOfPoints(); i++) {
+        updateRange(&xMin, &xMax, &yMin, &yMax, points[i].x(), points[i].y());
+      }
+    }
     for (PlotStore::Rect rectangle : rects()) {
       updateRange(&xMin, &xMax, &yMin, &yMax, rectangle.left(),
                   rectangle.top());
@@ -14,40 +14,33 @@ class PlotStore : public Shared::InteractiveCurveViewRange {
   PlotStore();
   void flush();
 
-  // Iterators
-
-  template <class T>
-  class ListIterator {
-   public:
-    static ListIterator Begin(mp_obj_t list);
-    static ListIterator End(mp_obj_t list);
-    T operator*();
-    ListIterator& operator++();
-    bool operator!=(const ListIterator& it) const;
-
-   private:
-    ListIterator() : m_tupleIndex(0) {}
-    mp_obj_t* m_tuples;
-    size_t m_numberOfTuples;
-    size_t m_tupleIndex;
-  };
-
+  /* The primitives are packed in native arrays allocated on the Python heap,
+   * which are reached from the PlotStore when collecting the garbage. */
   template <class T>
-  class Iterable {
+  class PackedList {
    public:
-    Iterable(mp_obj_t list) : m_list(list) {}
-    T begin() const { return T::Begin(m_list); }
-    T end() const { return T::End(m_list); }
+    PackedList() : m_items(nullptr), m_length(0), m_capacity(0) {}
+    const T* begin() const { return m_items; }
+    const T* end() const { return m_items + m_length; }
+    size_t length() const { return m_length; }
+    // May raise a MemoryError
+    void reserve(size_t capacity);
+    void append(const T& item);
+    /* The items are not freed, since they may belong to the heap of a
+     * previous MicroPython session. They are garbage collected otherwise. */
+    void reset() { *this = PackedList(); }
 
    private:
-    mp_obj_t m_list;
+    T* m_items;
+    size_t m_length;
+    size_t m_capacity;
   };
 
   // Dot
 
   class Dot {
    public:
-    Dot(mp_obj_t tuple);
+    Dot(float x, float y, KDColor color) : m_x(x), m_y(y), m_color(color) {}
     float x() const { return m_x; }
     float y() const { return m_y; }
     KDColor color() const { return m_color; }
@@ -59,15 +52,20 @@ class PlotStore : public Shared::InteractiveCurveViewRange {
   };
 
   void addDot(mp_obj_t x, mp_obj_t y, KDColor c);
-  Iterable<ListIterator<Dot>> dots() {
-    return Iterable<ListIterator<Dot>>(m_dots);
-  }
+  const PackedList<Dot>& dots() const { return m_dots; }
 
   // Segment
 
   class Segment {
    public:
-    Segment(mp_obj_t tuple);
+    Segment(float xStart, float yStart, float xEnd, float yEnd,
+            float arrowWidth, KDColor color)
+        : m_xStart(xStart),
+          m_yStart(yStart),
+          m_xEnd(xEnd),
+          m_yEnd(yEnd),
+          m_arrowWidth(arrowWidth),
+          m_color(color) {}
     float xStart() const { return m_xStart; }
     float yStart() const { return m_yStart; }
     float xEnd() const { return m_xEnd; }
@@ -85,17 +83,46 @@ class PlotStore : public Shared::InteractiveCurveViewRange {
   };
 
   void addSegment(mp_obj_t xStart, mp_obj_t yStart, mp_obj_t xEnd,
-                  mp_obj_t yEnd, KDColor c,
-                  mp_obj_t arrowWidth = mp_obj_new_float(NAN));
-  Iterable<ListIterator<Segment>> segments() {
-    return Iterable<ListIterator<Segment>>(m_segments);
+                  mp_obj_t yEnd, KDColor c, mp_obj_t arrowWidth);
+  const PackedList<Segment>& segments() const { return m_segments; }
+
+  // Polyline
+
+  class Polyline {
+   public:
+    Polyline(size_t firstPointIndex, size_t numberOfPoints, KDColor color)
+        : m_firstPointIndex(firstPointIndex),
+          m_numberOfPoints(numberOfPoints),
+          m_color(color) {}
+    size_t firstPointIndex() const { return m_firstPointIndex; }
+    size_t numberOfPoints() const { return m_numberOfPoints; }
+    KDColor color() const { return m_color; }
+
+   private:
+    size_t m_firstPointIndex;
+    size_t m_numberOfPoints;
+    KDColor m_color;
+  };
+
+  // If xs is null, the abscissae are the indices of the points
+  void addPolyline(size_t numberOfPoints, const mp_obj_t* xs,
+                   const mp_obj_t* ys, KDColor c);
+  const PackedList<Polyline>& polylines() const { return m_polylines; }
+  const Poincare::Coordinate2D<float>* pointsOfPolyline(
+      const Polyline& polyline) const {
+    return m_points.begin() + polyline.firstPointIndex();
   }
 
   // Rect
 
   class Rect {
    public:
-    Rect(mp_obj_t tuple);
+    Rect(float left, float right, float top, float bottom, KDColor color)
+        : m_left(left),
+          m_right(right),
+          m_top(top),
+          m_bottom(bottom),
+          m_color(color) {}
     float left() const { return m_left; }
     float right() const { return m_right; }
     float top() const { return m_top; }
@@ -112,29 +139,26 @@ class PlotStore : public Shared::InteractiveCurveViewRange {
 
   void addRect(mp_obj_t x, mp_obj_t y, mp_obj_t width, mp_obj_t height,
                KDColor c);
-  Iterable<ListIterator<Rect>> rects() {
-    return Iterable<ListIterator<Rect>>(m_rects);
-  }
+  const PackedList<Rect>& rects() const { return m_rects; }
 
   // Label
 
   class Label {
    public:
-    Label(mp_obj_t tuple);
+    Label(float x, float y, mp_obj_t string)
+        : m_x(x), m_y(y), m_string(string) {}
     float x() const { return m_x; }
     float y() const { return m_y; }
-    const char* string() const { return m_string; }
+    const char* string() const { return mp_obj_str_get_str(m_string); }
 
    private:
     float m_x;
     float m_y;
-    const char* m_string;
+    mp_obj_t m_string;
   };
 
   void addLabel(mp_obj_t x, mp_obj_t y, mp_obj_t string);
-  Iterable<ListIterator<Label>> labels() {
-    return Iterable<ListIterator<Label>>(m_labels);
-  }
+  const PackedList<Label>& labels() const { return m_labels; }
 
   void setAxesRequested(bool b) { m_axesRequested = b; }
   bool axesRequested() const { return m_axesRequested; }
@@ -147,10 +171,12 @@ class PlotStore : public Shared::InteractiveCurveViewRange {
   bool gridRequested() const { return m_gridRequested; }
 
  private:
-  mp_obj_t m_dots;      // List of (x, y, color)
-  mp_obj_t m_labels;    // List of (x, y, string)
-  mp_obj_t m_segments;  // List of (x, y, dx, dy, style, color)
-  mp_obj_t m_rects;     // List of (x, y, w, h, color)
+  PackedList<Dot> m_dots;
+  PackedList<Label> m_labels;
+  PackedList<Segment> m_segments;
+  PackedList<Polyline> m_polylines;
+  PackedList<Poincare::Coordinate2D<float>> m_points;
+  PackedList<Rect> m_rects;
   bool m_axesRequested;
   bool m_axesAuto;
   bool m_gridRequested;
@@ -39,6 +39,9 @@ void PyplotPolicy::drawPlot(const AbstractPlotView* plotView, KDContext* ctx,
     for (PlotStore::Segment segment : m_store->segments()) {
       traceSegment(plotView, ctx, rect, segment);
     }
+    for (PlotStore::Polyline polyline : m_store->polylines()) {
+      tracePolyline(plotView, ctx, rect, polyline);
+    }
     for (PlotStore::Rect rectangle : m_store->rects()) {
       traceRect(plotView, ctx, rect, rectangle);
     }
@@ -73,6 +76,49 @@ void PyplotPolicy::traceSegment(const AbstractPlotView* plotView,
   }
 }
 
+void PyplotPolicy::tracePolyline(const AbstractPlotView* plotView,
+                                 KDContext* ctx, KDRect r,
+                                 PlotStore::Polyline polyline) const {
+  const Coordinate2D<float>* points = m_store->pointsOfPolyline(polyline);
+  size_t numberOfPoints = polyline.numberOfPoints();
+  if (numberOfPoints <= static_cast<size_t>(plotView->bounds().width())) {
+    for (size_t i = 0; i < numberOfPoints - 1; i++) {
+      plotView->drawSegment(ctx, r, points[i], points[i + 1], polyline.color(),
+                            true);
+    }
+    return;
+  }
+  /* There are more points than columns of pixels: consecutive points falling
+   * in the same column are drawn as a vertical segment between their extrema,
+   * joined to the neighbouring columns by their first and last points. */
+  size_t i = 0;
+  while (i < numberOfPoints) {
+    float column = std::floor(
+        plotView->floatToFloatPixel(AbstractPlotView::Axis::Horizontal,
+                                    points[i].x()));
+    float yMin = points[i].y();
+    float yMax = points[i].y();
+    size_t j = i + 1;
+    while (j < numberOfPoints &&
+           std::floor(plotView->floatToFloatPixel(
+               AbstractPlotView::Axis::Horizontal, points[j].x())) == column) {
+      yMin = std::min(yMin, points[j].y());
+      yMax = std::max(yMax, points[j].y());
+      j++;
+    }
+    if (i > 0) {
+      plotView->drawSegment(ctx, r, points[i - 1], points[i], polyline.color(),
+                            true);
+    }
+    if (j - i > 1) {
+      plotView->drawSegment(ctx, r, Coordinate2D<float>(points[i].x(), yMin),
+                            Coordinate2D<float>(points[i].x(), yMax),
+                            polyline.color(), true);
+    }
+    i = j;
+  }
+}
+
 void PyplotPolicy::traceRect(const AbstractPlotView* plotView, KDContext* ctx,
                              KDRect r, PlotStore::Rect rect) const {
   KDCoordinate left = plotView->floatToKDCoordinatePixel(
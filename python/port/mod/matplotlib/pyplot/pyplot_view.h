@@ -45,6 +45,8 @@ class PyplotPolicy {
                 KDRect r, PlotStore::Dot dot) const;
   void traceSegment(const Shared::AbstractPlotView* plotView, KDContext* ctx,
                     KDRect r, PlotStore::Segment segment) const;
+  void tracePolyline(const Shared::AbstractPlotView* plotView, KDContext* ctx,
+                     KDRect r, PlotStore::Polyline polyline) const;
   void traceRect(const Shared::AbstractPlotView* plotView, KDContext* ctx,
                  KDRect r, PlotStore::Rect rect) const;
   void traceLabel(const Shared::AbstractPlotView* plotView, KDContext* ctx,
@@ -30,8 +30,8 @@
 #include "numpy/carray/carray.h"
 #include "numpy/carray/carray_tools.h"
 
-mp_uint_t ndarray_print_threshold = NDARRAY_PRINT_THRESHOLD;
-mp_uint_t ndarray_print_edgeitems = NDARRAY_PRINT_EDGEITEMS;
+MP_STATE_STORAGE mp_uint_t ndarray_print_threshold = NDARRAY_PRINT_THRESHOLD;
+MP_STATE_STORAGE mp_uint_t ndarray_print_edgeitems = NDARRAY_PRINT_EDGEITEMS;
 
 //| """Manipulate numeric data similar to numpy
 //|
@@ -169,8 +169,8 @@ size_t *ndarray_new_coords(uint8_t ndim) {
     return coords;
 }
 
-void ndarray_rewind_array(uint8_t ndim, uint8_t *array, size_t *shape, int32_t *strides, size_t *coords) {
-    // resets the data pointer of a single array, whenever an axis is full
+uint8_t *ndarray_rewind_array(uint8_t ndim, uint8_t *array, size_t *shape, int32_t *strides, size_t *coords) {
+    // returns the data pointer of a single array, reset whenever an axis is full
     // since we always iterate over the very last axis, we have to keep track of
     // the last ndim-2 axes only
     array -= shape[ULAB_MAX_DIMS - 1] * strides[ULAB_MAX_DIMS - 1];
@@ -183,9 +183,10 @@ void ndarray_rewind_array(uint8_t ndim, uint8_t *array, size_t *shape, int32_t *
             coords[ULAB_MAX_DIMS - 1 - i] = 0;
             coords[ULAB_MAX_DIMS - 2 - i] += 1;
         } else { // coordinates can change only, if the last coordinate changes
-            return;
+            return array;
         }
     }
+    return array;
 }
 #endif
 
@@ -599,6 +600,19 @@ bool ndarray_is_dense(ndarray_obj_t *ndarray) {
     return stride == ndarray->strides[ULAB_MAX_DIMS-ndarray->ndim] ? true : false;
 }
 
+bool ndarray_is_contiguous(ndarray_obj_t *ndarray) {
+    // returns true, if the elements follow each other in memory, in the order of iteration
+    // the strides of the axes of length 1 are irrelevant
+    int32_t stride = ndarray->itemsize;
+    for(uint8_t i = ULAB_MAX_DIMS; i > ULAB_MAX_DIMS - ndarray->ndim; i--) {
+        if((ndarray->shape[i-1] > 1) && (ndarray->strides[i-1] != stride)) {
+            return false;
+        }
+        stride *= ndarray->shape[i-1];
+    }
+    return true;
+}
+
 
 ndarray_obj_t *ndarray_new_ndarray(uint8_t ndim, size_t *shape, int32_t *strides, uint8_t dtype) {
     // Creates the base ndarray with shape, and initialises the values to straight 0s
@@ -1847,6 +1861,13 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t _op, mp_obj_t lobj, mp_obj_t robj) {
         }
     }
 
+    #if ULAB_HAS_FAST_PATHS
+    mp_obj_t results = ndarray_binary_op_fast(op, lhs, rhs, ndim, shape);
+    if(results != MP_OBJ_NULL) {
+        return results;
+    }
+    #endif
+
     switch(op) {
         // first the in-place operators
         #if NDARRAY_HAS_INPLACE_ADD
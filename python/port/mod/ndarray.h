@@ -190,6 +190,7 @@ ndarray_obj_t *ndarray_new_ndarray(uint8_t , size_t *, int32_t *, uint8_t );
 ndarray_obj_t *ndarray_new_linear_array(size_t , uint8_t );
 ndarray_obj_t *ndarray_new_view(ndarray_obj_t *, uint8_t , size_t *, int32_t *, int32_t );
 bool ndarray_is_dense(ndarray_obj_t *);
+bool ndarray_is_contiguous(ndarray_obj_t *);
 ndarray_obj_t *ndarray_copy_view(ndarray_obj_t *);
 ndarray_obj_t *ndarray_copy_view_convert_type(ndarray_obj_t *, uint8_t );
 void ndarray_copy_array(ndarray_obj_t *, ndarray_obj_t *, uint8_t );
@@ -204,7 +205,7 @@ mp_obj_t ndarray_binary_op(mp_binary_op_t , mp_obj_t , mp_obj_t );
 mp_obj_t ndarray_unary_op(mp_unary_op_t , mp_obj_t );
 
 size_t *ndarray_new_coords(uint8_t );
-void ndarray_rewind_array(uint8_t , uint8_t *, size_t *, int32_t *, size_t *);
+uint8_t *ndarray_rewind_array(uint8_t , uint8_t *, size_t *, int32_t *, size_t *);
 
 // various ndarray methods
 #if NDARRAY_HAS_BYTESWAP
@@ -298,8 +299,8 @@ ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t , uint8_t );
             (rarray) += (rstrides)[ULAB_MAX_DIMS - 1];\
             l++;\
         }\
-        ndarray_rewind_array((results)->ndim, (larray), (results)->shape, (lstrides), lcoords);\
-        ndarray_rewind_array((results)->ndim, (rarray), (results)->shape, (rstrides), rcoords);\
+        (larray) = ndarray_rewind_array((results)->ndim, (larray), (results)->shape, (lstrides), lcoords);\
+        (rarray) = ndarray_rewind_array((results)->ndim, (rarray), (results)->shape, (rstrides), rcoords);\
     } while(0)
 
 #define INPLACE_LOOP(results, type_left, type_right, larray, rarray, rstrides, OPERATOR)\
@@ -313,8 +314,8 @@ ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t , uint8_t );
             (rarray) += (rstrides)[ULAB_MAX_DIMS - 1];\
             l++;\
         }\
-        ndarray_rewind_array((results)->ndim, (larray), (results)->shape, (results)->strides, lcoords);\
-        ndarray_rewind_array((results)->ndim, (rarray), (results)->shape, (rstrides), rcoords);\
+        (larray) = ndarray_rewind_array((results)->ndim, (larray), (results)->shape, (results)->strides, lcoords);\
+        (rarray) = ndarray_rewind_array((results)->ndim, (rarray), (results)->shape, (rstrides), rcoords);\
     } while(0)
 
 #define EQUALITY_LOOP(results, array, type_left, type_right, larray, lstrides, rarray, rstrides, OPERATOR)\
@@ -328,8 +329,8 @@ ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t , uint8_t );
             (rarray) += (rstrides)[ULAB_MAX_DIMS - 1];\
             l++;\
         }\
-        ndarray_rewind_array((results)->ndim, (larray), (results)->shape, (lstrides), lcoords);\
-        ndarray_rewind_array((results)->ndim, (rarray), (results)->shape, (rstrides), rcoords);\
+        (larray) = ndarray_rewind_array((results)->ndim, (larray), (results)->shape, (lstrides), lcoords);\
+        (rarray) = ndarray_rewind_array((results)->ndim, (rarray), (results)->shape, (rstrides), rcoords);\
     } while(0)
 
 #define POWER_LOOP(results, type_out, type_left, type_right, larray, lstrides, rarray, rstrides)\
@@ -344,8 +345,8 @@ ndarray_obj_t *ndarray_from_mp_obj(mp_obj_t , uint8_t );
             (rarray) += (rstrides)[ULAB_MAX_DIMS - 1];\
             l++;\
         }\
-        ndarray_rewind_array((results)->ndim, (larray), (results)->shape, (lstrides), lcoords);\
-        ndarray_rewind_array((results)->ndim, (rarray), (results)->shape, (rstrides), rcoords);\
+        (larray) = ndarray_rewind_array((results)->ndim, (larray), (results)->shape, (lstrides), lcoords);\
+        (rarray) = ndarray_rewind_array((results)->ndim, (rarray), (results)->shape, (rstrides), rcoords);\
     } while(0)
 
 #else
@@ -837,3 +837,131 @@ mp_obj_t ndarray_inplace_power(ndarray_obj_t *lhs, ndarray_obj_t *rhs, int32_t *
     return MP_OBJ_FROM_PTR(lhs);
 }
 #endif /* NDARRAY_HAS_INPLACE_POWER */
+
+#if ULAB_HAS_FAST_PATHS
+/*
+    The fast paths of the binary operators
+
+    If each operand is either contiguous, with the length of the results, or a
+    scalar, the elements can be processed in a single flat loop. The dtypes of the
+    fast paths are those of most scripts, uint8, int16, and float, and the results
+    are upcast as in the loops above.
+*/
+
+static uint8_t ndarray_fast_dtype(ndarray_obj_t *lhs, ndarray_obj_t *rhs, size_t len) {
+    // returns the dtype, in which the operands can be processed, or 0, if there is no fast path
+    if(len < 2) {
+        return 0;
+    }
+    if(((lhs->len != 1) && ((lhs->len != len) || !ndarray_is_contiguous(lhs))) ||
+        ((rhs->len != 1) && ((rhs->len != len) || !ndarray_is_contiguous(rhs)))) {
+        return 0;
+    }
+    if(lhs->dtype == rhs->dtype) {
+        if((lhs->dtype == NDARRAY_UINT8) || (lhs->dtype == NDARRAY_INT16) || (lhs->dtype == NDARRAY_FLOAT)) {
+            return lhs->dtype;
+        }
+        return 0;
+    }
+    // a scalar can be converted to the dtype of the array, if the results are of that dtype
+    ndarray_obj_t *array = lhs->len == 1 ? rhs : lhs;
+    ndarray_obj_t *scalar = lhs->len == 1 ? lhs : rhs;
+    if(scalar->len != 1) {
+        return 0;
+    }
+    #if ULAB_SUPPORTS_COMPLEX
+    if(scalar->dtype == NDARRAY_COMPLEX) {
+        return 0;
+    }
+    #endif
+    if(array->dtype == NDARRAY_FLOAT) {
+        return NDARRAY_FLOAT;
+    }
+    if((array->dtype == NDARRAY_INT16) && ((scalar->dtype == NDARRAY_UINT8) || (scalar->dtype == NDARRAY_INT8))) {
+        return NDARRAY_INT16;
+    }
+    return 0;
+}
+
+mp_obj_t ndarray_binary_op_fast(mp_binary_op_t op, ndarray_obj_t *lhs, ndarray_obj_t *rhs, uint8_t ndim, size_t *shape) {
+    // returns MP_OBJ_NULL, if the operation has to go through the general loops
+    size_t len = 1;
+    for(uint8_t i = ULAB_MAX_DIMS; i > ULAB_MAX_DIMS - ndim; i--) {
+        len *= shape[i-1];
+    }
+    uint8_t dtype = ndarray_fast_dtype(lhs, rhs, len);
+    if(dtype == 0) {
+        return MP_OBJ_NULL;
+    }
+
+    ndarray_obj_t *results = NULL;
+    switch(op) {
+        #if NDARRAY_HAS_BINARY_OP_ADD
+        case MP_BINARY_OP_ADD:
+            results = ndarray_new_dense_ndarray(ndim, shape, dtype == NDARRAY_UINT8 ? NDARRAY_UINT16 : dtype);
+            FAST_ARITHMETIC_LOOP(results, uint16_t, dtype, lhs, rhs, +);
+            break;
+        #endif
+        #if NDARRAY_HAS_BINARY_OP_MULTIPLY
+        case MP_BINARY_OP_MULTIPLY:
+            results = ndarray_new_dense_ndarray(ndim, shape, dtype == NDARRAY_UINT8 ? NDARRAY_UINT16 : dtype);
+            FAST_ARITHMETIC_LOOP(results, uint16_t, dtype, lhs, rhs, *);
+            break;
+        #endif
+        #if NDARRAY_HAS_BINARY_OP_SUBTRACT
+        case MP_BINARY_OP_SUBTRACT:
+            results = ndarray_new_dense_ndarray(ndim, shape, dtype);
+            FAST_ARITHMETIC_LOOP(results, uint8_t, dtype, lhs, rhs, -);
+            break;
+        #endif
+        #if NDARRAY_HAS_BINARY_OP_TRUE_DIVIDE
+        case MP_BINARY_OP_TRUE_DIVIDE:
+            if(dtype != NDARRAY_FLOAT) {
+                return MP_OBJ_NULL;
+            }
+            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_FLOAT);
+            FAST_BINARY_LOOP(results, mp_float_t, mp_float_t, lhs, rhs, /);
+            break;
+        #endif
+        #if NDARRAY_HAS_BINARY_OP_LESS
+        case MP_BINARY_OP_LESS:
+            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_BOOL);
+            FAST_COMPARISON_LOOP(results, dtype, lhs, rhs, <);
+            break;
+        #endif
+        #if NDARRAY_HAS_BINARY_OP_LESS_EQUAL
+        case MP_BINARY_OP_LESS_EQUAL:
+            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_BOOL);
+            FAST_COMPARISON_LOOP(results, dtype, lhs, rhs, <=);
+            break;
+        #endif
+        #if NDARRAY_HAS_BINARY_OP_MORE
+        case MP_BINARY_OP_MORE:
+            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_BOOL);
+            FAST_COMPARISON_LOOP(results, dtype, lhs, rhs, >);
+            break;
+        #endif
+        #if NDARRAY_HAS_BINARY_OP_MORE_EQUAL
+        case MP_BINARY_OP_MORE_EQUAL:
+            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_BOOL);
+            FAST_COMPARISON_LOOP(results, dtype, lhs, rhs, >=);
+            break;
+        #endif
+        #if NDARRAY_HAS_BINARY_OP_EQUAL
+        case MP_BINARY_OP_EQUAL:
+            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_BOOL);
+            FAST_COMPARISON_LOOP(results, dtype, lhs, rhs, ==);
+            break;
+        #endif
+        #if NDARRAY_HAS_BINARY_OP_NOT_EQUAL
+        case MP_BINARY_OP_NOT_EQUAL:
+            results = ndarray_new_dense_ndarray(ndim, shape, NDARRAY_BOOL);
+            FAST_COMPARISON_LOOP(results, dtype, lhs, rhs, !=);
+            break;
+        #endif
+        default:
+            return MP_OBJ_NULL;
+    }
+    return MP_OBJ_FROM_PTR(results);
+}
+#endif /* ULAB_HAS_FAST_PATHS */
@@ -22,6 +22,56 @@ mp_obj_t ndarray_inplace_ams(ndarray_obj_t *, ndarray_obj_t *, int32_t *, uint8_
 mp_obj_t ndarray_inplace_power(ndarray_obj_t *, ndarray_obj_t *, int32_t *);
 mp_obj_t ndarray_inplace_divide(ndarray_obj_t *, ndarray_obj_t *, int32_t *);
 
+#if ULAB_HAS_FAST_PATHS
+mp_obj_t ndarray_binary_op_fast(mp_binary_op_t , ndarray_obj_t *, ndarray_obj_t *, uint8_t , size_t *);
+
+// Each operand is either contiguous, with the length of the results, or a scalar,
+// whose value is read once. Note that the scalar is converted to type_in.
+#define FAST_BINARY_LOOP(results, type_out, type_in, lhs, rhs, OPERATOR)\
+({  type_out *restrict array = (type_out *)(results)->array;\
+    size_t len = (results)->len;\
+    if((lhs)->len == 1) {\
+        type_in lvalue = (type_in)ndarray_get_float_value((lhs)->array, (lhs)->dtype);\
+        type_in *restrict rarray = (type_in *)(rhs)->array;\
+        for(size_t i = 0; i < len; i++) {\
+            array[i] = lvalue OPERATOR rarray[i];\
+        }\
+    } else if((rhs)->len == 1) {\
+        type_in *restrict larray = (type_in *)(lhs)->array;\
+        type_in rvalue = (type_in)ndarray_get_float_value((rhs)->array, (rhs)->dtype);\
+        for(size_t i = 0; i < len; i++) {\
+            array[i] = larray[i] OPERATOR rvalue;\
+        }\
+    } else {\
+        type_in *restrict larray = (type_in *)(lhs)->array;\
+        type_in *restrict rarray = (type_in *)(rhs)->array;\
+        for(size_t i = 0; i < len; i++) {\
+            array[i] = larray[i] OPERATOR rarray[i];\
+        }\
+    }\
+})
+
+#define FAST_ARITHMETIC_LOOP(results, uint8_out, dtype, lhs, rhs, OPERATOR)\
+({  if((dtype) == NDARRAY_UINT8) {\
+        FAST_BINARY_LOOP((results), uint8_out, uint8_t, (lhs), (rhs), OPERATOR);\
+    } else if((dtype) == NDARRAY_INT16) {\
+        FAST_BINARY_LOOP((results), int16_t, int16_t, (lhs), (rhs), OPERATOR);\
+    } else {\
+        FAST_BINARY_LOOP((results), mp_float_t, mp_float_t, (lhs), (rhs), OPERATOR);\
+    }\
+})
+
+#define FAST_COMPARISON_LOOP(results, dtype, lhs, rhs, OPERATOR)\
+({  if((dtype) == NDARRAY_UINT8) {\
+        FAST_BINARY_LOOP((results), uint8_t, uint8_t, (lhs), (rhs), OPERATOR);\
+    } else if((dtype) == NDARRAY_INT16) {\
+        FAST_BINARY_LOOP((results), uint8_t, int16_t, (lhs), (rhs), OPERATOR);\
+    } else {\
+        FAST_BINARY_LOOP((results), uint8_t, mp_float_t, (lhs), (rhs), OPERATOR);\
+    }\
+})
+#endif /* ULAB_HAS_FAST_PATHS */
+
 #define UNWRAP_INPLACE_OPERATOR(lhs, larray, rarray, rstrides, OPERATOR)\
 ({\
     if((lhs)->dtype == NDARRAY_UINT8) {\
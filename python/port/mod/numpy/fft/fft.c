@@ -0,0 +1,103 @@
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019-2021 Zoltán Vörös
+ *               2020 Scott Shawcroft for Adafruit Industries
+ *               2020 Taku Fukada
+ *
+ * Some minor changes were made by NumWorks team.
+*/
+
+#include <math.h>
+#include <string.h>
+#include "py/runtime.h"
+#include "py/builtin.h"
+#include "py/binary.h"
+#include "py/obj.h"
+#include "py/objarray.h"
+
+#include "fft.h"
+
+//| """Frequency-domain functions"""
+//|
+//| import ulab.numpy
+
+#if ULAB_NUMPY_HAS_FFT_MODULE
+
+#if ULAB_FFT_HAS_FFT || ULAB_FFT_HAS_IFFT
+static const mp_arg_t fft_allowed_args[] = {
+    { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    { MP_QSTR_, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+    { MP_QSTR_norm, MP_ARG_KW_ONLY | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_QSTR(MP_QSTR_backward) } },
+};
+
+static mp_obj_t fft_parse_and_transform(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args, uint8_t type) {
+    mp_arg_val_t args[MP_ARRAY_SIZE(fft_allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(fft_allowed_args), fft_allowed_args, args);
+    uint8_t norm = fft_norm_from_object(args[2].u_obj);
+    if(args[1].u_obj == mp_const_none) {
+        return fft_fft_ifft_spectrum(1, args[0].u_obj, mp_const_none, type, norm);
+    }
+    return fft_fft_ifft_spectrum(2, args[0].u_obj, args[1].u_obj, type, norm);
+}
+#endif
+
+//| def fft(r: ulab.numpy.ndarray, c: Optional[ulab.numpy.ndarray] = None, norm: str = "backward") -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|     """
+//|     :param ulab.numpy.ndarray r: A 1-dimension array of values whose size is a power of 2
+//|     :param ulab.numpy.ndarray c: An optional 1-dimension array of values whose size is a power of 2, giving the complex part of the value
+//|     :param str norm: "backward" (default), "ortho" or "forward", the scaling of the transform
+//|     :return tuple (r, c): The real and complex parts of the FFT
+//|
+//|     Perform a Fast Fourier Transform from the time domain into the frequency domain"""
+//|     ...
+//|
+#if ULAB_FFT_HAS_FFT
+static mp_obj_t fft_fft(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return fft_parse_and_transform(n_args, pos_args, kw_args, FFT_FFT);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(fft_fft_obj, 1, fft_fft);
+#endif
+
+//| def ifft(r: ulab.numpy.ndarray, c: Optional[ulab.numpy.ndarray] = None, norm: str = "backward") -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|     """
+//|     :param ulab.numpy.ndarray r: A 1-dimension array of values whose size is a power of 2
+//|     :param ulab.numpy.ndarray c: An optional 1-dimension array of values whose size is a power of 2, giving the complex part of the value
+//|     :param str norm: "backward" (default), "ortho" or "forward", the scaling of the transform
+//|     :return tuple (r, c): The real and complex parts of the inverse FFT
+//|
+//|     Perform an Inverse Fast Fourier Transform from the frequeny domain into the time domain"""
+//|     ...
+//|
+
+#if ULAB_FFT_HAS_IFFT
+static mp_obj_t fft_ifft(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    return fft_parse_and_transform(n_args, pos_args, kw_args, FFT_IFFT);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(fft_ifft_obj, 1, fft_ifft);
+#endif
+
+static const mp_rom_map_elem_t ulab_fft_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_fft) },
+    #if ULAB_FFT_HAS_FFT
+    { MP_ROM_QSTR(MP_QSTR_fft), MP_ROM_PTR(&fft_fft_obj) },
+    #endif
+    #if ULAB_FFT_HAS_IFFT
+    { MP_ROM_QSTR(MP_QSTR_ifft), MP_ROM_PTR(&fft_ifft_obj) },
+    #endif
+};
+
+static MP_DEFINE_CONST_DICT(mp_module_ulab_fft_globals, ulab_fft_globals_table);
+
+const mp_obj_module_t ulab_fft_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&mp_module_ulab_fft_globals,
+};
+
+#endif
@@ -0,0 +1,163 @@
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019-2021 Zoltán Vörös
+ *
+ * Some minor changes were made by NumWorks team.
+*/
+
+#include <math.h>
+#include <string.h>
+#include "py/runtime.h"
+
+#include "../../ndarray.h"
+#include "../../ulab_tools.h"
+#include "../carray/carray_tools.h"
+#include "fft_tools.h"
+
+/*
+ * The following function takes two arrays, namely, the real and imaginary
+ * parts of a complex array, and calculates the Fourier transform in place.
+ *
+ * The function is basically a modification of four1 from Numerical Recipes,
+ * has no dependencies beyond micropython itself (for the definition of mp_float_t),
+ * and can be used independent of ulab.
+ */
+
+void fft_kernel(mp_float_t *real, mp_float_t *imag, size_t n, int isign) {
+    // n must be a power of 2
+    // the elements are first put in bit-reversed order, so that the butterflies
+    // of each stage combine the halves of contiguous blocks
+    size_t j, m, mmax, istep;
+    mp_float_t tempr, tempi;
+    mp_float_t wtemp, wr, wpr, wpi, wi, theta;
+
+    j = 0;
+    for(size_t i = 0; i < n; i++) {
+        if (j > i) {
+            SWAP(mp_float_t, real[i], real[j]);
+            SWAP(mp_float_t, imag[i], imag[j]);
+        }
+        m = n >> 1;
+        while (j >= m && m > 0) {
+            j -= m;
+            m >>= 1;
+        }
+        j += m;
+    }
+
+    mmax = 1;
+    while (n > mmax) {
+        istep = mmax << 1;
+        theta = MICROPY_FLOAT_CONST(-2.0)*isign*MP_PI/istep;
+        // the twiddle factors are obtained by a recurrence, which needs a single
+        // sine and cosine per stage
+        wtemp = MICROPY_FLOAT_C_FUN(sin)(MICROPY_FLOAT_CONST(0.5) * theta);
+        wpr = MICROPY_FLOAT_CONST(-2.0) * wtemp * wtemp;
+        wpi = MICROPY_FLOAT_C_FUN(sin)(theta);
+        wr = MICROPY_FLOAT_CONST(1.0);
+        wi = MICROPY_FLOAT_CONST(0.0);
+        for(m = 0; m < mmax; m++) {
+            for(size_t i = m; i < n; i += istep) {
+                j = i + mmax;
+                tempr = wr * real[j] - wi * imag[j];
+                tempi = wr * imag[j] + wi * real[j];
+                real[j] = real[i] - tempr;
+                imag[j] = imag[i] - tempi;
+                real[i] += tempr;
+                imag[i] += tempi;
+            }
+            wtemp = wr;
+            wr = wr*wpr - wi*wpi + wr;
+            wi = wi*wpr + wtemp*wpi + wi;
+        }
+        mmax = istep;
+    }
+}
+
+static void fft_fill_array(mp_float_t *array, ndarray_obj_t *ndarray) {
+    // copies a one-dimensional array of any real dtype into array
+    mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
+    uint8_t *source = (uint8_t *)ndarray->array;
+    for(size_t i = 0; i < ndarray->len; i++) {
+        array[i] = func(source);
+        source += ndarray->strides[ULAB_MAX_DIMS - 1];
+    }
+}
+
+uint8_t fft_norm_from_object(mp_obj_t norm) {
+    const char *name = mp_obj_str_get_str(norm);
+    if(strcmp(name, "backward") == 0) {
+        return FFT_NORM_BACKWARD;
+    }
+    if(strcmp(name, "ortho") == 0) {
+        return FFT_NORM_ORTHO;
+    }
+    if(strcmp(name, "forward") != 0) {
+        mp_raise_ValueError(translate("norm must be backward, ortho, or forward"));
+    }
+    return FFT_NORM_FORWARD;
+}
+
+/*
+ * The real and imaginary parts of the transform are returned in a tuple.
+ * If a single argument is passed, its imaginary part is assumed to be zero.
+ * As in numpy, the backward norm scales the inverse transform by 1/n, the
+ * forward norm scales the direct transform by 1/n, and the ortho norm scales
+ * both by 1/sqrt(n).
+ */
+mp_obj_t fft_fft_ifft_spectrum(size_t n_args, mp_obj_t arg_re, mp_obj_t arg_im, uint8_t type, uint8_t norm) {
+    if(!mp_obj_is_type(arg_re, &ulab_ndarray_type)) {
+        mp_raise_NotImplementedError(translate("FFT is defined for ndarrays only"));
+    }
+    ndarray_obj_t *re = MP_OBJ_TO_PTR(arg_re);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(re->dtype)
+    if(re->ndim != 1) {
+        mp_raise_TypeError(translate("FFT is implemented for linear arrays only"));
+    }
+    size_t len = re->len;
+    // Check if input is of length of power of 2
+    if((len == 0) || ((len & (len - 1)) != 0)) {
+        mp_raise_ValueError(translate("input array length must be power of 2"));
+    }
+
+    ndarray_obj_t *out_re = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    mp_float_t *data_re = (mp_float_t *)out_re->array;
+    fft_fill_array(data_re, re);
+
+    ndarray_obj_t *out_im = ndarray_new_linear_array(len, NDARRAY_FLOAT);
+    mp_float_t *data_im = (mp_float_t *)out_im->array;
+    if(n_args == 2) {
+        if(!mp_obj_is_type(arg_im, &ulab_ndarray_type)) {
+            mp_raise_NotImplementedError(translate("FFT is defined for ndarrays only"));
+        }
+        ndarray_obj_t *im = MP_OBJ_TO_PTR(arg_im);
+        COMPLEX_DTYPE_NOT_IMPLEMENTED(im->dtype)
+        if((im->ndim != 1) || (im->len != len)) {
+            mp_raise_ValueError(translate("real and imaginary parts must be of equal length"));
+        }
+        fft_fill_array(data_im, im);
+    }
+
+    fft_kernel(data_re, data_im, len, type == FFT_FFT ? 1 : -1);
+    mp_float_t scale = MICROPY_FLOAT_CONST(1.0);
+    if(norm == FFT_NORM_ORTHO) {
+        scale = MICROPY_FLOAT_CONST(1.0) / MICROPY_FLOAT_C_FUN(sqrt)(len);
+    } else if((norm == FFT_NORM_BACKWARD) == (type == FFT_IFFT)) {
+        scale = MICROPY_FLOAT_CONST(1.0) / len;
+    }
+    if(scale != MICROPY_FLOAT_CONST(1.0)) {
+        for(size_t i = 0; i < len; i++) {
+            data_re[i] *= scale;
+            data_im[i] *= scale;
+        }
+    }
+    mp_obj_t tuple[2];
+    tuple[0] = MP_OBJ_FROM_PTR(out_re);
+    tuple[1] = MP_OBJ_FROM_PTR(out_im);
+    return mp_obj_new_tuple(2, tuple);
+}
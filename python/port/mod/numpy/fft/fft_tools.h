@@ -0,0 +1,32 @@
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019-2021 Zoltán Vörös
+*/
+
+#ifndef _FFT_TOOLS_
+#define _FFT_TOOLS_
+
+#include "../../ulab.h"
+
+enum FFT_TYPE {
+    FFT_FFT,
+    FFT_IFFT,
+};
+
+// which of the transforms is scaled, as given by the norm keyword argument
+enum FFT_NORM {
+    FFT_NORM_BACKWARD,
+    FFT_NORM_ORTHO,
+    FFT_NORM_FORWARD,
+};
+
+void fft_kernel(mp_float_t *, mp_float_t *, size_t , int );
+uint8_t fft_norm_from_object(mp_obj_t );
+mp_obj_t fft_fft_ifft_spectrum(size_t , mp_obj_t , mp_obj_t , uint8_t , uint8_t );
+
+#endif /* _FFT_TOOLS_ */
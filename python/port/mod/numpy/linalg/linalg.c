@@ -0,0 +1,305 @@
+/*
+ * This file is part of the micropython-ulab project,
+ *
+ * https://github.com/v923z/micropython-ulab
+ *
+ * The MIT License (MIT)
+ *
+ * Copyright (c) 2019-2021 Zoltán Vörös
+ *
+ * Some minor changes were made by NumWorks team.
+*/
+
+#include <math.h>
+#include <string.h>
+#include "py/obj.h"
+#include "py/runtime.h"
+#include "py/misc.h"
+
+#include "../../ulab.h"
+#include "../../ulab_tools.h"
+#include "../carray/carray_tools.h"
+#include "linalg.h"
+
+#if ULAB_NUMPY_HAS_LINALG_MODULE
+//|
+//| import ulab.numpy
+//|
+//| """Linear algebra functions"""
+//|
+
+#if ULAB_MAX_DIMS > 1
+static ndarray_obj_t *linalg_object_to_float_matrix(mp_obj_t oin, bool square) {
+    // returns a dense float copy of the two-dimensional ndarray, which the kernels
+    // of linalg_tools work on in place
+    if(!mp_obj_is_type(oin, &ulab_ndarray_type)) {
+        mp_raise_TypeError(translate("function is defined for ndarrays only"));
+    }
+    ndarray_obj_t *ndarray = MP_OBJ_TO_PTR(oin);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    if(square) {
+        tools_object_is_square(oin);
+    } else if(ndarray->ndim != 2) {
+        mp_raise_ValueError(translate("operation is defined for 2D arrays only"));
+    }
+    if(ndarray->len == 0) {
+        mp_raise_ValueError(translate("operation is not implemented on empty arrays"));
+    }
+    return ndarray_copy_view_convert_type(ndarray, NDARRAY_FLOAT);
+}
+
+static ndarray_obj_t *linalg_new_matrix(size_t M, size_t N) {
+    size_t *shape = m_new0(size_t, ULAB_MAX_DIMS);
+    shape[ULAB_MAX_DIMS - 2] = M;
+    shape[ULAB_MAX_DIMS - 1] = N;
+    return ndarray_new_dense_ndarray(2, shape, NDARRAY_FLOAT);
+}
+
+static void linalg_check_symmetric(mp_float_t *array, size_t N) {
+    for(size_t m=0; m < N; m++) {
+        for(size_t n=m+1; n < N; n++) {
+            if(MICROPY_FLOAT_C_FUN(fabs)(array[m * N + n] - array[n * N + m]) > LINALG_EPSILON) {
+                mp_raise_ValueError(translate("input matrix is asymmetric"));
+            }
+        }
+    }
+}
+
+#if ULAB_LINALG_HAS_CHOLESKY
+
+//| def cholesky(A: ulab.numpy.ndarray) -> ulab.numpy.ndarray:
+//|     """
+//|     :param ~ulab.numpy.ndarray A: a positive definite, symmetric square matrix
+//|     :return ~ulab.numpy.ndarray L: a square root matrix in the lower triangular form
+//|     :raises ValueError: If the input does not fulfill the necessary conditions
+//|
+//|     The returned matrix satisfies the equation m=LL*"""
+//|     ...
+//|
+
+static mp_obj_t linalg_cholesky(mp_obj_t oin) {
+    ndarray_obj_t *L = linalg_object_to_float_matrix(oin, true);
+    mp_float_t *array = (mp_float_t *)L->array;
+    size_t N = L->shape[ULAB_MAX_DIMS - 1];
+    linalg_check_symmetric(array, N);
+    if(!linalg_cholesky_decompose(array, N)) {
+        mp_raise_ValueError(translate("matrix is not positive definite"));
+    }
+    return MP_OBJ_FROM_PTR(L);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(linalg_cholesky_obj, linalg_cholesky);
+#endif
+
+#if ULAB_LINALG_HAS_DET
+
+//| def det(m: ulab.numpy.ndarray) -> float:
+//|     """
+//|     :param: m, a square matrix
+//|     :return float: The determinant of the matrix
+//|
+//|     Computes the determinant of a square matrix from its LU decomposition"""
+//|     ...
+//|
+
+static mp_obj_t linalg_det(mp_obj_t oin) {
+    ndarray_obj_t *ndarray = linalg_object_to_float_matrix(oin, true);
+    mp_float_t *array = (mp_float_t *)ndarray->array;
+    size_t N = ndarray->shape[ULAB_MAX_DIMS - 1];
+    size_t *pivots = m_new(size_t, N);
+    int8_t sign;
+    mp_float_t det = MICROPY_FLOAT_CONST(0.0);
+    if(linalg_lu_decompose(array, pivots, N, &sign)) {
+        // the determinant of L is 1
+        det = sign;
+        for(size_t m=0; m < N; m++) {
+            det *= array[m * (N+1)];
+        }
+    }
+    m_del(size_t, pivots, N);
+    return mp_obj_new_float(det);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(linalg_det_obj, linalg_det);
+#endif
+
+#if ULAB_LINALG_HAS_EIG
+
+//| def eig(m: ulab.numpy.ndarray) -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|     """
+//|     :param m: a square matrix
+//|     :return tuple (eigenvectors, eigenvalues):
+//|
+//|     Computes the eigenvalues and eigenvectors of a square matrix"""
+//|     ...
+//|
+
+static mp_obj_t linalg_eig(mp_obj_t oin) {
+    ndarray_obj_t *ndarray = linalg_object_to_float_matrix(oin, true);
+    mp_float_t *array = (mp_float_t *)ndarray->array;
+    size_t S = ndarray->shape[ULAB_MAX_DIMS - 1];
+    linalg_check_symmetric(array, S);
+
+    ndarray_obj_t *eigenvectors = linalg_new_matrix(S, S);
+    mp_float_t *eigvectors = (mp_float_t *)eigenvectors->array;
+
+    size_t iterations = linalg_jacobi_rotations(array, eigvectors, S);
+
+    if(iterations == 0) {
+        // the computation did not converge; numpy raises LinAlgError
+        mp_raise_ValueError(translate("iterations did not converge"));
+    }
+    ndarray_obj_t *eigenvalues = ndarray_new_linear_array(S, NDARRAY_FLOAT);
+    mp_float_t *eigvalues = (mp_float_t *)eigenvalues->array;
+    for(size_t i=0; i < S; i++) {
+        eigvalues[i] = array[i * (S + 1)];
+    }
+
+    mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(2, NULL));
+    tuple->items[0] = MP_OBJ_FROM_PTR(eigenvalues);
+    tuple->items[1] = MP_OBJ_FROM_PTR(eigenvectors);
+    return MP_OBJ_FROM_PTR(tuple);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(linalg_eig_obj, linalg_eig);
+#endif
+
+#if ULAB_LINALG_HAS_INV
+//| def inv(m: ulab.numpy.ndarray) -> ulab.numpy.ndarray:
+//|     """
+//|     :param ~ulab.numpy.ndarray m: a square matrix
+//|     :return: The inverse of the matrix, if it exists
+//|     :raises ValueError: if the matrix is not invertible
+//|
+//|     Computes the inverse of a square matrix"""
+//|     ...
+//|
+static mp_obj_t linalg_inv(mp_obj_t oin) {
+    ndarray_obj_t *inverted = linalg_object_to_float_matrix(oin, true);
+    mp_float_t *array = (mp_float_t *)inverted->array;
+    if(!linalg_invert_matrix(array, inverted->shape[ULAB_MAX_DIMS - 1])) {
+        mp_raise_ValueError(translate("input matrix is singular"));
+    }
+    return MP_OBJ_FROM_PTR(inverted);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(linalg_inv_obj, linalg_inv);
+#endif
+
+#if ULAB_LINALG_HAS_QR
+//| def qr(m: ulab.numpy.ndarray, mode: str = "reduced") -> Tuple[ulab.numpy.ndarray, ulab.numpy.ndarray]:
+//|     """
+//|     :param m: a matrix
+//|     :param mode: "reduced" (default) or "complete"
+//|     :return tuple (Q, R):
+//|
+//|     Factor a matrix into an orthogonal matrix Q, and an upper triangular matrix R"""
+//|     ...
+//|
+
+static mp_obj_t linalg_qr(size_t n_args, const mp_obj_t *pos_args, mp_map_t *kw_args) {
+    static const mp_arg_t allowed_args[] = {
+        { MP_QSTR_, MP_ARG_REQUIRED | MP_ARG_OBJ, { .u_rom_obj = MP_ROM_NONE } },
+        { MP_QSTR_mode, MP_ARG_OBJ, { .u_rom_obj = MP_ROM_QSTR(MP_QSTR_reduced) } },
+    };
+
+    mp_arg_val_t args[MP_ARRAY_SIZE(allowed_args)];
+    mp_arg_parse_all(n_args, pos_args, kw_args, MP_ARRAY_SIZE(allowed_args), allowed_args, args);
+
+    const char *mode = mp_obj_str_get_str(args[1].u_obj);
+    bool complete = strcmp(mode, "complete") == 0;
+    if(!complete && (strcmp(mode, "reduced") != 0)) {
+        mp_raise_ValueError(translate("mode must be complete, or reduced"));
+    }
+
+    ndarray_obj_t *R = linalg_object_to_float_matrix(args[0].u_obj, false);
+    size_t M = R->shape[ULAB_MAX_DIMS - 2];
+    size_t N = R->shape[ULAB_MAX_DIMS - 1];
+    ndarray_obj_t *Q = linalg_new_matrix(M, M);
+    linalg_qr_decompose((mp_float_t *)R->array, (mp_float_t *)Q->array, M, N);
+
+    mp_obj_tuple_t *tuple = MP_OBJ_TO_PTR(mp_obj_new_tuple(2, NULL));
+    size_t K = M < N ? M : N;
+    if(complete || (K == M)) {
+        tuple->items[0] = MP_OBJ_FROM_PTR(Q);
+        tuple->items[1] = MP_OBJ_FROM_PTR(R);
+    } else {
+        // the reduced decomposition keeps the first N columns of Q, and the first N rows of R
+        ndarray_obj_t *q = linalg_new_matrix(M, K);
+        mp_float_t *qarray = (mp_float_t *)q->array;
+        mp_float_t *Qarray = (mp_float_t *)Q->array;
+        for(size_t m=0; m < M; m++) {
+            memcpy(&qarray[m * K], &Qarray[m * M], K * sizeof(mp_float_t));
+        }
+        ndarray_obj_t *r = linalg_new_matrix(K, N);
+        memcpy(r->array, R->array, K * N * sizeof(mp_float_t));
+        tuple->items[0] = MP_OBJ_FROM_PTR(q);
+        tuple->items[1] = MP_OBJ_FROM_PTR(r);
+    }
+    return MP_OBJ_FROM_PTR(tuple);
+}
+
+MP_DEFINE_CONST_FUN_OBJ_KW(linalg_qr_obj, 1, linalg_qr);
+#endif
+#endif /* ULAB_MAX_DIMS > 1 */
+
+#if ULAB_LINALG_HAS_NORM
+
+//| def norm(x: ulab.numpy.ndarray) -> float:
+//|     """
+//|     :param ~ulab.numpy.ndarray x: a vector or a matrix
+//|
+//|     Computes the 2-norm of a vector, or the Frobenius norm of a matrix"""
+//|     ...
+//|
+
+static mp_obj_t linalg_norm(mp_obj_t oin) {
+    if(!ndarray_object_is_array_like(oin)) {
+        mp_raise_TypeError(translate("argument must be an ndarray"));
+    }
+    ndarray_obj_t *ndarray = ndarray_from_mp_obj(oin, 0);
+    COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
+    ndarray = ndarray_copy_view_convert_type(ndarray, NDARRAY_FLOAT);
+    mp_float_t *array = (mp_float_t *)ndarray->array;
+    mp_float_t sum = MICROPY_FLOAT_CONST(0.0);
+    for(size_t i=0; i < ndarray->len; i++) {
+        sum += array[i] * array[i];
+    }
+    return mp_obj_new_float(MICROPY_FLOAT_C_FUN(sqrt)(sum));
+}
+
+MP_DEFINE_CONST_FUN_OBJ_1(linalg_norm_obj, linalg_norm);
+#endif
+
+static const mp_rom_map_elem_t ulab_linalg_globals_table[] = {
+    { MP_ROM_QSTR(MP_QSTR___name__), MP_ROM_QSTR(MP_QSTR_linalg) },
+    #if ULAB_MAX_DIMS > 1
+        #if ULAB_LINALG_HAS_CHOLESKY
+        { MP_ROM_QSTR(MP_QSTR_cholesky), MP_ROM_PTR(&linalg_cholesky_obj) },
+        #endif
+        #if ULAB_LINALG_HAS_DET
+        { MP_ROM_QSTR(MP_QSTR_det), MP_ROM_PTR(&linalg_det_obj) },
+        #endif
+        #if ULAB_LINALG_HAS_EIG
+        { MP_ROM_QSTR(MP_QSTR_eig), MP_ROM_PTR(&linalg_eig_obj) },
+        #endif
+        #if ULAB_LINALG_HAS_INV
+        { MP_ROM_QSTR(MP_QSTR_inv), MP_ROM_PTR(&linalg_inv_obj) },
+        #endif
+        #if ULAB_LINALG_HAS_QR
+        { MP_ROM_QSTR(MP_QSTR_qr), MP_ROM_PTR(&linalg_qr_obj) },
+        #endif
+    #endif
+    #if ULAB_LINALG_HAS_NORM
+        { MP_ROM_QSTR(MP_QSTR_norm), MP_ROM_PTR(&linalg_norm_obj) },
+    #endif
+};
+
+static MP_DEFINE_CONST_DICT(mp_module_ulab_linalg_globals, ulab_linalg_globals_table);
+
+const mp_obj_module_t ulab_linalg_module = {
+    .base = { &mp_type_module },
+    .globals = (mp_obj_dict_t*)&mp_module_ulab_linalg_globals,
+};
+
+#endif
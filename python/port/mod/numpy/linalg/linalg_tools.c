@@ -15,68 +15,208 @@
 #include "linalg_tools.h"
 
 /*
- * The following function inverts a matrix, whose entries are given in the input array
- * The function has no dependencies beyond micropython itself (for the definition of mp_float_t),
- * and can be used independent of ulab.
+ * The following functions work on dense, row-major matrices, whose entries are given
+ * in the input array. The innermost loops run along the rows, so that the entries
+ * are accessed in the order of memory. The functions have no dependencies beyond
+ * micropython itself (for the definition of mp_float_t), and can be used independent
+ * of ulab.
  */
 
+bool linalg_lu_decompose(mp_float_t *data, size_t *pivots, size_t N, int8_t *sign) {
+    // decomposes the matrix in place into L, with an implicit unit diagonal, below
+    // the diagonal, and U on, and above the diagonal, with partial pivoting
+    // the ith row of LU is the pivots[i]th row of the input
+    // returns false, if the matrix is singular
+    // a pivot is zero, if it is small compared to the infinity norm of the matrix,
+    // so that the test does not depend on the scale of the entries
+    mp_float_t matrix_norm = MICROPY_FLOAT_CONST(0.0);
+    for(size_t m=0; m < N; m++) {
+        mp_float_t row_sum = MICROPY_FLOAT_CONST(0.0);
+        for(size_t n=0; n < N; n++) {
+            row_sum += MICROPY_FLOAT_C_FUN(fabs)(data[m * N + n]);
+        }
+        if(row_sum > matrix_norm) {
+            matrix_norm = row_sum;
+        }
+    }
+    mp_float_t tolerance = N * LINALG_EPSILON * matrix_norm;
+    for(size_t m=0; m < N; m++) {
+        pivots[m] = m;
+    }
+    *sign = 1;
+    for(size_t k=0; k < N; k++) {
+        // the largest entry of the column is the pivot
+        size_t p = k;
+        mp_float_t largest = MICROPY_FLOAT_C_FUN(fabs)(data[k * (N+1)]);
+        for(size_t m=k+1; m < N; m++) {
+            mp_float_t value = MICROPY_FLOAT_C_FUN(fabs)(data[m * N + k]);
+            if(value > largest) {
+                largest = value;
+                p = m;
+            }
+        }
+        if(largest <= tolerance) {
+            return false;
+        }
+        if(p != k) {
+            for(size_t n=0; n < N; n++) {
+                mp_float_t swapVal = data[k * N + n];
+                data[k * N + n] = data[p * N + n];
+                data[p * N + n] = swapVal;
+            }
+            size_t swapIndex = pivots[k];
+            pivots[k] = pivots[p];
+            pivots[p] = swapIndex;
+            *sign = -*sign;
+        }
+        mp_float_t *pivot_row = &data[k * N];
+        for(size_t m=k+1; m < N; m++) {
+            mp_float_t *row = &data[m * N];
+            mp_float_t factor = row[k] / pivot_row[k];
+            row[k] = factor;
+            for(size_t n=k+1; n < N; n++) {
+                row[n] -= factor * pivot_row[n];
+            }
+        }
+    }
+    return true;
+}
+
 bool linalg_invert_matrix(mp_float_t *data, size_t N) {
     // returns true, of the inversion was successful,
     // false, if the matrix is singular
 
-    // initially, this is the unit matrix: the contents of this matrix is what
-    // will be returned after all the transformations
-    mp_float_t *unit = m_new0(mp_float_t, N*N);
-    mp_float_t elem = 1.0;
-
+    size_t *pivots = m_new(size_t, N);
+    int8_t sign;
+    if(!linalg_lu_decompose(data, pivots, N, &sign)) {
+        m_del(size_t, pivots, N);
+        return false;
+    }
+    // the inverse is the solution of LU X = P, where P is the permuted unit matrix
+    // all columns are solved for at the same time, so that the loops run along the rows
+    mp_float_t *inverse = m_new0(mp_float_t, N*N);
     for(size_t m=0; m < N; m++) {
-        memcpy(&unit[m * (N+1)], &elem, sizeof(mp_float_t));
+        inverse[m * N + pivots[m]] = MICROPY_FLOAT_CONST(1.0);
     }
-    for(size_t m=0; m < N; m++){
-        // this could be faster with ((c < epsilon) && (c > -epsilon))
-        if(MICROPY_FLOAT_C_FUN(fabs)(data[m * (N+1)]) < LINALG_EPSILON) {
-            //look for a line to swap
-            size_t m1 = m + 1;
-            for(; m1 < N; m1++) {
-                if(!(MICROPY_FLOAT_C_FUN(fabs)(data[m1*N + m]) < LINALG_EPSILON)) {
-                    for(size_t m2=0; m2 < N; m2++) {
-                        mp_float_t swapVal = data[m*N+m2];
-                        data[m*N+m2] = data[m1*N+m2];
-                        data[m1*N+m2] = swapVal;
-                        swapVal = unit[m*N+m2];
-                        unit[m*N+m2] = unit[m1*N+m2];
-                        unit[m1*N+m2] = swapVal;
-                    }
-                    break;
-                }
+    m_del(size_t, pivots, N);
+    for(size_t m=1; m < N; m++) {
+        for(size_t k=0; k < m; k++) {
+            mp_float_t factor = data[m * N + k];
+            for(size_t n=0; n < N; n++) {
+                inverse[m * N + n] -= factor * inverse[k * N + n];
             }
-            if (m1 >= N) {
-                m_del(mp_float_t, unit, N*N);
-                return false;
+        }
+    }
+    for(size_t m=N; m > 0; m--) {
+        mp_float_t *row = &inverse[(m-1) * N];
+        for(size_t k=m; k < N; k++) {
+            mp_float_t factor = data[(m-1) * N + k];
+            for(size_t n=0; n < N; n++) {
+                row[n] -= factor * inverse[k * N + n];
             }
         }
+        mp_float_t diagonal = data[(m-1) * (N+1)];
         for(size_t n=0; n < N; n++) {
-            if(m != n){
-                elem = data[N * n + m] / data[m * (N+1)];
-                for(size_t k=0; k < N; k++) {
-                    data[N * n + k] -= elem * data[N * m + k];
-                    unit[N * n + k] -= elem * unit[N * m + k];
-                }
-            }
+            row[n] /= diagonal;
         }
     }
+    memcpy(data, inverse, sizeof(mp_float_t)*N*N);
+    m_del(mp_float_t, inverse, N*N);
+    return true;
+}
+
+bool linalg_cholesky_decompose(mp_float_t *data, size_t N) {
+    // replaces the symmetric matrix by L, such that the matrix is L L^T
+    // the entries above the diagonal are set to zero
+    // returns false, if the matrix is not positive definite
     for(size_t m=0; m < N; m++) {
-        elem = data[m * (N+1)];
-        for(size_t n=0; n < N; n++) {
-            data[N * m + n] /= elem;
-            unit[N * m + n] /= elem;
+        mp_float_t *row = &data[m * N];
+        for(size_t n=0; n <= m; n++) {
+            mp_float_t *other = &data[n * N];
+            mp_float_t sum = row[n];
+            for(size_t k=0; k < n; k++) {
+                sum -= row[k] * other[k];
+            }
+            if(m == n) {
+                if(sum <= MICROPY_FLOAT_CONST(0.0)) {
+                    return false;
+                }
+                row[m] = MICROPY_FLOAT_C_FUN(sqrt)(sum);
+            } else {
+                row[n] = sum / other[n];
+            }
+        }
+        for(size_t n=m+1; n < N; n++) {
+            row[n] = MICROPY_FLOAT_CONST(0.0);
         }
     }
-    memcpy(data, unit, sizeof(mp_float_t)*N*N);
-    m_del(mp_float_t, unit, N * N);
     return true;
 }
 
+void linalg_qr_decompose(mp_float_t *r, mp_float_t *q, size_t M, size_t N) {
+    // decomposes the M by N matrix r in place into the upper triangle R, and the
+    // M by M orthogonal matrix q, by means of Householder reflections
+    mp_float_t *v = m_new(mp_float_t, M);
+    mp_float_t *w = m_new(mp_float_t, N);
+    memset(q, 0, sizeof(mp_float_t)*M*M);
+    for(size_t m=0; m < M; m++) {
+        q[m * (M+1)] = MICROPY_FLOAT_CONST(1.0);
+    }
+    size_t K = M - 1 < N ? M - 1 : N;
+    for(size_t k=0; k < K; k++) {
+        // the reflection maps the column below the diagonal onto the diagonal
+        mp_float_t norm = MICROPY_FLOAT_CONST(0.0);
+        for(size_t m=k; m < M; m++) {
+            v[m] = r[m * N + k];
+            norm += v[m] * v[m];
+        }
+        norm = MICROPY_FLOAT_C_FUN(sqrt)(norm);
+        if(norm < LINALG_EPSILON) {
+            continue;
+        }
+        // the sign avoids cancellations
+        v[k] += v[k] < MICROPY_FLOAT_CONST(0.0) ? -norm : norm;
+        mp_float_t vnorm = MICROPY_FLOAT_CONST(0.0);
+        for(size_t m=k; m < M; m++) {
+            vnorm += v[m] * v[m];
+        }
+        vnorm = MICROPY_FLOAT_C_FUN(sqrt)(vnorm);
+        for(size_t m=k; m < M; m++) {
+            v[m] /= vnorm;
+        }
+        // r = (1 - 2 v v^T) r, with w = v^T r accumulated row by row
+        memset(w, 0, sizeof(mp_float_t)*N);
+        for(size_t m=k; m < M; m++) {
+            for(size_t n=k; n < N; n++) {
+                w[n] += v[m] * r[m * N + n];
+            }
+        }
+        for(size_t m=k; m < M; m++) {
+            mp_float_t factor = MICROPY_FLOAT_CONST(2.0) * v[m];
+            for(size_t n=k; n < N; n++) {
+                r[m * N + n] -= factor * w[n];
+            }
+        }
+        // q = q (1 - 2 v v^T)
+        for(size_t m=0; m < M; m++) {
+            mp_float_t *row = &q[m * M];
+            mp_float_t dot = MICROPY_FLOAT_CONST(0.0);
+            for(size_t n=k; n < M; n++) {
+                dot += row[n] * v[n];
+            }
+            dot *= MICROPY_FLOAT_CONST(2.0);
+            for(size_t n=k; n < M; n++) {
+                row[n] -= dot * v[n];
+            }
+        }
+        for(size_t m=k+1; m < M; m++) {
+            r[m * N + k] = MICROPY_FLOAT_CONST(0.0);
+        }
+    }
+    m_del(mp_float_t, w, N);
+    m_del(mp_float_t, v, M);
+}
+
 /*
  * The following function calculates the eigenvalues and eigenvectors of a symmetric
  * real matrix, whose entries are given in the input array.
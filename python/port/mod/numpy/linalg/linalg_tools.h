@@ -21,7 +21,10 @@
 
 #define JACOBI_MAX     20
 
+bool linalg_lu_decompose(mp_float_t *, size_t *, size_t , int8_t *);
 bool linalg_invert_matrix(mp_float_t *, size_t );
+bool linalg_cholesky_decompose(mp_float_t *, size_t );
+void linalg_qr_decompose(mp_float_t *, mp_float_t *, size_t , size_t );
 size_t linalg_jacobi_rotations(mp_float_t *, mp_float_t *, size_t );
 
 #endif /* _TOOLS_TOOLS_ */
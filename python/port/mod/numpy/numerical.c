@@ -274,6 +274,49 @@ static mp_obj_t numerical_sum_mean_std_iterable(mp_obj_t oin, uint8_t optype, si
     }
 }
 
+#if ULAB_HAS_FAST_PATHS
+static mp_obj_t numerical_sum_mean_std_contiguous(ndarray_obj_t *ndarray, uint8_t optype, size_t ddof) {
+    // the standard deviation takes a second pass, over the deviations from the mean
+    mp_float_t sum;
+    if(ndarray->dtype == NDARRAY_UINT8) {
+        FAST_SUM(uint8_t, ndarray, sum);
+    } else if(ndarray->dtype == NDARRAY_INT8) {
+        FAST_SUM(int8_t, ndarray, sum);
+    } else if(ndarray->dtype == NDARRAY_UINT16) {
+        FAST_SUM(uint16_t, ndarray, sum);
+    } else if(ndarray->dtype == NDARRAY_INT16) {
+        FAST_SUM(int16_t, ndarray, sum);
+    } else {
+        FAST_SUM(mp_float_t, ndarray, sum);
+    }
+    if(optype == NUMERICAL_SUM) {
+        // numpy returns an integer for integer input types
+        if(ndarray->dtype == NDARRAY_FLOAT) {
+            return mp_obj_new_float(sum);
+        } else {
+            return mp_obj_new_int((int32_t)MICROPY_FLOAT_C_FUN(round)(sum));
+        }
+    }
+    mp_float_t mean = sum / ndarray->len;
+    if(optype == NUMERICAL_MEAN) {
+        return mp_obj_new_float(mean);
+    }
+    mp_float_t squares;
+    if(ndarray->dtype == NDARRAY_UINT8) {
+        FAST_SQUARED_DEVIATIONS(uint8_t, ndarray, mean, squares);
+    } else if(ndarray->dtype == NDARRAY_INT8) {
+        FAST_SQUARED_DEVIATIONS(int8_t, ndarray, mean, squares);
+    } else if(ndarray->dtype == NDARRAY_UINT16) {
+        FAST_SQUARED_DEVIATIONS(uint16_t, ndarray, mean, squares);
+    } else if(ndarray->dtype == NDARRAY_INT16) {
+        FAST_SQUARED_DEVIATIONS(int16_t, ndarray, mean, squares);
+    } else {
+        FAST_SQUARED_DEVIATIONS(mp_float_t, ndarray, mean, squares);
+    }
+    return mp_obj_new_float(MICROPY_FLOAT_C_FUN(sqrt)(squares / (ndarray->len - ddof)));
+}
+#endif /* ULAB_HAS_FAST_PATHS */
+
 static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t axis, uint8_t optype, size_t ddof) {
     COMPLEX_DTYPE_NOT_IMPLEMENTED(ndarray->dtype)
     uint8_t *array = (uint8_t *)ndarray->array;
@@ -285,6 +328,11 @@ static mp_obj_t numerical_sum_mean_std_ndarray(ndarray_obj_t *ndarray, mp_obj_t
             // if there are too many degrees of freedom, there is no point in calculating anything
             return mp_obj_new_float(MICROPY_FLOAT_CONST(0.0));
         }
+        #if ULAB_HAS_FAST_PATHS
+        if((ndarray->len > 0) && ndarray_is_contiguous(ndarray)) {
+            return numerical_sum_mean_std_contiguous(ndarray, optype, ddof);
+        }
+        #endif
         mp_float_t (*func)(void *) = ndarray_get_float_function(ndarray->dtype);
         mp_float_t M = MICROPY_FLOAT_CONST(0.0);
         mp_float_t m = MICROPY_FLOAT_CONST(0.0);
@@ -631,6 +631,41 @@
 } while(0)
 
 #endif
+#if ULAB_HAS_FAST_PATHS
+// The elements of a contiguous array are accumulated in four independent partial
+// sums, so that the additions do not have to wait for each other
+#define FAST_SUM(type, ndarray, sum)\
+({  type *_array = (type *)(ndarray)->array;\
+    mp_float_t partial[4] = { MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(0.0) };\
+    size_t i = 0;\
+    for(; i + 4 <= (ndarray)->len; i += 4) {\
+        for(uint8_t j = 0; j < 4; j++) {\
+            partial[j] += (mp_float_t)_array[i + j];\
+        }\
+    }\
+    for(; i < (ndarray)->len; i++) {\
+        partial[0] += (mp_float_t)_array[i];\
+    }\
+    (sum) = (partial[0] + partial[1]) + (partial[2] + partial[3]);\
+})
+
+#define FAST_SQUARED_DEVIATIONS(type, ndarray, mean, sum)\
+({  type *_array = (type *)(ndarray)->array;\
+    mp_float_t partial[4] = { MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(0.0), MICROPY_FLOAT_CONST(0.0) };\
+    size_t i = 0;\
+    for(; i + 4 <= (ndarray)->len; i += 4) {\
+        for(uint8_t j = 0; j < 4; j++) {\
+            mp_float_t deviation = (mp_float_t)_array[i + j] - (mean);\
+            partial[j] += deviation * deviation;\
+        }\
+    }\
+    for(; i < (ndarray)->len; i++) {\
+        mp_float_t deviation = (mp_float_t)_array[i] - (mean);\
+        partial[0] += deviation * deviation;\
+    }\
+    (sum) = (partial[0] + partial[1]) + (partial[2] + partial[3]);\
+})
+#endif /* ULAB_HAS_FAST_PATHS */
 
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_all_obj);
 MP_DECLARE_CONST_FUN_OBJ_KW(numerical_any_obj);
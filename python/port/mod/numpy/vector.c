@@ -45,6 +45,17 @@ static mp_obj_t vector_generic_vector(mp_obj_t o_in, mp_float_t (*f)(mp_float_t)
         ndarray = ndarray_new_dense_ndarray(source->ndim, source->shape, NDARRAY_FLOAT);
         mp_float_t *array = (mp_float_t *)ndarray->array;
 
+        #if ULAB_HAS_FAST_PATHS
+        if((source->dtype == NDARRAY_FLOAT) && ndarray_is_contiguous(source)) {
+            // no conversion, and no strides
+            mp_float_t *farray = (mp_float_t *)source->array;
+            for(size_t i = 0; i < source->len; i++) {
+                array[i] = f(farray[i]);
+            }
+            return MP_OBJ_FROM_PTR(ndarray);
+        }
+        #endif
+
         #if ULAB_VECTORISE_USES_FUN_POINTER
 
             mp_float_t (*func)(void *) = ndarray_get_float_function(source->dtype);
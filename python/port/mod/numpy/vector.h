@@ -66,7 +66,7 @@ typedef struct _vectorized_function_obj_t {
             (array) += (shift);\
             (sarray) += (source)->strides[ULAB_MAX_DIMS - 1];\
         }\
-        ndarray_rewind_array((source)->ndim, sarray, (source)->shape, (source)->strides, scoords);\
+        sarray = ndarray_rewind_array((source)->ndim, sarray, (source)->shape, (source)->strides, scoords);\
     }\
 })
 
@@ -6,11 +6,14 @@ extern "C" {
 #include <py/runtime.h>
 }
 #include <kandinsky/ion_context.h>
+#include <omg/instance_local.h>
+
+#include <algorithm>
 
 #include "../../port.h"
 #include "turtle.h"
 
-static Turtle sTurtle;
+static OMG_INSTANCE_LOCAL Turtle sTurtle;
 
 void modturtle_gc_collect() {
   // Mark the shared sTurtle object as a GC root
@@ -19,6 +22,8 @@ void modturtle_gc_collect() {
 
 void modturtle_view_did_disappear() { sTurtle.viewDidDisappear(); }
 
+void modturtle_end_run(bool succeeded) { sTurtle.endRun(succeeded); }
+
 mp_obj_t modturtle___init__() {
   sTurtle = Turtle();
   /* Note: we don't even bother writing a destructor for Turtle because this
@@ -202,6 +207,24 @@ mp_obj_t modturtle_isvisible() {
   return sTurtle.isVisible() ? mp_const_true : mp_const_false;
 }
 
+mp_obj_t modturtle_tracer(size_t n_args, const mp_obj_t *args) {
+  if (n_args == 0) {
+    return MP_OBJ_NEW_SMALL_INT(sTurtle.tracer());
+  }
+  mp_int_t n = mp_obj_get_int(args[0]);
+  if (n < 0) {
+    mp_raise_ValueError("tracer() takes a non-negative integer");
+    return mp_const_none;
+  }
+  sTurtle.setTracer(std::min<mp_int_t>(n, UINT16_MAX));
+  return mp_const_none;
+}
+
+mp_obj_t modturtle_update() {
+  sTurtle.update();
+  return mp_const_none;
+}
+
 mp_obj_t modturtle_write(mp_obj_t s) {
   const char *string = mp_obj_str_get_str(s);
   sTurtle.write(string);
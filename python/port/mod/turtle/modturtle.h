@@ -3,6 +3,7 @@
 mp_obj_t modturtle___init__();
 void modturtle_gc_collect();
 void modturtle_view_did_disappear();
+void modturtle_end_run(bool succeeded);
 
 mp_obj_t modturtle_reset();
 
@@ -30,3 +31,6 @@ mp_obj_t modturtle_colormode(size_t n_args, const mp_obj_t *args);
 
 mp_obj_t modturtle_showturtle();
 mp_obj_t modturtle_hideturtle();
+
+mp_obj_t modturtle_tracer(size_t n_args, const mp_obj_t *args);
+mp_obj_t modturtle_update();
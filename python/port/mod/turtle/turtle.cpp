@@ -3,6 +3,7 @@
 #include <escher/palette.h>
 #include <kandinsky/ion_context.h>
 
+#include <algorithm>
 #include <cmath>
 extern "C" {
 #include <py/misc.h>
@@ -12,6 +13,32 @@ extern "C" {
 
 static inline mp_float_t absF(mp_float_t x) { return x >= 0 ? x : -x; }
 
+/* Intersect [*left, *right] with the solutions of lo <= a * x <= hi. Returns
+ * false if the intersection is empty. */
+static bool intersectSpan(float a, float lo, float hi, float* left,
+                          float* right) {
+  if (a == 0) {
+    return lo <= 0 && 0 <= hi;
+  }
+  float first = (a > 0 ? lo : hi) / a;
+  float last = (a > 0 ? hi : lo) / a;
+  *left = std::max(*left, first);
+  *right = std::min(*right, last);
+  return *left <= *right;
+}
+
+// Widen [*left, *right] to the chord of the disk on the horizontal line y
+static void addDiskSpan(float cx, float cy, float radius, float y, float* left,
+                        float* right) {
+  float h = y - cy;
+  if (h * h > radius * radius) {
+    return;
+  }
+  float w = std::sqrt(radius * radius - h * h);
+  *left = std::min(*left, cx - w);
+  *right = std::max(*right, cx + w);
+}
+
 constexpr static KDCoordinate k_iconSize = 15;
 constexpr static KDCoordinate k_iconBodySize = 5;
 constexpr static KDCoordinate k_iconHeadSize = 3;
@@ -44,9 +71,15 @@ void Turtle::reset() {
   m_penSize = k_defaultPenSize;
   m_mileage = 0;
   m_animationStep = 0;
+  m_movesSinceUpdate = 0;
+  m_numberOfSegments = 0;
 
   // Draw the turtle
-  draw(true);
+  if (isBatching()) {
+    m_needsUpdate = true;
+  } else {
+    draw(true);
+  }
 }
 
 bool Turtle::forward(mp_float_t length) {
@@ -93,6 +126,11 @@ void Turtle::circle(mp_int_t radius, mp_float_t angle) {
 }
 
 bool Turtle::goTo(mp_float_t x, mp_float_t y) {
+  /* Without a buffer for the segments, the lines are drawn as when animating,
+   * rather than dropped. */
+  if (isBatching() && hasSegments()) {
+    return batchMove(x, y);
+  }
   mp_float_t oldx = m_x;
   mp_float_t oldy = m_y;
   mp_float_t xLength = absF(std::floor(x) - std::floor(oldx));
@@ -143,6 +181,10 @@ bool Turtle::goTo(mp_float_t x, mp_float_t y) {
 void Turtle::setHeading(mp_float_t angle) {
   micropython_port_vm_hook_loop();
   setHeadingPrivate(angle);
+  if (isBatching()) {
+    m_needsUpdate = true;
+    return;
+  }
   erase();
   draw(true);
 }
@@ -175,10 +217,12 @@ void Turtle::setPenSize(KDCoordinate penSize) {
 
 void Turtle::setVisible(bool visible) {
   m_visible = visible;
-  if (m_visible) {
-    draw(true);
-  } else {
+  if (!m_visible) {
     erase();
+  } else if (isBatching()) {
+    m_needsUpdate = true;
+  } else {
+    draw(true);
   }
 }
 
@@ -187,7 +231,8 @@ void Turtle::write(const char* string) {
   if (isOutOfBounds()) {
     return;
   }
-  erase();
+  // The batched lines are drawn first, so that the text is on top of them
+  flushSegments();
   MicroPython::ExecutionEnvironment::currentExecutionEnvironment()
       ->displaySandbox();
   KDContext* ctx = KDIonContext::SharedContext;
@@ -203,9 +248,39 @@ void Turtle::write(const char* string) {
                               .translatedBy(headOffset)
                               .translatedBy(head)
                   .translatedBy(stringOffset));
+  if (isBatching()) {
+    m_needsUpdate = true;
+  } else {
+    draw(true);
+  }
+}
+
+void Turtle::setTracer(uint16_t n) {
+  if (isBatching() && n == 1) {
+    update();
+  }
+  m_tracer = n;
+  m_movesSinceUpdate = 0;
+}
+
+void Turtle::update() {
+  flushSegments();
+  m_movesSinceUpdate = 0;
+  m_needsUpdate = false;
   draw(true);
 }
 
+void Turtle::endRun(bool succeeded) {
+  if (succeeded && m_needsUpdate) {
+    update();
+    return;
+  }
+  /* After an error, the sandbox has been hidden to show the exception, so the
+   * batched lines are dropped. */
+  m_numberOfSegments = 0;
+  m_needsUpdate = false;
+}
+
 void Turtle::viewDidDisappear() { m_drawn = false; }
 
 bool Turtle::isOutOfBounds() const {
@@ -277,6 +352,96 @@ bool Turtle::hasDotBuffers() {
   return m_dotWorkingPixelBuffer && hasDotMask();
 }
 
+bool Turtle::hasSegments() {
+  if (m_segments == nullptr) {
+    m_segments = allocate<Segment>(k_maxNumberOfSegments);
+  }
+  return m_segments != nullptr;
+}
+
+bool Turtle::batchMove(mp_float_t x, mp_float_t y) {
+  if (m_penDown && !isOutOfBounds() && absF(x) <= k_maxPosition &&
+      absF(y) <= k_maxPosition) {
+    if (m_numberOfSegments == k_maxNumberOfSegments) {
+      flushSegments();
+    }
+    // The ends are the centers of the pixels the animated pen would draw
+    KDPoint from = position();
+    KDPoint to = position(x, y);
+    m_segments[m_numberOfSegments++] = {
+        from.x() + 0.5f, from.y() + 0.5f, to.x() + 0.5f,
+        to.y() + 0.5f,   m_color,         m_penSize};
+  }
+  m_x = x;
+  m_y = y;
+  m_needsUpdate = true;
+  if (m_tracer > 0 && ++m_movesSinceUpdate >= m_tracer) {
+    update();
+  }
+  return micropython_port_vm_hook_loop();
+}
+
+void Turtle::flushSegments() {
+  MicroPython::ExecutionEnvironment::currentExecutionEnvironment()
+      ->displaySandbox();
+  // Restore the pixels underneath the icon before drawing over them
+  erase();
+  for (int i = 0; i < m_numberOfSegments; i++) {
+    drawSegment(m_segments[i]);
+  }
+  m_numberOfSegments = 0;
+}
+
+void Turtle::drawSegment(const Segment& segment) const {
+  /* The line is the set of pixels whose center is at most penSize / 2 away
+   * from the segment: a rectangle with round caps. Its intersection with each
+   * row is a single span, which is filled at once. */
+  KDContext* ctx = KDIonContext::SharedContext;
+  float radius = std::max<KDCoordinate>(segment.penSize, 1) / 2.0f;
+  float dx = segment.x1 - segment.x0;
+  float dy = segment.y1 - segment.y0;
+  float squaredLength = dx * dx + dy * dy;
+  float length = std::sqrt(squaredLength);
+  int firstRow = std::ceil(
+      std::max(std::min(segment.y0, segment.y1) - radius, 0.0f) - 0.5f);
+  int lastRow = std::floor(std::min(std::max(segment.y0, segment.y1) + radius,
+                                    static_cast<float>(Ion::Display::Height)) -
+                           0.5f);
+  for (int row = firstRow; row <= lastRow; row++) {
+    float y = row + 0.5f;
+    float left = INFINITY;
+    float right = -INFINITY;
+    addDiskSpan(segment.x0, segment.y0, radius, y, &left, &right);
+    addDiskSpan(segment.x1, segment.y1, radius, y, &left, &right);
+    if (squaredLength > 0) {
+      /* Points p of the rectangle verify 0 <= (p - p0).d <= |d|^2 along the
+       * segment and |(p - p0) x d| <= radius * |d| across it. */
+      float h = y - segment.y0;
+      float bodyLeft = -INFINITY;
+      float bodyRight = INFINITY;
+      if (intersectSpan(dx, segment.x0 * dx - h * dy,
+                        segment.x0 * dx - h * dy + squaredLength, &bodyLeft,
+                        &bodyRight) &&
+          intersectSpan(dy, segment.x0 * dy + h * dx - radius * length,
+                        segment.x0 * dy + h * dx + radius * length, &bodyLeft,
+                        &bodyRight)) {
+        left = std::min(left, bodyLeft);
+        right = std::max(right, bodyRight);
+      }
+    }
+    if (left > right) {
+      continue;
+    }
+    int firstColumn = std::max(std::ceil(left - 0.5f), 0.0f);
+    int lastColumn = std::min(std::floor(right - 0.5f),
+                              static_cast<float>(Ion::Display::Width - 1));
+    if (firstColumn <= lastColumn) {
+      ctx->fillRect(KDRect(firstColumn, row, lastColumn - firstColumn + 1, 1),
+                    segment.color);
+    }
+  }
+}
+
 KDRect Turtle::iconRect() const {
   assert(!isOutOfBounds());
   KDPoint iconOffset = KDPoint(-k_iconSize / 2, -k_iconSize / 2);
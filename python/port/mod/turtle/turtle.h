@@ -24,6 +24,7 @@ class Turtle {
       : m_underneathPixelBuffer(nullptr),
         m_dotMask(nullptr),
         m_dotWorkingPixelBuffer(nullptr),
+        m_segments(nullptr),
         m_x(0),
         m_y(0),
         m_heading(0),
@@ -35,7 +36,11 @@ class Turtle {
         m_penSize(k_defaultPenSize),
         m_mileage(0),
         m_drawn(false),
-        m_animationStep(0) {}
+        m_animationStep(0),
+        m_tracer(1),
+        m_movesSinceUpdate(0),
+        m_numberOfSegments(0),
+        m_needsUpdate(false) {}
 
   void reset();
 
@@ -75,6 +80,15 @@ class Turtle {
 
   void write(const char* string);
 
+  /* With a tracer of 1, the turtle is animated at each step. Otherwise, the
+   * lines are batched and the screen is only updated every n moves, or never
+   * if n is 0, until update is called. */
+  uint16_t tracer() const { return m_tracer; }
+  void setTracer(uint16_t n);
+  void update();
+  // Update the screen if batched lines are pending, at the end of a run
+  void endRun(bool succeeded);
+
   void viewDidDisappear();
 
   /* isOutOfBounds returns true if nothing should be drawn at current position.
@@ -98,6 +112,17 @@ class Turtle {
   constexpr static uint8_t k_defaultPenSize = 1;
   constexpr static KDFont::Size k_font = KDFont::Size::Large;
   constexpr static mp_float_t k_maxPosition = KDCOORDINATE_MAX * 0.75f;
+  constexpr static int k_maxNumberOfSegments = 64;
+
+  // A batched line, in screen coordinates
+  struct Segment {
+    float x0;
+    float y0;
+    float x1;
+    float y1;
+    KDColor color;
+    KDCoordinate penSize;
+  };
 
   enum class PawType : uint8_t {
     FrontRight = 0,
@@ -121,6 +146,14 @@ class Turtle {
   bool hasUnderneathPixelBuffer();
   bool hasDotMask();
   bool hasDotBuffers();
+  bool hasSegments();
+
+  bool isBatching() const { return m_tracer != 1; }
+  /* Returns true if the move has been interrupted. The segments must have
+   * been allocated. */
+  bool batchMove(mp_float_t x, mp_float_t y);
+  void flushSegments();
+  void drawSegment(const Segment& segment) const;
 
   KDRect iconRect() const;
 
@@ -132,12 +165,13 @@ class Turtle {
   void erase();
 
   /* When GC is performed, sTurtle is marked as root for GC collection and its
-   * data is scanned for pointers that point to the Python heap. We put the 3
+   * data is scanned for pointers that point to the Python heap. We put the 4
    * pointers that should be marked at the beginning of the object to maximize
    * the chances they will be correctly aligned and interpreted as pointers. */
   KDColor* m_underneathPixelBuffer;
   uint8_t* m_dotMask;
   KDColor* m_dotWorkingPixelBuffer;
+  Segment* m_segments;
 
   /* The frame's center is the center of the screen, the x axis goes to the
    * right and the y axis goes upwards. */
@@ -171,6 +205,12 @@ class Turtle {
   uint16_t m_mileage;
   bool m_drawn;
   int m_animationStep;
+
+  uint16_t m_tracer;
+  uint16_t m_movesSinceUpdate;
+  uint8_t m_numberOfSegments;
+  // Batched moves happened since the last update
+  bool m_needsUpdate;
 };
 
 #endif
@@ -93,6 +93,14 @@
 #define NDARRAY_BINARY_USES_FUN_POINTER     (0)
 #endif
 
+// Contiguous arrays, possibly combined with a scalar, can be processed in flat
+// loops without strides, which the compiler can vectorise. The fast paths of the
+// binary operators, of sum, mean and std, and of the mathematical functions
+// bypass the function pointers above, at the cost of a few kB of firmware.
+#ifndef ULAB_HAS_FAST_PATHS
+#define ULAB_HAS_FAST_PATHS                 (1)
+#endif
+
 #ifndef NDARRAY_HAS_BINARY_OP_ADD
 #define NDARRAY_HAS_BINARY_OP_ADD           (1)
 #endif
@@ -20,9 +20,18 @@
 #define MICROPY_ENABLE_PYSTACK (1)
 #endif
 
+#if !PLATFORM_DEVICE
+// Each calculator instance runs its own interpreter, see omg/instance_local.h
+#define MICROPY_STATE_THREAD_LOCAL (1)
+#endif
+
 // Maximum length of a path in the filesystem
 #define MICROPY_ALLOC_PATH_MAX (32)
 
+// Whether to load and save compiled raw code, used to cache imported scripts
+#define MICROPY_PERSISTENT_CODE_LOAD (1)
+#define MICROPY_PERSISTENT_CODE_SAVE (1)
+
 // Whether to include the garbage collector
 #define MICROPY_ENABLE_GC (1)
 
@@ -125,7 +134,13 @@
 // (This scheme won't work if we want to mix Thumb and normal ARM code.)
 #define MICROPY_MAKE_POINTER_CALLABLE(p) (p)
 
+#if MICROPY_PORT_PROFILER
+#define MICROPY_VM_HOOK_LOOP                        \
+  micropython_port_profiler_sample(code_state, ip); \
+  micropython_port_vm_hook_loop();
+#else
 #define MICROPY_VM_HOOK_LOOP micropython_port_vm_hook_loop();
+#endif
 
 typedef intptr_t mp_int_t;    // must be pointer size
 typedef uintptr_t mp_uint_t;  // must be pointer size
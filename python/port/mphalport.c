@@ -3,7 +3,7 @@
 
 #if MICROPY_KBD_EXCEPTION
 
-int mp_interrupt_char;
+MP_STATE_STORAGE int mp_interrupt_char;
 
 void mp_hal_set_interrupt_char(int c) {
   if (c != -1) {
@@ -15,9 +15,11 @@
 #endif
 
 extern "C" {
+#include "mod/kandinsky/modkandinsky.h"
 #include "mod/matplotlib/pyplot/modpyplot.h"
 #include "mod/turtle/modturtle.h"
 #include "mphalport.h"
+#include "profiler.h"
 #include "py/builtin.h"
 #include "py/compile.h"
 #include "py/gc.h"
@@ -32,10 +34,19 @@ extern "C" {
 }
 
 #include <escher/palette.h>
+#include <omg/instance_local.h>
 
-static MicroPython::ScriptProvider *sScriptProvider = nullptr;
-static MicroPython::ExecutionEnvironment *sCurrentExecutionEnvironment =
+static OMG_INSTANCE_LOCAL MicroPython::ScriptProvider *sScriptProvider =
     nullptr;
+static OMG_INSTANCE_LOCAL MicroPython::ScriptCache *sScriptCache = nullptr;
+static OMG_INSTANCE_LOCAL MicroPython::ExecutionEnvironment
+    *sCurrentExecutionEnvironment = nullptr;
+/* Drawing loops tend to pass the same color object over and over, so the last
+ * parsed color is cached. Only immutable objects are cached, and the cached
+ * object is a GC root so that its address is not reused by another object. */
+static OMG_INSTANCE_LOCAL mp_obj_t sLastColorInput = MP_OBJ_NULL;
+static OMG_INSTANCE_LOCAL MicroPython::Color::Mode sLastColorMode;
+static OMG_INSTANCE_LOCAL KDColor sLastColor;
 
 MicroPython::ExecutionEnvironment::~ExecutionEnvironment() {
   sCurrentExecutionEnvironment = nullptr;
@@ -54,6 +65,9 @@ bool MicroPython::ExecutionEnvironment::runCode(const char *str) {
    * for the exception handling (because of print). */
   mp_hal_set_interrupt_char((int)Ion::Keyboard::Key::Back);
 
+#if MICROPY_PORT_PROFILER
+  micropython_port_profiler_start_run();
+#endif
   bool runSucceeded = true;
   nlr_buf_t nlr;
   if (nlr_push(&nlr) == 0) {
@@ -64,14 +78,20 @@ bool MicroPython::ExecutionEnvironment::runCode(const char *str) {
     mp_parse_tree_t pt = mp_parse(lex, MP_PARSE_SINGLE_INPUT);
     mp_obj_t module_fun = mp_compile(&pt, lex->source_name, true);
     mp_call_function_0(module_fun);
+    // Show the lines the turtle has batched during the run
+    modturtle_end_run(true);
     nlr_pop();
   } else {  // Uncaught exception
     runSucceeded = false;
+    modturtle_end_run(false);
     HandleException(&nlr);
   }
 
   // Disable the user interruption
   mp_hal_set_interrupt_char(-1);
+#if MICROPY_PORT_PROFILER
+  micropython_port_profiler_end_run();
+#endif
 
   assert(sCurrentExecutionEnvironment == this);
   sCurrentExecutionEnvironment = nullptr;
@@ -177,6 +197,10 @@ void MicroPython::init(void *heapStart, void *heapEnd) {
 #endif
   gc_init(heapStart, heapEnd);
   mp_init();
+  sLastColorInput = MP_OBJ_NULL;
+#if MICROPY_PORT_PROFILER
+  micropython_port_profiler_reset();
+#endif
 }
 
 void MicroPython::deinit() { mp_deinit(); }
@@ -185,6 +209,8 @@ void MicroPython::registerScriptProvider(ScriptProvider *s) {
   sScriptProvider = s;
 }
 
+void MicroPython::registerScriptCache(ScriptCache *c) { sScriptCache = c; }
+
 void MicroPython::collectRootsAtAddress(char *address, int byteLength) {
   /* The given address is not necessarily aligned on sizeof(void *). However,
    * any pointer stored in the range [address, address + byteLength] will be
@@ -213,6 +239,19 @@ void MicroPython::collectRootsAtAddress(char *address, int byteLength) {
 }
 
 KDColor MicroPython::Color::Parse(mp_obj_t input, Mode mode) {
+  if (input == sLastColorInput && mode == sLastColorMode) {
+    return sLastColor;
+  }
+  KDColor color = ParseUncached(input, mode);
+  if (mp_obj_is_str(input) || mp_obj_is_type(input, &mp_type_tuple)) {
+    sLastColorInput = input;
+    sLastColorMode = mode;
+    sLastColor = color;
+  }
+  return color;
+}
+
+KDColor MicroPython::Color::ParseUncached(mp_obj_t input, Mode mode) {
   constexpr static int maxColorIntensity =
       static_cast<int>(Mode::MaxIntensity255);
   if (mp_obj_is_str(input)) {
@@ -325,9 +364,15 @@ void gc_collect_regs_and_stack(void) {
 }
 
 void gc_collect(void) {
+#if MICROPY_PORT_PROFILER
+  micropython_port_profiler_will_collect_garbage();
+#endif
   gc_collect_start();
   modturtle_gc_collect();
   modpyplot_gc_collect();
+  modkandinsky_gc_collect();
+  MicroPython::collectRootsAtAddress(reinterpret_cast<char *>(&sLastColorInput),
+                                     sizeof(mp_obj_t));
   gc_collect_regs_and_stack();
   gc_collect_end();
 }
@@ -352,8 +397,33 @@ mp_lexer_t *mp_lexer_new_from_file(const char *filename) {
   }
 }
 
+mp_raw_code_t *micropython_port_raw_code_for_script(const char *filename) {
+  const char *script =
+      sScriptProvider ? sScriptProvider->contentOfScript(filename, true)
+                      : nullptr;
+  if (script == nullptr) {
+    mp_raise_OSError(MP_ENOENT);
+  }
+  if (sScriptCache) {
+    mp_raw_code_t *rawCode = sScriptCache->rawCodeForScript(filename, script);
+    if (rawCode) {
+      return rawCode;
+    }
+  }
+  mp_lexer_t *lex = mp_lexer_new_from_str_len(
+      qstr_from_str(filename), script, strlen(script), 0 /* size_t free_len*/);
+  qstr sourceName = lex->source_name;
+  mp_parse_tree_t parseTree = mp_parse(lex, MP_PARSE_FILE_INPUT);
+  mp_raw_code_t *rawCode =
+      mp_compile_to_raw_code(&parseTree, sourceName, false);
+  if (sScriptCache) {
+    sScriptCache->storeRawCodeForScript(filename, script, rawCode);
+  }
+  return rawCode;
+}
+
 mp_import_stat_t mp_import_stat(const char *path) {
-  if (sScriptProvider && sScriptProvider->contentOfScript(path, false)) {
+  if (sScriptProvider && sScriptProvider->hasScript(path)) {
     return MP_IMPORT_STAT_FILE;
   }
   return MP_IMPORT_STAT_NO_EXIST;
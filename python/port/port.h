@@ -9,11 +9,16 @@ extern "C" {
 }
 #include <escher/view_controller.h>
 
+#include "script_cache.h"
+
 namespace MicroPython {
 
 class ScriptProvider {
  public:
   virtual const char* contentOfScript(const char* name, bool markAsFetched) = 0;
+  virtual bool hasScript(const char* name) {
+    return contentOfScript(name, false) != nullptr;
+  }
 };
 
 class ExecutionEnvironment {
@@ -44,6 +49,7 @@ class ExecutionEnvironment {
 void init(void* heapStart, void* heapEnd);
 void deinit();
 void registerScriptProvider(ScriptProvider* s);
+void registerScriptCache(ScriptCache* c);
 void collectRootsAtAddress(char* address, int len);
 
 class Color {
@@ -56,6 +62,7 @@ class Color {
   static KDColor Parse(mp_obj_t input, Mode Mode = Mode::MaxIntensity255);
 
  private:
+  static KDColor ParseUncached(mp_obj_t input, Mode mode);
   class NamedColor {
    public:
     constexpr NamedColor(const char* name, KDColor color)
@@ -0,0 +1,137 @@
+#include "profiler.h"
+
+#include <ion.h>
+#include <omg/instance_local.h>
+#include <stdio.h>
+#include <stdlib.h>
+
+#include <algorithm>
+
+#include "helpers.h"
+
+extern "C" {
+#include <py/bc.h>
+#include <py/gc.h>
+#include <py/qstr.h>
+}
+
+#if PLATFORM_DEVICE
+#error "The Python profiler writes its samples to a file of the host"
+#endif
+
+constexpr static const char *k_defaultOutputPath = "python_profile.folded";
+constexpr static int k_numberOfLocations = 512;
+
+struct Location {
+  qstr sourceFile;
+  qstr function;
+  size_t line;
+  // Milliseconds spent at this location
+  uint32_t samples;
+};
+
+struct Profile {
+  Location locations[k_numberOfLocations];
+  // Samples that did not fit in locations
+  uint32_t droppedSamples;
+  uint32_t numberOfCollections;
+  size_t heapHighWaterMark;
+  uint64_t lastSampleTime;
+};
+
+static OMG_INSTANCE_LOCAL Profile sProfile;
+
+static void updateHeapHighWaterMark() {
+  gc_info_t info;
+  gc_info(&info);
+  sProfile.heapHighWaterMark = std::max(sProfile.heapHighWaterMark, info.used);
+}
+
+static void addSamples(qstr sourceFile, qstr function, size_t line,
+                       uint32_t samples) {
+  // Open addressing, the locations are never removed
+  size_t hash = (sourceFile * 31 + function) * 31 + line;
+  for (int i = 0; i < k_numberOfLocations; i++) {
+    Location *location =
+        &sProfile.locations[(hash + i) % k_numberOfLocations];
+    if (location->samples == 0) {
+      *location = {sourceFile, function, line, samples};
+      return;
+    }
+    if (location->sourceFile == sourceFile && location->function == function &&
+        location->line == line) {
+      location->samples += samples;
+      return;
+    }
+  }
+  sProfile.droppedSamples += samples;
+}
+
+void micropython_port_profiler_reset() { sProfile = Profile(); }
+
+void micropython_port_profiler_start_run() {
+  // The time spent out of the VM, waiting for the next run, is not sampled
+  sProfile.lastSampleTime = Ion::Timing::millis();
+}
+
+void micropython_port_profiler_sample(const mp_code_state_t *code_state,
+                                      const uint8_t *ip) {
+  uint64_t time = Ion::Timing::millis();
+  if (time == sProfile.lastSampleTime) {
+    return;
+  }
+  // The location is charged with the time elapsed since the last sample
+  uint32_t samples = time - sProfile.lastSampleTime;
+  sProfile.lastSampleTime = time;
+
+  // Decode the prelude of the bytecode, as the VM does for tracebacks
+  const byte *prelude = code_state->fun_bc->bytecode;
+  MP_BC_PRELUDE_SIG_DECODE(prelude);
+  MP_BC_PRELUDE_SIZE_DECODE(prelude);
+  const byte *bytecodeStart = prelude + n_info + n_cell;
+#if MICROPY_PERSISTENT_CODE
+  qstr function = prelude[0] | (prelude[1] << 8);
+  qstr sourceFile = prelude[2] | (prelude[3] << 8);
+  prelude += 4;
+#else
+  bytecodeStart = MP_ALIGN(bytecodeStart, sizeof(mp_uint_t));
+  qstr function = mp_decode_uint_value(prelude);
+  prelude = mp_decode_uint_skip(prelude);
+  qstr sourceFile = mp_decode_uint_value(prelude);
+  prelude = mp_decode_uint_skip(prelude);
+#endif
+  size_t line = mp_bytecode_get_source_line(prelude, ip - bytecodeStart);
+  addSamples(sourceFile, function, line, samples);
+}
+
+void micropython_port_profiler_will_collect_garbage() {
+  sProfile.numberOfCollections++;
+  // The heap is at its fullest right before being collected
+  updateHeapHighWaterMark();
+}
+
+void micropython_port_profiler_end_run() {
+  updateHeapHighWaterMark();
+  const char *path = getenv("EPSILON_PYTHON_PROFILE");
+  FILE *f = fopen(path ? path : k_defaultOutputPath, "w");
+  if (f == nullptr) {
+    return;
+  }
+  // flamegraph.pl ignores the lines that are not samples
+  fprintf(f, "# garbage collections: %u\n",
+          static_cast<unsigned>(sProfile.numberOfCollections));
+  fprintf(f, "# heap high-water mark: %zu bytes\n",
+          sProfile.heapHighWaterMark);
+  fprintf(f, "# dropped samples: %u\n",
+          static_cast<unsigned>(sProfile.droppedSamples));
+  for (const Location &location : sProfile.locations) {
+    if (location.samples == 0) {
+      continue;
+    }
+    const char *sourceFile = qstr_str(location.sourceFile);
+    fprintf(f, "%s;%s;%s:%zu %u\n", sourceFile, qstr_str(location.function),
+            sourceFile, location.line,
+            static_cast<unsigned>(location.samples));
+  }
+  fclose(f);
+}
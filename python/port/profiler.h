@@ -0,0 +1,28 @@
+#ifndef PYTHON_PORT_PROFILER_H
+#define PYTHON_PORT_PROFILER_H
+
+/* The profiler is built into simulators made with PYTHON_PROFILER=1.
+ * The VM calls its hook at the jumps of the bytecode, so at least once per
+ * iteration of a loop. The function and line running when the hook is called
+ * are charged with the milliseconds elapsed since the last charge, if any. At
+ * the end of each run, the samples of the session are written, aggregated by
+ * function and line, in the folded format of flamegraph.pl, with the number of
+ * garbage collections and the high-water mark of the heap.
+ * The file is named by the EPSILON_PYTHON_PROFILE environment variable, and
+ * defaults to python_profile.folded. */
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Forget the samples of the previous session
+void micropython_port_profiler_reset();
+void micropython_port_profiler_start_run();
+void micropython_port_profiler_end_run();
+void micropython_port_profiler_will_collect_garbage();
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
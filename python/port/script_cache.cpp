@@ -0,0 +1,121 @@
+#include "script_cache.h"
+
+#include <assert.h>
+#include <ion.h>
+#include <string.h>
+
+extern "C" {
+#include "py/persistentcode.h"
+}
+
+namespace MicroPython {
+
+struct BufferWriter {
+  char* cursor;
+  size_t length;
+};
+
+static void countBytes(void* data, const char* str, size_t len) {
+  static_cast<BufferWriter*>(data)->length += len;
+}
+
+static void writeBytes(void* data, const char* str, size_t len) {
+  BufferWriter* writer = static_cast<BufferWriter*>(data);
+  memcpy(writer->cursor, str, len);
+  writer->cursor += len;
+  writer->length += len;
+}
+
+mp_raw_code_t* ScriptCache::rawCodeForScript(const char* name,
+                                             const char* content) {
+  uint32_t checksum = Checksum(content);
+  size_t offset = 0;
+  while (offset < m_usedSize) {
+    EntryHeader* entry = entryAtOffset(offset);
+    if (entry->checksum == checksum &&
+        strncmp(entry->name, name, k_maxNameSize) == 0) {
+      m_numberOfHits++;
+      return mp_raw_code_load_mem(
+          reinterpret_cast<const byte*>(entry + 1), entry->rawCodeSize);
+    }
+    offset += EntrySize(entry->rawCodeSize);
+  }
+  m_numberOfMisses++;
+  return nullptr;
+}
+
+void ScriptCache::storeRawCodeForScript(const char* name, const char* content,
+                                        mp_raw_code_t* rawCode) {
+  if (strlen(name) >= k_maxNameSize) {
+    return;
+  }
+  // Measure the serialized raw code before reserving space for it
+  BufferWriter counter = {nullptr, 0};
+  mp_print_t countPrint = {&counter, countBytes};
+  mp_raw_code_save(rawCode, &countPrint);
+  size_t entrySize = EntrySize(counter.length);
+  if (counter.length > UINT16_MAX || entrySize > k_bufferSize) {
+    return;
+  }
+
+  /* A previous version of the script is now outdated and the oldest entries
+   * make room for the new one. */
+  size_t offset = 0;
+  while (offset < m_usedSize) {
+    EntryHeader* entry = entryAtOffset(offset);
+    size_t size = EntrySize(entry->rawCodeSize);
+    if (strncmp(entry->name, name, k_maxNameSize) == 0) {
+      memmove(m_buffer + offset, m_buffer + offset + size,
+              m_usedSize - offset - size);
+      m_usedSize -= size;
+      break;
+    }
+    offset += size;
+  }
+  while (m_usedSize + entrySize > k_bufferSize) {
+    removeOldestEntry();
+  }
+
+  EntryHeader* entry = entryAtOffset(m_usedSize);
+  entry->checksum = Checksum(content);
+  entry->rawCodeSize = counter.length;
+  strlcpy(entry->name, name, k_maxNameSize);
+  BufferWriter writer = {reinterpret_cast<char*>(entry + 1), 0};
+  mp_print_t writePrint = {&writer, writeBytes};
+  mp_raw_code_save(rawCode, &writePrint);
+  assert(writer.length == counter.length);
+  m_usedSize += entrySize;
+}
+
+int ScriptCache::numberOfEntries() const {
+  int result = 0;
+  size_t offset = 0;
+  while (offset < m_usedSize) {
+    const EntryHeader* entry =
+        reinterpret_cast<const EntryHeader*>(m_buffer + offset);
+    offset += EntrySize(entry->rawCodeSize);
+    result++;
+  }
+  return result;
+}
+
+uint32_t ScriptCache::Checksum(const char* content) {
+  return Ion::crc32Byte(reinterpret_cast<const uint8_t*>(content),
+                        strlen(content));
+}
+
+size_t ScriptCache::EntrySize(size_t rawCodeSize) {
+  // Keep the headers aligned
+  constexpr size_t alignment = alignof(EntryHeader);
+  return (sizeof(EntryHeader) + rawCodeSize + alignment - 1) &
+         ~(alignment - 1);
+}
+
+void ScriptCache::removeOldestEntry() {
+  assert(m_usedSize > 0);
+  size_t size = EntrySize(entryAtOffset(0)->rawCodeSize);
+  memmove(m_buffer, m_buffer + size, m_usedSize - size);
+  m_usedSize -= size;
+}
+
+}  // namespace MicroPython
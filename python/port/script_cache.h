@@ -0,0 +1,62 @@
+#ifndef PYTHON_PORT_SCRIPT_CACHE_H
+#define PYTHON_PORT_SCRIPT_CACHE_H
+
+extern "C" {
+#include <py/emitglue.h>
+#include <stddef.h>
+#include <stdint.h>
+}
+
+namespace MicroPython {
+
+/* The ScriptCache keeps the compiled raw code of imported scripts, serialized
+ * in the .mpy format, so that importing an unchanged script again skips the
+ * lexing, parsing and compilation steps. The buffer lives outside of the
+ * Python heap: it survives the reinitializations of MicroPython and can be
+ * kept for the lifetime of the app owning it.
+ *
+ * Entries are stored contiguously and each of them is validated by the name
+ * and a checksum of the content of the script. When the buffer is full, the
+ * oldest entries are evicted. */
+
+class ScriptCache {
+ public:
+  ScriptCache() : m_usedSize(0), m_numberOfHits(0), m_numberOfMisses(0) {}
+
+  /* Return the raw code compiled from content, newly allocated on the Python
+   * heap, or nullptr if it is not cached. */
+  mp_raw_code_t* rawCodeForScript(const char* name, const char* content);
+  void storeRawCodeForScript(const char* name, const char* content,
+                             mp_raw_code_t* rawCode);
+  void reset() { m_usedSize = 0; }
+
+  int numberOfEntries() const;
+  int numberOfHits() const { return m_numberOfHits; }
+  int numberOfMisses() const { return m_numberOfMisses; }
+
+ private:
+  constexpr static size_t k_bufferSize = 2048;
+  constexpr static size_t k_maxNameSize = 32;
+
+  struct EntryHeader {
+    uint32_t checksum;
+    uint16_t rawCodeSize;
+    char name[k_maxNameSize];
+  };
+
+  static uint32_t Checksum(const char* content);
+  static size_t EntrySize(size_t rawCodeSize);
+  EntryHeader* entryAtOffset(size_t offset) {
+    return reinterpret_cast<EntryHeader*>(m_buffer + offset);
+  }
+  void removeOldestEntry();
+
+  alignas(EntryHeader) char m_buffer[k_bufferSize];
+  size_t m_usedSize;
+  int m_numberOfHits;
+  int m_numberOfMisses;
+};
+
+}  // namespace MicroPython
+
+#endif
@@ -46,12 +46,12 @@
 #if !MICROPY_ENABLE_DYNRUNTIME
 #if SEED_ON_IMPORT
 // If the state is seeded on import then keep these variables in the BSS.
-STATIC uint32_t yasmarang_pad, yasmarang_n, yasmarang_d;
-STATIC uint8_t yasmarang_dat;
+STATIC MP_STATE_STORAGE uint32_t yasmarang_pad, yasmarang_n, yasmarang_d;
+STATIC MP_STATE_STORAGE uint8_t yasmarang_dat;
 #else
 // Without seed-on-import these variables must be initialised via the data section.
-STATIC uint32_t yasmarang_pad = 0xeda4baba, yasmarang_n = 69, yasmarang_d = 233;
-STATIC uint8_t yasmarang_dat = 0;
+STATIC MP_STATE_STORAGE uint32_t yasmarang_pad = 0xeda4baba, yasmarang_n = 69, yasmarang_d = 233;
+STATIC MP_STATE_STORAGE uint8_t yasmarang_dat = 0;
 #endif
 #endif
 
@@ -219,7 +219,7 @@ STATIC MP_DEFINE_CONST_FUN_OBJ_2(mod_urandom_uniform_obj, mod_urandom_uniform);
 STATIC mp_obj_t mod_urandom___init__() {
     // This module may be imported by more than one name so need to ensure
     // that it's only ever seeded once.
-    static bool seeded = false;
+    static MP_STATE_STORAGE bool seeded = false;
     if (!seeded) {
         seeded = true;
         mod_urandom_seed(0, NULL);
@@ -87,7 +87,12 @@ MP_DECLARE_CONST_FUN_OBJ_2(mp_op_getitem_obj);
 MP_DECLARE_CONST_FUN_OBJ_3(mp_op_setitem_obj);
 MP_DECLARE_CONST_FUN_OBJ_2(mp_op_delitem_obj);
 
+#if MICROPY_STATE_THREAD_LOCAL
+// The globals of __main__ belong to the state, so the module does too
+extern MP_STATE_STORAGE mp_obj_module_t mp_module___main__;
+#else
 extern const mp_obj_module_t mp_module___main__;
+#endif
 extern const mp_obj_module_t mp_module_builtins;
 extern const mp_obj_module_t mp_module_uarray;
 extern const mp_obj_module_t mp_module_collections;
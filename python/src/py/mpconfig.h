@@ -1345,6 +1345,20 @@ typedef double mp_float_t;
 #define MICROPY_PY_UTIME_TICKS_PERIOD (MP_SMALL_INT_POSITIVE_MASK + 1)
 #endif
 
+// Whether each thread of the process runs its own interpreter, in which case
+// mp_state_ctx and the other mutable globals of the interpreter are thread
+// local. Unlike MICROPY_PY_THREAD, the interpreters share no state.
+#ifndef MICROPY_STATE_THREAD_LOCAL
+#define MICROPY_STATE_THREAD_LOCAL (0)
+#endif
+
+// Storage class of the mutable globals of the interpreter
+#if MICROPY_STATE_THREAD_LOCAL
+#define MP_STATE_STORAGE __thread
+#else
+#define MP_STATE_STORAGE
+#endif
+
 // Whether to provide "_thread" module
 #ifndef MICROPY_PY_THREAD
 #define MICROPY_PY_THREAD (0)
@@ -136,7 +136,10 @@ mp_obj_t mp_obj_new_module(qstr module_name) {
 // Global module table and related functions
 
 STATIC const mp_rom_map_elem_t mp_builtin_module_table[] = {
+    #if !MICROPY_STATE_THREAD_LOCAL
+    // A thread local __main__ has no constant address, see mp_module_get
     { MP_ROM_QSTR(MP_QSTR___main__), MP_ROM_PTR(&mp_module___main__) },
+    #endif
     { MP_ROM_QSTR(MP_QSTR_builtins), MP_ROM_PTR(&mp_module_builtins) },
     { MP_ROM_QSTR(MP_QSTR_micropython), MP_ROM_PTR(&mp_module_micropython) },
 
@@ -252,6 +255,11 @@ mp_obj_t mp_module_get(qstr module_name) {
         // module not found, look for builtin module names
         el = mp_map_lookup((mp_map_t *)&mp_builtin_module_map, MP_OBJ_NEW_QSTR(module_name), MP_MAP_LOOKUP);
         if (el == NULL) {
+            #if MICROPY_STATE_THREAD_LOCAL
+            if (module_name == MP_QSTR___main__) {
+                return MP_OBJ_FROM_PTR(&mp_module___main__);
+            }
+            #endif
             return MP_OBJ_NULL;
         }
         mp_module_call_init(module_name, el->value);
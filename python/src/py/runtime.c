@@ -53,10 +53,17 @@
 #define DEBUG_OP_printf(...) (void)0
 #endif
 
+#if MICROPY_STATE_THREAD_LOCAL
+// The address of the thread local dict_main is set by mp_init
+MP_STATE_STORAGE mp_obj_module_t mp_module___main__ = {
+    .base = { &mp_type_module },
+};
+#else
 const mp_obj_module_t mp_module___main__ = {
     .base = { &mp_type_module },
     .globals = (mp_obj_dict_t *)&MP_STATE_VM(dict_main),
 };
+#endif
 
 void mp_init(void) {
     qstr_init();
@@ -96,6 +103,9 @@ void mp_init(void) {
     // initialise the __main__ module
     mp_obj_dict_init(&MP_STATE_VM(dict_main), 1);
     mp_obj_dict_store(MP_OBJ_FROM_PTR(&MP_STATE_VM(dict_main)), MP_OBJ_NEW_QSTR(MP_QSTR___name__), MP_OBJ_NEW_QSTR(MP_QSTR___main__));
+    #if MICROPY_STATE_THREAD_LOCAL
+    mp_module___main__.globals = &MP_STATE_VM(dict_main);
+    #endif
 
     // locals = globals for outer module (see Objects/frameobject.c/PyFrame_New())
     mp_locals_set(&MP_STATE_VM(dict_main));
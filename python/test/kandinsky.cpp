@@ -27,3 +27,26 @@ QUIZ_CASE(python_kandinsky_basics) {
   assert_command_execution_succeeds(env, "draw_string('hello',0,0)");
   deinit_environment();
 }
+
+QUIZ_CASE(python_kandinsky_bulk_drawing) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from kandinsky import *");
+  assert_command_execution_succeeds(env, "draw_line(0,0,20,10,'red')");
+  assert_command_execution_succeeds(env, "set_pixels([1,2,3],(4,5,6),'blue')");
+  assert_command_execution_succeeds(env, "set_pixels(range(3),range(3),'k')");
+  assert_command_execution_fails(env, "set_pixels([1,2],[4],'blue')");
+  assert_command_execution_succeeds(env, "blit(0,0,1,1,b'\\x1f\\x00')");
+  assert_command_execution_succeeds(env, "blit(0,0,2,2,bytes(8))");
+  assert_command_execution_fails(env, "blit(0,0,2,2,bytes(6))");
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(
+      env, "blit(0,0,2,2,np.ones(4,dtype=np.uint16))");
+  assert_command_execution_succeeds(env, "use_buffer(0,0,10,10)");
+  assert_command_execution_succeeds(env, "fill_rect(0,0,10,10,(0,0,255))");
+  assert_command_execution_succeeds(
+      env, "print(get_pixel(5,5) == color(0,0,255))", "True\n");
+  assert_command_execution_succeeds(env, "display()");
+  assert_command_execution_succeeds(env, "use_buffer()");
+  assert_command_execution_succeeds(env, "get_pixel(5,5)");
+  deinit_environment();
+}
@@ -0,0 +1,103 @@
+# Duration of numpy.linalg and numpy.fft, against their pure Python equivalents.
+# Copy this script into the Python app of a simulator or of a calculator, and
+# run it.
+
+import numpy as np
+from math import cos, pi, sin
+from time import monotonic
+
+N = 12
+FFT_N = 128
+DURATION = 0.5
+
+def benchmark(name, f):
+  f()
+  runs = 0
+  start = monotonic()
+  elapsed = 0
+  while elapsed < DURATION:
+    f()
+    runs += 1
+    elapsed = monotonic() - start
+  print("%-14s %9.3f ms" % (name, 1000 * elapsed / runs))
+
+def py_inv(a):
+  n = len(a)
+  m = [row[:] + [float(i == j) for j in range(n)] for i, row in enumerate(a)]
+  for k in range(n):
+    p = max(range(k, n), key=lambda i: abs(m[i][k]))
+    m[k], m[p] = m[p], m[k]
+    row = m[k]
+    pivot = row[k]
+    for j in range(2 * n):
+      row[j] /= pivot
+    for i in range(n):
+      if i != k:
+        other = m[i]
+        f = other[k]
+        for j in range(2 * n):
+          other[j] -= f * row[j]
+  return [row[n:] for row in m]
+
+def py_det(a):
+  n = len(a)
+  m = [row[:] for row in a]
+  det = 1.0
+  for k in range(n):
+    p = max(range(k, n), key=lambda i: abs(m[i][k]))
+    if p != k:
+      m[k], m[p] = m[p], m[k]
+      det = -det
+    row = m[k]
+    det *= row[k]
+    for i in range(k + 1, n):
+      other = m[i]
+      f = other[k] / row[k]
+      for j in range(k, n):
+        other[j] -= f * row[j]
+  return det
+
+def py_fft(re, im):
+  n = len(re)
+  j = 0
+  for i in range(1, n):
+    bit = n >> 1
+    while j & bit:
+      j ^= bit
+      bit >>= 1
+    j |= bit
+    if i < j:
+      re[i], re[j] = re[j], re[i]
+      im[i], im[j] = im[j], im[i]
+  size = 2
+  while size <= n:
+    half = size // 2
+    for k in range(half):
+      c = cos(-2 * pi * k / size)
+      s = sin(-2 * pi * k / size)
+      for start in range(0, n, size):
+        a = start + k
+        b = a + half
+        tr = c * re[b] - s * im[b]
+        ti = c * im[b] + s * re[b]
+        re[b] = re[a] - tr
+        im[b] = im[a] - ti
+        re[a] += tr
+        im[a] += ti
+    size *= 2
+  return re, im
+
+a = [[1 / (1 + abs(i - j)) + (i == j) for j in range(N)] for i in range(N)]
+m = np.array(a)
+signal = [sin(i / 3) for i in range(FFT_N)]
+x = np.array(signal)
+
+benchmark("inv", lambda: np.linalg.inv(m))
+benchmark("inv python", lambda: py_inv(a))
+benchmark("det", lambda: np.linalg.det(m))
+benchmark("det python", lambda: py_det(a))
+benchmark("cholesky", lambda: np.linalg.cholesky(m))
+benchmark("qr", lambda: np.linalg.qr(m))
+benchmark("eig", lambda: np.linalg.eig(m))
+benchmark("fft", lambda: np.fft.fft(x))
+benchmark("fft python", lambda: py_fft(signal[:], [0.0] * FFT_N))
@@ -107,8 +107,10 @@ QUIZ_CASE(python_matplotlib_pyplot_plot) {
   assert_command_execution_succeeds(env, "plot([2,3,4,5,6],[3,4,5,6,7])");
   assert_command_execution_succeeds(
       env, "plot([2,3,4,5,6],[3,4,5,6,7], color=\"g\")");
+  assert_command_execution_succeeds(env, "plot([i*i for i in range(2000)])");
   assert_command_execution_succeeds(env, "show()");
   assert_command_execution_fails(env, "plot([2,3,4,5,6],2)");
+  assert_command_execution_fails(env, "plot([2,3],['a','b'])");
   deinit_environment();
 }
 
@@ -65,3 +65,124 @@ QUIZ_CASE(python_numpy) {
   assert_command_execution_fails(env, "np.arange(0,3,0)");
   assert_command_execution_fails(env, "np.concatenate((0,0))");
 }
+
+QUIZ_CASE(python_numpy_fast_paths) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import numpy as np");
+  // Contiguous operands, and operands broadcast from a scalar
+  assert_command_execution_succeeds(env, "x = np.array([1,2,3,4,5,6])");
+  assert_command_execution_succeeds(env, "(x * 2 - 1).tolist()",
+                                    "[1.0, 3.0, 5.0, 7.0, 9.0, 11.0]\n");
+  assert_command_execution_succeeds(env, "(x / 2 < x - 2).tolist()",
+                                    "[False, False, False, False, True, True]\n");
+  assert_command_execution_succeeds(
+      env, "u = np.array([200,100,50,0], dtype=np.uint8)");
+  assert_command_execution_succeeds(env, "(u + u).tolist()",
+                                    "[400, 200, 100, 0]\n");
+  assert_command_execution_succeeds(env, "(u - 100).tolist()",
+                                    "[100, 0, 206, 156]\n");
+  assert_command_execution_succeeds(
+      env, "s = np.array([-3,0,3,300], dtype=np.int16)");
+  assert_command_execution_succeeds(env, "(s * -2).tolist()",
+                                    "[6, 0, -6, -600]\n");
+  assert_command_execution_succeeds(env, "(s >= 0).tolist()",
+                                    "[False, True, True, True]\n");
+  // The strided operands give the same results
+  assert_command_execution_succeeds(env, "y = np.array(range(12))[::2]");
+  assert_command_execution_succeeds(env, "(y + x == x + x * 2 - 2).tolist()",
+                                    "[True, True, True, True, True, True]\n");
+  assert_command_execution_succeeds(env, "m = np.array([[1,2],[3,4]])");
+  assert_command_execution_succeeds(env, "(m - m.transpose()).tolist()",
+                                    "[[0.0, -1.0], [1.0, 0.0]]\n");
+  assert_command_execution_succeeds(env, "(m + np.array([10,20])).tolist()",
+                                    "[[11.0, 22.0], [13.0, 24.0]]\n");
+  // Reductions and mathematical functions
+  assert_command_execution_succeeds(env, "np.sum(u)", "350\n");
+  assert_command_execution_succeeds(env, "np.mean(s)", "75.0\n");
+  assert_command_execution_succeeds(env, "np.std(y) == np.std(x * 2 - 2)",
+                                    "True\n");
+  assert_command_execution_succeeds(env, "np.sqrt(x * x).tolist() == x.tolist()",
+                                    "True\n");
+  deinit_environment();
+}
+
+QUIZ_CASE(python_numpy_linalg_fft) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "import numpy as np");
+  assert_command_execution_succeeds(env, "a = np.array([[4,2],[2,3]])");
+  assert_command_execution_succeeds(env, "np.linalg.det(a)", "8.0\n");
+  assert_command_execution_succeeds(env, "np.linalg.inv(a).tolist()",
+                                    "[[0.375, -0.25], [-0.25, 0.5]]\n");
+  assert_command_execution_succeeds(env, "np.linalg.cholesky(a).tolist()",
+                                    "[[2.0, 0.0], [1.0, 1.414213562373095]]\n");
+  assert_command_execution_succeeds(env, "np.linalg.norm([3,4])", "5.0\n");
+  // Singularity does not depend on the scale of the matrix
+  assert_command_execution_succeeds(
+      env, "s = np.array([[1,2,3],[4,5,6],[7,8,9]]) * 1000");
+  assert_command_execution_fails(env, "np.linalg.inv(s)");
+  assert_command_execution_succeeds(env, "np.linalg.det(s)", "0.0\n");
+  assert_command_execution_succeeds(
+      env, "np.linalg.inv(np.array([[2e-20,0],[0,4e-20]])).tolist()",
+      "[[5e+19, 0.0], [0.0, 2.5e+19]]\n");
+  assert_command_execution_succeeds(
+      env, "w, v = np.linalg.eig(np.array([[2,0],[0,3]]))");
+  assert_command_execution_succeeds(env, "w.tolist(), v.tolist()",
+                                    "([2.0, 3.0], [[1.0, 0.0], [0.0, 1.0]])\n");
+  assert_command_execution_succeeds(env, "m = np.array([[3,0],[4,5],[0,1]])");
+  assert_command_execution_succeeds(env, "q, r = np.linalg.qr(m)");
+  assert_command_execution_succeeds(env, "q.shape, r.shape",
+                                    "((3, 2), (2, 2))\n");
+  assert_command_execution_succeeds(env, "np.linalg.norm(np.dot(q, r) - m) < 1e-12",
+                                    "True\n");
+  assert_command_execution_succeeds(
+      env, "np.linalg.qr(m, mode='complete')[0].shape", "(3, 3)\n");
+  assert_command_execution_fails(env, "np.linalg.inv(np.array([[1,2],[2,4]]))");
+  assert_command_execution_fails(env, "np.linalg.cholesky(np.array([[1,2],[2,1]]))");
+  assert_command_execution_fails(env, "np.linalg.eig(np.array([[1,2],[0,1]]))");
+  // Pivoting keeps the larger systems accurate
+  assert_command_execution_succeeds(
+      env,
+      "b = np.array([[1/(1+abs(i-j)) + (i==j)*i for j in range(16)] for i in "
+      "range(16)])");
+  assert_command_execution_succeeds(
+      env,
+      "e = np.array([[float(i==j) for j in range(16)] for i in range(16)])");
+  assert_command_execution_succeeds(
+      env, "np.linalg.norm(np.dot(b, np.linalg.inv(b)) - e) < 1e-9", "True\n");
+  assert_command_execution_succeeds(
+      env, "np.linalg.norm(np.dot(q.transpose(), q) - e[:2,:2]) < 1e-12",
+      "True\n");
+
+  assert_command_execution_succeeds(env, "re, im = np.fft.fft(np.array([1,2,3,4]))");
+  assert_command_execution_succeeds(
+      env, "np.linalg.norm(re - np.array([10,-2,-2,-2])) < 1e-12", "True\n");
+  assert_command_execution_succeeds(
+      env, "np.linalg.norm(im - np.array([0,2,0,-2])) < 1e-12", "True\n");
+  assert_command_execution_succeeds(env, "x, y = np.fft.ifft(re, im)");
+  assert_command_execution_succeeds(
+      env, "np.linalg.norm(x - np.array([1,2,3,4])) + np.linalg.norm(y) < 1e-12",
+      "True\n");
+  assert_command_execution_fails(env, "np.fft.fft(np.array([1,2,3]))");
+  assert_command_execution_succeeds(
+      env, "re, im = np.fft.fft(np.array([1,2,3,4]), norm='forward')");
+  assert_command_execution_succeeds(
+      env, "np.linalg.norm(re - np.array([2.5,-0.5,-0.5,-0.5])) < 1e-12",
+      "True\n");
+  assert_command_execution_succeeds(
+      env, "x, y = np.fft.ifft(re, im, norm='forward')");
+  assert_command_execution_succeeds(
+      env, "np.linalg.norm(x - np.array([1,2,3,4])) + np.linalg.norm(y) < 1e-12",
+      "True\n");
+  assert_command_execution_succeeds(
+      env, "re, im = np.fft.fft(np.array([1,2,3,4]), norm='ortho')");
+  assert_command_execution_succeeds(
+      env, "np.linalg.norm(re - np.array([5,-1,-1,-1])) < 1e-12", "True\n");
+  assert_command_execution_succeeds(
+      env, "x, y = np.fft.ifft(re, im, norm='ortho')");
+  assert_command_execution_succeeds(
+      env, "np.linalg.norm(x - np.array([1,2,3,4])) + np.linalg.norm(y) < 1e-12",
+      "True\n");
+  assert_command_execution_fails(env,
+                                 "np.fft.fft(np.array([1,2]), norm='none')");
+  deinit_environment();
+}
@@ -0,0 +1,51 @@
+#include <quiz.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#include "execution_environment.h"
+
+constexpr static const char* k_profilePath =
+    "/tmp/python_profiler_test.folded";
+
+/* Return the milliseconds charged to the given stack of the profile, or -1 if
+ * it is missing. */
+static int millisecondsAt(const char* stack) {
+  FILE* f = fopen(k_profilePath, "r");
+  quiz_assert(f != nullptr);
+  char line[256];
+  int milliseconds = -1;
+  size_t length = strlen(stack);
+  while (fgets(line, sizeof(line), f) != nullptr) {
+    if (strncmp(line, stack, length) == 0 && line[length] == ' ') {
+      milliseconds = atoi(line + length + 1);
+      break;
+    }
+  }
+  fclose(f);
+  return milliseconds;
+}
+
+QUIZ_CASE(python_profiler) {
+  setenv("EPSILON_PYTHON_PROFILE", k_profilePath, 1);
+  assert_script_execution_succeeds(
+      "from time import monotonic\n"
+      "def spin(duration):\n"
+      "  start = monotonic()\n"
+      "  while monotonic() - start < duration:\n"
+      "    pass\n"
+      "def slow():\n"
+      "  spin(0.01)\n"
+      "  start = monotonic()\n"
+      "  while monotonic() - start < 0.06:\n"
+      "    pass\n"
+      "slow()\n"
+      "spin(0.03)\n");
+  unsetenv("EPSILON_PYTHON_PROFILE");
+  /* The time spent in each loop is charged to the function and line of its
+   * body, where the VM hook is called after jumping back, give or take a
+   * millisecond at each call. The two calls of spin add up. */
+  quiz_assert(millisecondsAt("<string>;slow;<string>:10") >= 58);
+  quiz_assert(millisecondsAt("<string>;spin;<string>:5") >= 38);
+  remove(k_profilePath);
+}
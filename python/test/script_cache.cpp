@@ -0,0 +1,52 @@
+#include <quiz.h>
+#include <string.h>
+
+#include "execution_environment.h"
+
+class TestScriptProvider : public MicroPython::ScriptProvider {
+ public:
+  TestScriptProvider(const char* content) : m_content(content) {}
+  const char* contentOfScript(const char* name, bool markAsFetched) override {
+    return strcmp(name, "lib.py") == 0 ? m_content : nullptr;
+  }
+  void setContent(const char* content) { m_content = content; }
+
+ private:
+  const char* m_content;
+};
+
+static void assert_import_succeeds(MicroPython::ScriptCache* cache,
+                                   TestScriptProvider* provider,
+                                   const char* command,
+                                   const char* outputText) {
+  TestExecutionEnvironment env = init_environement();
+  MicroPython::registerScriptProvider(provider);
+  MicroPython::registerScriptCache(cache);
+  assert_command_execution_succeeds(env, "from lib import *");
+  assert_command_execution_succeeds(env, command, outputText);
+  MicroPython::registerScriptCache(nullptr);
+  MicroPython::registerScriptProvider(nullptr);
+  deinit_environment();
+}
+
+QUIZ_CASE(python_script_cache) {
+  MicroPython::ScriptCache cache;
+  TestScriptProvider provider(
+      "def f(x):\n  return [i*x for i in range(3)]\nmessage='hello'\n");
+
+  assert_import_succeeds(&cache, &provider, "f(2)", "[0, 2, 4]\n");
+  quiz_assert(cache.numberOfEntries() == 1);
+  quiz_assert(cache.numberOfHits() == 0 && cache.numberOfMisses() == 1);
+
+  // The raw code survives the reinitialization of the heap
+  assert_import_succeeds(&cache, &provider, "print(f(3), message)",
+                         "[0, 3, 6] hello\n");
+  quiz_assert(cache.numberOfEntries() == 1);
+  quiz_assert(cache.numberOfHits() == 1 && cache.numberOfMisses() == 1);
+
+  // Editing the script invalidates its entry
+  provider.setContent("def f(x):\n  return x+1\n");
+  assert_import_succeeds(&cache, &provider, "f(2)", "3\n");
+  quiz_assert(cache.numberOfEntries() == 1);
+  quiz_assert(cache.numberOfHits() == 1 && cache.numberOfMisses() == 2);
+}
@@ -37,3 +37,27 @@ QUIZ_CASE(python_turtle_circle) {
   // assert_command_execution_succeeds(env, "position()", "(0.0, 0.0)\n");
   deinit_environment();
 }
+
+QUIZ_CASE(python_turtle_tracer) {
+  TestExecutionEnvironment env = init_environement();
+  assert_command_execution_succeeds(env, "from turtle import *");
+  assert_command_execution_succeeds(env, "tracer()", "1\n");
+  assert_command_execution_fails(env, "tracer(-1)");
+  assert_command_execution_succeeds(env, "tracer(0)");
+  assert_command_execution_succeeds(env, "tracer()", "0\n");
+  assert_command_execution_succeeds(env, "pensize(5)");
+  assert_command_execution_succeeds(env, "goto(40,-40);position()",
+                                    "(40.0, -40.0)\n");
+  assert_command_execution_succeeds(env, "update()");
+  assert_command_execution_succeeds(env, "for i in range(200): fd(i);lt(89)");
+  assert_command_execution_succeeds(env, "heading()", "160.0\n");
+  assert_command_execution_succeeds(env, "write('batched')");
+  assert_command_execution_succeeds(env,
+                                    "hideturtle();circle(20);showturtle()");
+  assert_command_execution_succeeds(env, "tracer(3)");
+  assert_command_execution_succeeds(env, "reset();goto(10,0);goto(0,0)");
+  assert_command_execution_succeeds(env, "tracer(1)");
+  assert_command_execution_succeeds(env, "forward(10);position()",
+                                    "(10.0, 0.0)\n");
+  deinit_environment();
+}
@@ -0,0 +1,42 @@
+# Throughput of the numpy operations, in elements per second.
+# Copy this script into the Python app of a simulator or of a calculator, and
+# run it. The strided lines go through the general loops, the other ones through
+# the fast paths of contiguous arrays and scalars.
+
+import numpy as np
+from time import monotonic
+
+N = 1000
+DURATION = 0.5
+
+def benchmark(name, f):
+  f()
+  runs = 0
+  start = monotonic()
+  elapsed = 0
+  while elapsed < DURATION:
+    f()
+    runs += 1
+    elapsed = monotonic() - start
+  print("%-18s %10d el/s" % (name, runs * N / elapsed))
+
+x = np.linspace(0, 1, N)
+y = np.linspace(1, 2, N)
+u = np.array(range(N), dtype=np.uint8)
+s = np.array(range(N), dtype=np.int16)
+strided = np.linspace(0, 1, 2 * N)[::2]
+
+benchmark("float + float", lambda: x + y)
+benchmark("float * scalar", lambda: x * 2.5)
+benchmark("float > float", lambda: x > y)
+benchmark("uint8 + uint8", lambda: u + u)
+benchmark("int16 * scalar", lambda: s * 3)
+benchmark("int16 == scalar", lambda: s == 7)
+benchmark("strided + float", lambda: strided + y)
+benchmark("sum float", lambda: np.sum(x))
+benchmark("mean int16", lambda: np.mean(s))
+benchmark("std float", lambda: np.std(x))
+benchmark("std strided", lambda: np.std(strided))
+benchmark("sin float", lambda: np.sin(x))
+benchmark("exp float", lambda: np.exp(x))
+benchmark("sqrt float", lambda: np.sqrt(x))